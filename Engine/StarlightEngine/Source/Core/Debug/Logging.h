@@ -36,7 +36,8 @@ enum ELogCategory : Uint8
 	LogMaths,
 	LogSObject,
 	LogSWorld,
-	LogSGameInstance
+	LogSGameInstance,
+	LogPhysics
 };
 
 static FString GetCategoryString(ELogCategory Category)
@@ -61,6 +62,8 @@ static FString GetCategoryString(ELogCategory Category)
 		return "LogSWorld";
 	case LogSGameInstance:
 		return "LogSGameInstance";
+	case LogPhysics:
+		return "LogPhysics";
 	}
 
 	return "LogUnknown";
@@ -3,104 +3,12 @@
 // Header
 #include "Color.h"
 
+// Libraries
+#include <array>
+
 // Starlight Engine
 #include "Math/Math.h"
-
-FRenderColor FRenderColor::operator+(const FRenderColor& Other) const
-{
-	FRenderColor Result = *this;
-	Result += Other;
-	return Result;
-}
-
-FRenderColor& FRenderColor::operator+=(const FRenderColor& Other)
-{
-	R += Other.R;
-	G += Other.G;
-	B += Other.B;
-	A += Other.A;
-	return *this;
-}
-
-FRenderColor FRenderColor::operator-(const FRenderColor& Other) const
-{
-	FRenderColor Result = *this;
-	Result -= Other;
-	return Result;
-}
-
-FRenderColor& FRenderColor::operator-=(const FRenderColor& Other)
-{
-	R -= Other.R;
-	G -= Other.G;
-	B -= Other.B;
-	A -= Other.A;
-	return *this;
-}
-
-FRenderColor FRenderColor::operator*(const FRenderColor& Other) const
-{
-	FRenderColor Result = *this;
-	Result *= Other;
-	return Result;
-}
-
-FRenderColor& FRenderColor::operator*=(const FRenderColor& Other)
-{
-	R *= Other.R;
-	G *= Other.G;
-	B *= Other.B;
-	A *= Other.A;
-	return *this;
-}
-
-FRenderColor FRenderColor::operator/(const FRenderColor& Other) const
-{
-	FRenderColor Result = *this;
-	Result /= Other;
-	return Result;
-}
-
-FRenderColor& FRenderColor::operator/=(const FRenderColor& Other)
-{
-	R /= Other.R;
-	G /= Other.G;
-	B /= Other.B;
-	A /= Other.A;
-	return *this;
-}
-
-FRenderColor FRenderColor::operator*(const float Value) const
-{
-	FRenderColor Result = *this;
-	Result *= Value;
-	return Result;
-}
-
-FRenderColor& FRenderColor::operator*=(const float Value)
-{
-	R *= Value;
-	G *= Value;
-	B *= Value;
-	A *= Value;
-	return *this;
-}
-
-FRenderColor FRenderColor::operator/(const float Value) const
-{
-	FRenderColor Result = *this;
-	Result /= Value;
-	return Result;
-}
-
-FRenderColor& FRenderColor::operator/=(const float Value)
-{
-	R /= Value;
-	G /= Value;
-	B /= Value;
-	A /= Value;
-	return *this;
-}
+#include "Math/Simd.h"
 
 FHueColor FRenderColor::ToHueColor() const
 {
@@ -112,112 +20,6 @@ FRenderColor::operator FHueColor() const
 	return ToHueColor();
 }
 
-FRenderColor FRenderColor::Clamped() const
-{
-	FRenderColor Result = *this;
-	Result.R = SMath::Clamp<float>(R, 0.f, 1.f);
-	Result.G = SMath::Clamp<float>(G, 0.f, 1.f);
-	Result.B = SMath::Clamp<float>(B, 0.f, 1.f);
-	Result.A = SMath::Clamp<float>(A, 0.f, 1.f);
-	return Result;
-}
-
-FHueColor FHueColor::operator+(const FHueColor& Other) const
-{
-	FHueColor Result = *this;
-	Result += Other;
-	return Result;
-}
-
-FHueColor& FHueColor::operator+=(const FHueColor& Other)
-{
-	H = SMath::Mod(H + Other.H, 360.f);
-	S += Other.S;
-	V += Other.V;
-	A += Other.A;
-	return *this;
-}
-
-FHueColor FHueColor::operator-(const FHueColor& Other) const
-{
-	FHueColor Result = *this;
-	Result -= Other;
-	return Result;
-}
-
-FHueColor& FHueColor::operator-=(const FHueColor& Other)
-{
-	H = SMath::Mod(H - Other.H, 360.f);
-	S -= Other.S;
-	V -= Other.V;
-	A -= Other.A;
-	return *this;
-}
-
-FHueColor FHueColor::operator*(const FHueColor& Other) const
-{
-	FHueColor Result = *this;
-	Result *= Other;
-	return Result;
-}
-
-FHueColor& FHueColor::operator*=(const FHueColor& Other)
-{
-	H = SMath::Mod(H * Other.H, 360.f);
-	S *= Other.S;
-	V *= Other.V;
-	A *= Other.A;
-	return *this;
-}
-
-FHueColor FHueColor::operator/(const FHueColor& Other) const
-{
-	FHueColor Result = *this;
-	Result /= Other;
-	return Result;
-}
-
-FHueColor& FHueColor::operator/=(const FHueColor& Other)
-{
-	H = SMath::Mod(H / Other.H, 360.f);
-	S /= Other.S;
-	V /= Other.V;
-	A /= Other.A;
-	return *this;
-}
-
-FHueColor FHueColor::operator*(const float Value) const
-{
-	FHueColor Result = *this;
-	Result *= Value;
-	return Result;
-}
-
-FHueColor& FHueColor::operator*=(const float Value)
-{
-	H = SMath::Mod(H * Value, 360.f);
-	S *= Value;
-	V *= Value;
-	A *= Value;
-	return *this;
-}
-
-FHueColor FHueColor::operator/(const float Value) const
-{
-	FHueColor Result = *this;
-	Result /= Value;
-	return Result;
-}
-
-FHueColor& FHueColor::operator/=(const float Value)
-{
-	H = SMath::Mod(H / Value, 360.f);
-	S /= Value;
-	V /= Value;
-	A /= Value;
-	return *this;
-}
-
 FRenderColor FHueColor::ToRenderColor() const
 {
 	return FHueColorToFRenderColor(*this);
@@ -228,16 +30,6 @@ FHueColor::operator FRenderColor() const
 	return ToRenderColor();
 }
 
-FHueColor FHueColor::Clamped() const
-{
-	FHueColor Result = *this;
-	Result.H = SMath::Mod(H, 360.f);
-	Result.S = SMath::Clamp<float>(S, 0.f, 1.f);
-	Result.V = SMath::Clamp<float>(V, 0.f, 1.f);
-	Result.A = SMath::Clamp<float>(A, 0.f, 1.f);
-	return Result;
-}
-
 FHueColor FRenderColorToFHueColor(const FRenderColor& InColor)
 {
 	using SMath::NearlyEqual;
@@ -351,3 +143,226 @@ FRenderColor FHueColorToFRenderColor(const FHueColor& InColor)
 
 	return OutColor;
 }
+
+// =============================================
+// PACKED COLOR
+// =============================================
+
+static_assert(sizeof(FPackedColor) == 4, "FPackedColor must stay four bytes");
+
+namespace
+{
+// Every 8-bit channel value as a float in [0, 1].
+constexpr auto UNORM8_TO_FLOAT = []
+{
+	std::array<float, 256> Table = {};
+	for (size_t Value = 0; Value < Table.size(); ++Value)
+	{
+		Table[Value] = static_cast<float>(Value) / 255.f;
+	}
+
+	return Table;
+}();
+}
+
+FRenderColor FPackedColor::ToRenderColor() const
+{
+	return FRenderColor(UNORM8_TO_FLOAT[R], UNORM8_TO_FLOAT[G], UNORM8_TO_FLOAT[B], UNORM8_TO_FLOAT[A]);
+}
+
+SDL_FColor FPackedColor::ToFColor() const
+{
+	return {UNORM8_TO_FLOAT[R], UNORM8_TO_FLOAT[G], UNORM8_TO_FLOAT[B], UNORM8_TO_FLOAT[A]};
+}
+
+// =============================================
+// BATCH CONVERSIONS
+// =============================================
+
+static_assert(sizeof(FRenderColor) == sizeof(float) * 4 && sizeof(FHueColor) == sizeof(float) * 4, "Batch conversions load colors as four packed floats");
+static_assert(sizeof(SDL_Color) == 4, "Batch conversions store SDL_Colors as packed bytes");
+
+#if SL_SIMD_SSE2
+namespace
+{
+// Floors each lane. SSE2 has no floor instruction, so truncate and step down where that rounded up.
+__m128 FloorPS(const __m128 Value)
+{
+	const __m128 Truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(Value));
+	return _mm_sub_ps(Truncated, _mm_and_ps(_mm_cmpgt_ps(Truncated, Value), _mm_set1_ps(1.f)));
+}
+
+// Lanes of Mask take IfTrue, the others IfFalse.
+__m128 SelectPS(const __m128 Mask, const __m128 IfTrue, const __m128 IfFalse)
+{
+	return _mm_or_ps(_mm_and_ps(Mask, IfTrue), _mm_andnot_ps(Mask, IfFalse));
+}
+
+// Value mod Divisor, always in [0, Divisor).
+__m128 WrapPS(const __m128 Value, const __m128 Divisor, const __m128 InverseDivisor)
+{
+	return _mm_sub_ps(Value, _mm_mul_ps(Divisor, FloorPS(_mm_mul_ps(Value, InverseDivisor))));
+}
+
+// One channel of HSV to RGB: V - V * S * clamp(min(K, 4 - K), 0, 1), with K = (N + H / 60) mod 6.
+__m128 HueChannelPS(const __m128 N, const __m128 HueSextant, const __m128 Chroma, const __m128 Value)
+{
+	const __m128 K = WrapPS(_mm_add_ps(N, HueSextant), _mm_set1_ps(6.f), _mm_set1_ps(1.f / 6.f));
+	const __m128 Ramp = _mm_min_ps(_mm_min_ps(K, _mm_sub_ps(_mm_set1_ps(4.f), K)), _mm_set1_ps(1.f));
+	return _mm_sub_ps(Value, _mm_mul_ps(Chroma, _mm_max_ps(Ramp, _mm_setzero_ps())));
+}
+}
+#endif
+
+void FRenderColorsToFHueColors(const std::span<const FRenderColor> In, const std::span<FHueColor> Out)
+{
+	const size_t Count = SDL_min(In.size(), Out.size());
+	size_t Index = 0;
+
+#if SL_SIMD_SSE2
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 One = _mm_set1_ps(1.f);
+	const __m128 Epsilon = _mm_set1_ps(SMath::EPSILON);
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		// Four colors in, transposed into one register per channel.
+		__m128 R = _mm_loadu_ps(&In[Index].R);
+		__m128 G = _mm_loadu_ps(&In[Index + 1].R);
+		__m128 B = _mm_loadu_ps(&In[Index + 2].R);
+		__m128 A = _mm_loadu_ps(&In[Index + 3].R);
+		_MM_TRANSPOSE4_PS(R, G, B, A);
+
+		const __m128 CMax = _mm_max_ps(_mm_max_ps(R, G), B);
+		const __m128 CMin = _mm_min_ps(_mm_min_ps(R, G), B);
+		const __m128 Delta = _mm_sub_ps(CMax, CMin);
+
+		// Grey lanes divide by one instead of zero and are masked to a hue of 0 below.
+		const __m128 bChromatic = _mm_cmpge_ps(Delta, Epsilon);
+		const __m128 InverseDelta = _mm_div_ps(One, SelectPS(bChromatic, Delta, One));
+
+		// Same precedence as the scalar version: red, then green, then blue.
+		const __m128 HueFromR = WrapPS(_mm_mul_ps(_mm_sub_ps(G, B), InverseDelta), _mm_set1_ps(6.f), _mm_set1_ps(1.f / 6.f));
+		const __m128 HueFromG = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(B, R), InverseDelta), _mm_set1_ps(2.f));
+		const __m128 HueFromB = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(R, G), InverseDelta), _mm_set1_ps(4.f));
+		const __m128 Sextant = SelectPS(_mm_cmpeq_ps(CMax, R), HueFromR, SelectPS(_mm_cmpeq_ps(CMax, G), HueFromG, HueFromB));
+
+		__m128 H = _mm_and_ps(bChromatic, _mm_mul_ps(Sextant, _mm_set1_ps(60.f)));
+		__m128 S = _mm_and_ps(_mm_cmpneq_ps(CMax, Zero), _mm_div_ps(Delta, SelectPS(_mm_cmpneq_ps(CMax, Zero), CMax, One)));
+		__m128 V = CMax;
+
+		_MM_TRANSPOSE4_PS(H, S, V, A);
+		_mm_storeu_ps(&Out[Index].H, H);
+		_mm_storeu_ps(&Out[Index + 1].H, S);
+		_mm_storeu_ps(&Out[Index + 2].H, V);
+		_mm_storeu_ps(&Out[Index + 3].H, A);
+	}
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		Out[Index] = FRenderColorToFHueColor(In[Index]);
+	}
+}
+
+void FHueColorsToFRenderColors(const std::span<const FHueColor> In, const std::span<FRenderColor> Out)
+{
+	const size_t Count = SDL_min(In.size(), Out.size());
+	size_t Index = 0;
+
+#if SL_SIMD_SSE2
+	const __m128 RedOffset = _mm_set1_ps(5.f);
+	const __m128 GreenOffset = _mm_set1_ps(3.f);
+	const __m128 BlueOffset = _mm_set1_ps(1.f);
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		__m128 H = _mm_loadu_ps(&In[Index].H);
+		__m128 S = _mm_loadu_ps(&In[Index + 1].H);
+		__m128 V = _mm_loadu_ps(&In[Index + 2].H);
+		__m128 A = _mm_loadu_ps(&In[Index + 3].H);
+		_MM_TRANSPOSE4_PS(H, S, V, A);
+
+		const __m128 HueSextant = WrapPS(_mm_mul_ps(H, _mm_set1_ps(1.f / 60.f)), _mm_set1_ps(6.f), _mm_set1_ps(1.f / 6.f));
+		const __m128 Chroma = _mm_mul_ps(V, S);
+
+		__m128 R = HueChannelPS(RedOffset, HueSextant, Chroma, V);
+		__m128 G = HueChannelPS(GreenOffset, HueSextant, Chroma, V);
+		__m128 B = HueChannelPS(BlueOffset, HueSextant, Chroma, V);
+
+		_MM_TRANSPOSE4_PS(R, G, B, A);
+		_mm_storeu_ps(&Out[Index].R, R);
+		_mm_storeu_ps(&Out[Index + 1].R, G);
+		_mm_storeu_ps(&Out[Index + 2].R, B);
+		_mm_storeu_ps(&Out[Index + 3].R, A);
+	}
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		FHueColor HueColor = In[Index];
+		HueColor.H = SMath::Mod(HueColor.H, 360.f);
+		if (HueColor.H < 0.f)
+		{
+			HueColor.H += 360.f;
+		}
+
+		Out[Index] = FHueColorToFRenderColor(HueColor);
+	}
+}
+
+void FRenderColorsToSDLColors(const std::span<const FRenderColor> In, const std::span<SDL_Color> Out)
+{
+	const size_t Count = SDL_min(In.size(), Out.size());
+	size_t Index = 0;
+
+#if SL_SIMD_SSE2
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 One = _mm_set1_ps(1.f);
+	const __m128 Scale = _mm_set1_ps(255.f);
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		// RGBA float lanes map straight onto SDL_Color's RGBA bytes, so no transpose is needed.
+		__m128i Channels[4];
+		for (int Color = 0; Color < 4; ++Color)
+		{
+			const __m128 Clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&In[Index + Color].R), Zero), One);
+			Channels[Color] = _mm_cvttps_epi32(_mm_mul_ps(Clamped, Scale));
+		}
+
+		const __m128i Packed16 = _mm_packs_epi32(Channels[0], Channels[1]);
+		const __m128i Packed16High = _mm_packs_epi32(Channels[2], Channels[3]);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&Out[Index]), _mm_packus_epi16(Packed16, Packed16High));
+	}
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		Out[Index] = In[Index];
+	}
+}
+
+void SDLColorsToFRenderColors(const std::span<const SDL_Color> In, const std::span<FRenderColor> Out)
+{
+	const size_t Count = SDL_min(In.size(), Out.size());
+	size_t Index = 0;
+
+#if SL_SIMD_SSE2
+	const __m128i Zero = _mm_setzero_si128();
+	const __m128 Scale = _mm_set1_ps(1.f / 255.f);
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&In[Index]));
+		const __m128i Low16 = _mm_unpacklo_epi8(Bytes, Zero);
+		const __m128i High16 = _mm_unpackhi_epi8(Bytes, Zero);
+
+		_mm_storeu_ps(&Out[Index].R, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Low16, Zero)), Scale));
+		_mm_storeu_ps(&Out[Index + 1].R, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(Low16, Zero)), Scale));
+		_mm_storeu_ps(&Out[Index + 2].R, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(High16, Zero)), Scale));
+		_mm_storeu_ps(&Out[Index + 3].R, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(High16, Zero)), Scale));
+	}
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		Out[Index] = FPackedColor(In[Index]).ToRenderColor();
+	}
+}
@@ -3,6 +3,8 @@
 #pragma once
 
 // Libraries
+#include <bit>
+#include <span>
 #include <SDL3/SDL_pixels.h>
 #include <SDL3/SDL_stdinc.h>
 
@@ -21,37 +23,123 @@ struct FRenderColor
 	float A;
 
 	// Default empty constructor (White)
-	FRenderColor() : R(1.f), G(1.f), B(1.f), A(1.f) {}
+	constexpr FRenderColor() : R(1.f), G(1.f), B(1.f), A(1.f) {}
 
 	// Copies another render color.
-	FRenderColor(const FRenderColor& RenderColor) = default;
+	constexpr FRenderColor(const FRenderColor& RenderColor) = default;
 
 	// Copies another render color but with the alpha overwritten with a new value from 0 to 1.
-	FRenderColor(const FRenderColor& RenderColor, const float A) : R(RenderColor.R), G(RenderColor.G), B(RenderColor.B), A(A) {}
+	constexpr FRenderColor(const FRenderColor& RenderColor, const float A) : R(RenderColor.R), G(RenderColor.G), B(RenderColor.B), A(A) {}
 
 	// Initialise all colors manually, RGBA values range from 0 to 1 each.
-	FRenderColor(const float R, const float G, const float B, const float A = 1.f) : R(R), G(G), B(B), A(A) {}
+	constexpr FRenderColor(const float R, const float G, const float B, const float A = 1.f) : R(R), G(G), B(B), A(A) {}
 
 	// Greyscale constructor
-	FRenderColor(const float Value, const float A = 1.f) : R(Value), G(Value), B(Value), A(A) {}
+	constexpr FRenderColor(const float Value, const float A = 1.f) : R(Value), G(Value), B(Value), A(A) {}
 
-	FRenderColor operator+(const FRenderColor& Other) const;
-	FRenderColor& operator+=(const FRenderColor& Other);
-	FRenderColor operator-(const FRenderColor& Other) const;
-	FRenderColor& operator-=(const FRenderColor& Other);
-	FRenderColor operator*(const FRenderColor& Other) const;
-	FRenderColor& operator*=(const FRenderColor& Other);
-	FRenderColor operator/(const FRenderColor& Other) const;
-	FRenderColor& operator/=(const FRenderColor& Other);
+	constexpr FRenderColor operator+(const FRenderColor& Other) const
+	{
+		FRenderColor Result = *this;
+		Result += Other;
+		return Result;
+	}
+
+	constexpr FRenderColor& operator+=(const FRenderColor& Other)
+	{
+		R += Other.R;
+		G += Other.G;
+		B += Other.B;
+		A += Other.A;
+		return *this;
+	}
+
+	constexpr FRenderColor operator-(const FRenderColor& Other) const
+	{
+		FRenderColor Result = *this;
+		Result -= Other;
+		return Result;
+	}
+
+	constexpr FRenderColor& operator-=(const FRenderColor& Other)
+	{
+		R -= Other.R;
+		G -= Other.G;
+		B -= Other.B;
+		A -= Other.A;
+		return *this;
+	}
+
+	constexpr FRenderColor operator*(const FRenderColor& Other) const
+	{
+		FRenderColor Result = *this;
+		Result *= Other;
+		return Result;
+	}
+
+	constexpr FRenderColor& operator*=(const FRenderColor& Other)
+	{
+		R *= Other.R;
+		G *= Other.G;
+		B *= Other.B;
+		A *= Other.A;
+		return *this;
+	}
+
+	constexpr FRenderColor operator/(const FRenderColor& Other) const
+	{
+		FRenderColor Result = *this;
+		Result /= Other;
+		return Result;
+	}
+
+	constexpr FRenderColor& operator/=(const FRenderColor& Other)
+	{
+		R /= Other.R;
+		G /= Other.G;
+		B /= Other.B;
+		A /= Other.A;
+		return *this;
+	}
+
+	constexpr FRenderColor operator*(const float Value) const
+	{
+		FRenderColor Result = *this;
+		Result *= Value;
+		return Result;
+	}
+
+	constexpr FRenderColor& operator*=(const float Value)
+	{
+		R *= Value;
+		G *= Value;
+		B *= Value;
+		A *= Value;
+		return *this;
+	}
+
+	constexpr FRenderColor operator/(const float Value) const
+	{
+		FRenderColor Result = *this;
+		Result /= Value;
+		return Result;
+	}
+
+	constexpr FRenderColor& operator/=(const float Value)
+	{
+		R /= Value;
+		G /= Value;
+		B /= Value;
+		A /= Value;
+		return *this;
+	}
 
-	FRenderColor operator*(float Value) const;
-	FRenderColor& operator*=(float Value);
-	FRenderColor operator/(float Value) const;
-	FRenderColor& operator/=(float Value);
+	// Exact, so any change to a colour is seen.
+	constexpr bool operator==(const FRenderColor& Other) const { return R == Other.R && G == Other.G && B == Other.B && A == Other.A; }
+	constexpr bool operator!=(const FRenderColor& Other) const { return !(*this == Other); }
 
-	operator SDL_Color() const
+	constexpr operator SDL_Color() const
 	{
-		FRenderColor Result = Clamped();
+		const FRenderColor Result = Clamped();
 		return {
 			static_cast<Uint8>(Result.R * 255.f),
 			static_cast<Uint8>(Result.G * 255.f),
@@ -63,26 +151,29 @@ struct FRenderColor
 	FHueColor ToHueColor() const;
 	operator FHueColor() const;
 
-	FRenderColor Clamped() const;
+	constexpr FRenderColor Clamped() const
+	{
+		return FRenderColor(SMath::Clamp<float>(R, 0.f, 1.f), SMath::Clamp<float>(G, 0.f, 1.f), SMath::Clamp<float>(B, 0.f, 1.f), SMath::Clamp<float>(A, 0.f, 1.f));
+	}
 };
 
 namespace ERenderColors
 {
-const FRenderColor BlackTransparent(0.f, 0.f);
-const FRenderColor WhiteTransparent(255.f, 0.f);
-
-const FRenderColor Black(0.f);
-const FRenderColor DarkGray(255.f * 0.25f);
-const FRenderColor Gray(255.f * 0.50f);
-const FRenderColor LightGray(255.f * 0.75f);
-const FRenderColor White(255.f);
-
-const FRenderColor Red(255.f, 0.f, 0.f);
-const FRenderColor Yellow(255.f, 255.f, 0.f);
-const FRenderColor Green(0.f, 255.f, 0.f);
-const FRenderColor Cyan(0.f, 255.f, 255.f);
-const FRenderColor Blue(0.f, 0.f, 255.f);
-const FRenderColor Magenta(255.f, 0.f, 255.f);
+constexpr FRenderColor BlackTransparent(0.f, 0.f);
+constexpr FRenderColor WhiteTransparent(255.f, 0.f);
+
+constexpr FRenderColor Black(0.f);
+constexpr FRenderColor DarkGray(255.f * 0.25f);
+constexpr FRenderColor Gray(255.f * 0.50f);
+constexpr FRenderColor LightGray(255.f * 0.75f);
+constexpr FRenderColor White(255.f);
+
+constexpr FRenderColor Red(255.f, 0.f, 0.f);
+constexpr FRenderColor Yellow(255.f, 255.f, 0.f);
+constexpr FRenderColor Green(0.f, 255.f, 0.f);
+constexpr FRenderColor Cyan(0.f, 255.f, 255.f);
+constexpr FRenderColor Blue(0.f, 0.f, 255.f);
+constexpr FRenderColor Magenta(255.f, 0.f, 255.f);
 }
 
 struct FHueColor
@@ -93,13 +184,13 @@ struct FHueColor
 	float A;
 
 	// Default empty constructor (White)
-	FHueColor() : H(0.f), S(0.f), V(1.f), A(1.f) {}
+	constexpr FHueColor() : H(0.f), S(0.f), V(1.f), A(1.f) {}
 
 	// Copies another render color.
-	FHueColor(const FHueColor& HueColor) = default;
+	constexpr FHueColor(const FHueColor& HueColor) = default;
 
 	// Copies another render color but with the alpha overwritten with a new value from 0.0f to 1.0f.
-	FHueColor(const FHueColor& HueColor, const float A) : H(HueColor.H), S(HueColor.S), V(HueColor.V), A(A) {}
+	constexpr FHueColor(const FHueColor& HueColor, const float A) : H(HueColor.H), S(HueColor.S), V(HueColor.V), A(A) {}
 
 	/**
 	 * @brief Initialise all colors manually, with default opaque alpha.
@@ -108,46 +199,185 @@ struct FHueColor
 	 * @param V Value: 0 to 1
 	 * @param A Alpha: 0 to 1
 	 */
-	FHueColor(const float H, const float S, const float V, const float A = 1.f) : H(SMath::Mod(H, 360.f)), S(S), V(V), A(A) {}
+	constexpr FHueColor(const float H, const float S, const float V, const float A = 1.f) : H(SMath::Mod(H, 360.f)), S(S), V(V), A(A) {}
 
 	// Greyscale constructor
-	FHueColor(const float V, const float A = 1.f) : H(0.f), S(0.f), V(V), A(A) {}
-
-	FHueColor operator+(const FHueColor& Other) const;
-	FHueColor& operator+=(const FHueColor& Other);
-	FHueColor operator-(const FHueColor& Other) const;
-	FHueColor& operator-=(const FHueColor& Other);
-	FHueColor operator*(const FHueColor& Other) const;
-	FHueColor& operator*=(const FHueColor& Other);
-	FHueColor operator/(const FHueColor& Other) const;
-	FHueColor& operator/=(const FHueColor& Other);
-
-	FHueColor operator*(float Value) const;
-	FHueColor& operator*=(float Value);
-	FHueColor operator/(float Value) const;
-	FHueColor& operator/=(float Value);
+	constexpr FHueColor(const float V, const float A = 1.f) : H(0.f), S(0.f), V(V), A(A) {}
+
+	constexpr FHueColor operator+(const FHueColor& Other) const
+	{
+		FHueColor Result = *this;
+		Result += Other;
+		return Result;
+	}
+
+	constexpr FHueColor& operator+=(const FHueColor& Other)
+	{
+		H += Other.H;
+		S += Other.S;
+		V += Other.V;
+		A += Other.A;
+		return *this;
+	}
+
+	constexpr FHueColor operator-(const FHueColor& Other) const
+	{
+		FHueColor Result = *this;
+		Result -= Other;
+		return Result;
+	}
+
+	constexpr FHueColor& operator-=(const FHueColor& Other)
+	{
+		H -= Other.H;
+		S -= Other.S;
+		V -= Other.V;
+		A -= Other.A;
+		return *this;
+	}
+
+	constexpr FHueColor operator*(const FHueColor& Other) const
+	{
+		FHueColor Result = *this;
+		Result *= Other;
+		return Result;
+	}
+
+	constexpr FHueColor& operator*=(const FHueColor& Other)
+	{
+		H *= Other.H;
+		S *= Other.S;
+		V *= Other.V;
+		A *= Other.A;
+		return *this;
+	}
+
+	constexpr FHueColor operator/(const FHueColor& Other) const
+	{
+		FHueColor Result = *this;
+		Result /= Other;
+		return Result;
+	}
+
+	constexpr FHueColor& operator/=(const FHueColor& Other)
+	{
+		H /= Other.H;
+		S /= Other.S;
+		V /= Other.V;
+		A /= Other.A;
+		return *this;
+	}
+
+	constexpr FHueColor operator*(const float Value) const
+	{
+		FHueColor Result = *this;
+		Result *= Value;
+		return Result;
+	}
+
+	constexpr FHueColor& operator*=(const float Value)
+	{
+		H *= Value;
+		S *= Value;
+		V *= Value;
+		A *= Value;
+		return *this;
+	}
+
+	constexpr FHueColor operator/(const float Value) const
+	{
+		FHueColor Result = *this;
+		Result /= Value;
+		return Result;
+	}
+
+	constexpr FHueColor& operator/=(const float Value)
+	{
+		H /= Value;
+		S /= Value;
+		V /= Value;
+		A /= Value;
+		return *this;
+	}
 
 	FRenderColor ToRenderColor() const;
 	operator FRenderColor() const;
 
-	FHueColor Clamped() const;
+	constexpr FHueColor Clamped() const
+	{
+		FHueColor Result = *this;
+		Result.H = SMath::Mod(H, 360.f);
+		Result.S = SMath::Clamp<float>(S, 0.f, 1.f);
+		Result.V = SMath::Clamp<float>(V, 0.f, 1.f);
+		Result.A = SMath::Clamp<float>(A, 0.f, 1.f);
+		return Result;
+	}
 };
 
 namespace EHueColors
 {
-const FHueColor Black(0.0f);
-const FHueColor DarkGray(0.25f);
-const FHueColor Gray(0.5f);
-const FHueColor LightGray(0.75f);
-const FHueColor White(1.0f);
-
-const FHueColor Red(0.f / 360.f, 1.f, 1.f);
-const FHueColor Yellow(60.f / 360.f, 1.f, 1.f);
-const FHueColor Green(120.f / 360.f, 1.f, 1.f);
-const FHueColor Cyan(180.f / 360.f, 1.f, 1.f);
-const FHueColor Blue(240.f / 360.f, 1.f, 1.f);
-const FHueColor Magenta(300.f / 360.f, 1.f, 1.f);
+constexpr FHueColor Black(0.0f);
+constexpr FHueColor DarkGray(0.25f);
+constexpr FHueColor Gray(0.5f);
+constexpr FHueColor LightGray(0.75f);
+constexpr FHueColor White(1.0f);
+
+constexpr FHueColor Red(0.f / 360.f, 1.f, 1.f);
+constexpr FHueColor Yellow(60.f / 360.f, 1.f, 1.f);
+constexpr FHueColor Green(120.f / 360.f, 1.f, 1.f);
+constexpr FHueColor Cyan(180.f / 360.f, 1.f, 1.f);
+constexpr FHueColor Blue(240.f / 360.f, 1.f, 1.f);
+constexpr FHueColor Magenta(300.f / 360.f, 1.f, 1.f);
 }
 
+/**
+ * @brief 8 bits per channel color, in the same byte order as SDL_Color.
+ * A quarter the size of an FRenderColor, for colors that are stored or copied in bulk. Converting to floats is a table
+ * lookup per channel, and the value is already clamped.
+ */
+struct FPackedColor
+{
+	Uint8 R = 255;
+	Uint8 G = 255;
+	Uint8 B = 255;
+	Uint8 A = 255;
+
+	// Default empty constructor (White)
+	constexpr FPackedColor() = default;
+
+	constexpr FPackedColor(const Uint8 R, const Uint8 G, const Uint8 B, const Uint8 A = 255) : R(R), G(G), B(B), A(A) {}
+
+	constexpr FPackedColor(const SDL_Color& Color) : R(Color.r), G(Color.g), B(Color.b), A(Color.a) {}
+
+	// Clamps and truncates, like FRenderColor's SDL_Color conversion.
+	explicit constexpr FPackedColor(const FRenderColor& Color) : FPackedColor(static_cast<SDL_Color>(Color)) {}
+
+	constexpr bool operator==(const FPackedColor& Other) const { return GetPackedValue() == Other.GetPackedValue(); }
+	constexpr bool operator!=(const FPackedColor& Other) const { return GetPackedValue() != Other.GetPackedValue(); }
+
+	constexpr operator SDL_Color() const { return {R, G, B, A}; }
+
+	FRenderColor ToRenderColor() const;
+	SDL_FColor ToFColor() const;
+
+	// All four channels as one integer, in memory order.
+	constexpr Uint32 GetPackedValue() const { return std::bit_cast<Uint32>(*this); }
+};
+
 FHueColor FRenderColorToFHueColor(const FRenderColor& InColor);
 FRenderColor FHueColorToFRenderColor(const FHueColor& InColor);
+
+// =============================================
+// BATCH CONVERSIONS
+// =============================================
+
+// The batch conversions below write one output per input, so Out must be at least as long as In. They run four colors
+// at a time with SSE2 where available, without branches, and match the per-color functions above to within float precision.
+// Hues are wrapped into [0, 360) first, where FHueColorToFRenderColor leaves negative hues black.
+
+void FRenderColorsToFHueColors(std::span<const FRenderColor> In, std::span<FHueColor> Out);
+void FHueColorsToFRenderColors(std::span<const FHueColor> In, std::span<FRenderColor> Out);
+
+// Clamps to [0, 1] and converts to 8 bits per channel, truncating like FRenderColor's SDL_Color conversion.
+void FRenderColorsToSDLColors(std::span<const FRenderColor> In, std::span<SDL_Color> Out);
+void SDLColorsToFRenderColors(std::span<const SDL_Color> In, std::span<FRenderColor> Out);
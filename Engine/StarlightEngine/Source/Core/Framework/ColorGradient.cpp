@@ -0,0 +1,98 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "ColorGradient.h"
+
+namespace
+{
+// Packs the blended colors into the table, four at a time.
+void PackEntries(const std::span<const FRenderColor> Colors, std::vector<FPackedColor>& OutEntries)
+{
+	std::vector<SDL_Color> Packed(Colors.size());
+	FRenderColorsToSDLColors(Colors, Packed);
+	OutEntries.assign(Packed.begin(), Packed.end());
+}
+}
+
+template <typename TStop, typename TBlend>
+void FColorGradientLUT::ForEachEntry(const std::span<const TStop> Stops, const Uint32 Resolution, TBlend&& Blend)
+{
+	// Index of the first stop at or after the current entry.
+	size_t NextStop = 0;
+	for (Uint32 Index = 0; Index < Resolution; ++Index)
+	{
+		const float T = Resolution > 1 ? static_cast<float>(Index) / static_cast<float>(Resolution - 1) : 0.f;
+		while (NextStop < Stops.size() && Stops[NextStop].Position < T)
+		{
+			++NextStop;
+		}
+
+		if (NextStop == 0 || NextStop == Stops.size())
+		{
+			const TStop& Stop = NextStop == 0 ? Stops.front() : Stops.back();
+			Blend(Stop, Stop, 0.f, Index);
+			continue;
+		}
+
+		const TStop& From = Stops[NextStop - 1];
+		const TStop& To = Stops[NextStop];
+		const float Span = To.Position - From.Position;
+		Blend(From, To, Span > 0.f ? (T - From.Position) / Span : 1.f, Index);
+	}
+}
+
+void FColorGradientLUT::Build(const std::span<const FColorStop> Stops, const Uint32 Resolution)
+{
+	Entries.clear();
+	if (Stops.empty() || Resolution == 0)
+	{
+		return;
+	}
+
+	std::vector<FRenderColor> Colors(Resolution);
+	ForEachEntry(Stops, Resolution, [&Colors](const FColorStop& From, const FColorStop& To, const float Alpha, const Uint32 Index)
+	{
+		Colors[Index] = SMath::Lerp(From.Color, To.Color, Alpha);
+	});
+
+	PackEntries(Colors, Entries);
+}
+
+void FColorGradientLUT::Build(const std::span<const FHueColorStop> Stops, const Uint32 Resolution)
+{
+	Entries.clear();
+	if (Stops.empty() || Resolution == 0)
+	{
+		return;
+	}
+
+	std::vector<FHueColor> HueColors(Resolution);
+	ForEachEntry(Stops, Resolution, [&HueColors](const FHueColorStop& From, const FHueColorStop& To, const float Alpha, const Uint32 Index)
+	{
+		// Shorter way round: the hue difference wrapped into [-180, 180). The batch conversion wraps the result.
+		const float HueDelta = SMath::Mod(To.Color.H - From.Color.H + 540.f, 360.f) - 180.f;
+
+		FHueColor& HueColor = HueColors[Index];
+		HueColor.H = From.Color.H + HueDelta * Alpha;
+		HueColor.S = SMath::Lerp(From.Color.S, To.Color.S, Alpha);
+		HueColor.V = SMath::Lerp(From.Color.V, To.Color.V, Alpha);
+		HueColor.A = SMath::Lerp(From.Color.A, To.Color.A, Alpha);
+	});
+
+	std::vector<FRenderColor> Colors(Resolution);
+	FHueColorsToFRenderColors(HueColors, Colors);
+	PackEntries(Colors, Entries);
+}
+
+const FPackedColor& FColorGradientLUT::SampleNormalized(const float T) const
+{
+	// An empty gradient reads as white, like an unset particle color.
+	static constexpr FPackedColor EMPTY_COLOR;
+	if (IsEmpty())
+	{
+		return EMPTY_COLOR;
+	}
+
+	const float Position = SMath::Clamp(T, 0.f, 1.f) * static_cast<float>(Entries.size() - 1);
+	return Entries[static_cast<size_t>(Position + 0.5f)];
+}
@@ -0,0 +1,63 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <span>
+#include <vector>
+
+// Starlight Engine
+#include "Color.h"
+
+// A key color of a gradient. Positions run from 0 at the start of the gradient to 1 at its end.
+struct FColorStop
+{
+	float Position = 0.f;
+	FRenderColor Color;
+};
+
+// A gradient key that blends in HSV, turning through hues instead of fading through grey.
+struct FHueColorStop
+{
+	float Position = 0.f;
+	FHueColor Color;
+};
+
+/**
+ * @brief A gradient baked into a table of packed colors, e.g. a particle color ramp or a palette cycle.
+ * Stops are blended once when the table is built. Sampling is then an array lookup, with no interpolation, clamping or
+ * float conversion per sample.
+ */
+class FColorGradientLUT
+{
+public:
+	static constexpr Uint32 DEFAULT_RESOLUTION = 256;
+
+	FColorGradientLUT() = default;
+	explicit FColorGradientLUT(std::span<const FColorStop> Stops, Uint32 Resolution = DEFAULT_RESOLUTION) { Build(Stops, Resolution); }
+	explicit FColorGradientLUT(std::span<const FHueColorStop> Stops, Uint32 Resolution = DEFAULT_RESOLUTION) { Build(Stops, Resolution); }
+
+	// Stops must be sorted by position. Before the first stop and after the last the gradient holds their colors.
+	void Build(std::span<const FColorStop> Stops, Uint32 Resolution = DEFAULT_RESOLUTION);
+
+	// As above, blending each hue the shorter way round the color wheel.
+	void Build(std::span<const FHueColorStop> Stops, Uint32 Resolution = DEFAULT_RESOLUTION);
+
+	Uint32 GetResolution() const { return static_cast<Uint32>(Entries.size()); }
+	bool IsEmpty() const { return Entries.empty(); }
+
+	// Entry Index, clamped to the last one. The table must not be empty.
+	const FPackedColor& Sample(const Uint32 Index) const { return Entries[SDL_min(Index, static_cast<Uint32>(Entries.size() - 1))]; }
+
+	// The nearest entry to T, from 0 at the start to 1 at the end. White if the table is empty.
+	const FPackedColor& SampleNormalized(float T) const;
+
+	const std::vector<FPackedColor>& GetEntries() const { return Entries; }
+
+private:
+	// Finds the stops either side of each entry, calling Blend(FromStop, ToStop, Alpha, EntryIndex).
+	template <typename TStop, typename TBlend>
+	static void ForEachEntry(std::span<const TStop> Stops, Uint32 Resolution, TBlend&& Blend);
+
+	std::vector<FPackedColor> Entries;
+};
@@ -0,0 +1,54 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <SDL3/SDL_stdinc.h>
+
+/**
+ * @brief Fixed-capacity FIFO that overwrites its oldest element when full. Never allocates.
+ * Every pushed element gets a sequence number that keeps counting up, so readers can hold a cursor across frames and
+ * detect when elements they had not read yet were overwritten.
+ * @tparam Capacity Must be a power of two.
+ */
+template <typename T, Uint32 Capacity>
+class TRingBuffer
+{
+	static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "TRingBuffer capacity must be a power of two");
+
+public:
+	static constexpr Uint32 CAPACITY = Capacity;
+
+	void Push(const T& Element)
+	{
+		Elements[EndSequence & (Capacity - 1)] = Element;
+		++EndSequence;
+	}
+
+	void Clear() { BeginSequence = EndSequence; }
+
+	bool IsEmpty() const { return BeginSequence == EndSequence; }
+	Uint32 GetCount() const { return static_cast<Uint32>(EndSequence - GetFirstSequence()); }
+
+	// Sequence number of the oldest element still held.
+	Uint64 GetFirstSequence() const { return EndSequence - BeginSequence > Capacity ? EndSequence - Capacity : BeginSequence; }
+
+	// Sequence number the next pushed element will get.
+	Uint64 GetEndSequence() const { return EndSequence; }
+
+	// How many elements from SinceSequence onwards were overwritten or cleared before they could be read.
+	Uint64 GetOverwrittenCount(const Uint64 SinceSequence) const
+	{
+		const Uint64 FirstSequence = GetFirstSequence();
+		return SinceSequence < FirstSequence ? FirstSequence - SinceSequence : 0;
+	}
+
+	// Sequence must be in [GetFirstSequence(), GetEndSequence()).
+	const T& At(const Uint64 Sequence) const { return Elements[Sequence & (Capacity - 1)]; }
+
+private:
+	T Elements[Capacity];
+
+	Uint64 BeginSequence = 0;
+	Uint64 EndSequence = 0;
+};
@@ -0,0 +1,152 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "TaskSystem.h"
+
+// Libraries
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::vector<std::thread> Workers;
+
+	// Guards everything below, except NextIndex which workers claim lock-free.
+	std::mutex JobMutex;
+	std::condition_variable JobAvailable;
+	std::condition_variable JobFinished;
+
+	const std::function<void(Uint32)>* JobFunction = nullptr;
+	Uint32 JobCount = 0;
+	std::atomic<Uint32> NextIndex = 0;
+
+	// Bumped for every job so each worker joins a job at most once.
+	Uint64 JobGeneration = 0;
+	bool bJobOpen = false;
+
+	// Workers currently inside the open job. The job is not closed until this is back to zero.
+	Uint32 ActiveWorkers = 0;
+	bool bStopping = false;
+
+	// Only one ParallelFor at a time, the rest wait their turn.
+	std::mutex SubmitMutex;
+
+	thread_local bool bInsideParallelFor = false;
+
+	void RunJobIndices(const std::function<void(Uint32)>& Function, const Uint32 Count)
+	{
+		bInsideParallelFor = true;
+		for (Uint32 Index = NextIndex.fetch_add(1); Index < Count; Index = NextIndex.fetch_add(1))
+		{
+			Function(Index);
+		}
+		bInsideParallelFor = false;
+	}
+
+	void WorkerMain()
+	{
+		Uint64 SeenGeneration = 0;
+		while (true)
+		{
+			const std::function<void(Uint32)>* Function;
+			Uint32 Count;
+			{
+				std::unique_lock Lock(JobMutex);
+				JobAvailable.wait(Lock, [&SeenGeneration]
+				{
+					return bStopping || (bJobOpen && JobGeneration != SeenGeneration);
+				});
+
+				if (bStopping)
+				{
+					return;
+				}
+
+				SeenGeneration = JobGeneration;
+				Function = JobFunction;
+				Count = JobCount;
+				++ActiveWorkers;
+			}
+
+			RunJobIndices(*Function, Count);
+
+			{
+				std::lock_guard Lock(JobMutex);
+				--ActiveWorkers;
+			}
+			JobFinished.notify_all();
+		}
+	}
+}
+
+void FTaskSystem::Initialise(Uint32 WorkerCount)
+{
+	Shutdown();
+
+	if (WorkerCount == 0)
+	{
+		const Uint32 HardwareThreads = std::thread::hardware_concurrency();
+		WorkerCount = HardwareThreads > 1 ? HardwareThreads - 1 : 0;
+	}
+
+	bStopping = false;
+	Workers.reserve(WorkerCount);
+	for (Uint32 Index = 0; Index < WorkerCount; ++Index)
+	{
+		Workers.emplace_back(WorkerMain);
+	}
+}
+
+void FTaskSystem::Shutdown()
+{
+	{
+		std::lock_guard Lock(JobMutex);
+		bStopping = true;
+	}
+	JobAvailable.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		Worker.join();
+	}
+	Workers.clear();
+}
+
+Uint32 FTaskSystem::GetWorkerCount()
+{
+	return static_cast<Uint32>(Workers.size());
+}
+
+void FTaskSystem::ParallelFor(const Uint32 Count, const std::function<void(Uint32)>& Function)
+{
+	if (Count <= 1 || Workers.empty() || bInsideParallelFor)
+	{
+		for (Uint32 Index = 0; Index < Count; ++Index)
+		{
+			Function(Index);
+		}
+		return;
+	}
+
+	std::lock_guard SubmitLock(SubmitMutex);
+	{
+		std::lock_guard Lock(JobMutex);
+		JobFunction = &Function;
+		JobCount = Count;
+		NextIndex = 0;
+		++JobGeneration;
+		bJobOpen = true;
+	}
+	JobAvailable.notify_all();
+
+	RunJobIndices(Function, Count);
+
+	// Every index is claimed by now, wait for the workers still running theirs.
+	std::unique_lock Lock(JobMutex);
+	JobFinished.wait(Lock, [] { return ActiveWorkers == 0; });
+	bJobOpen = false;
+	JobFunction = nullptr;
+}
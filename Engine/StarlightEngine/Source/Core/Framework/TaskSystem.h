@@ -0,0 +1,28 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <functional>
+#include <SDL3/SDL_stdinc.h>
+
+/**
+ * @brief Pool of worker threads for splitting frame work into parallel chunks.
+ * The pool is started by the engine. Until then, or with zero workers, everything runs on the calling thread.
+ */
+class FTaskSystem
+{
+public:
+	// Starts the workers. A WorkerCount of 0 uses one less than the number of hardware threads.
+	static void Initialise(Uint32 WorkerCount = 0);
+	static void Shutdown();
+
+	static Uint32 GetWorkerCount();
+
+	/**
+	 * @brief Calls Function(Index) for every Index in [0, Count), spread over the workers and the calling thread.
+	 * Returns once every call has finished. Calls for different indices may run at the same time, so Function must only
+	 * write to data owned by its index. Nested calls from inside Function run serially on the current thread.
+	 */
+	static void ParallelFor(Uint32 Count, const std::function<void(Uint32)>& Function);
+};
@@ -0,0 +1,56 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <atomic>
+#include <SDL3/SDL_stdinc.h>
+
+/**
+ * @brief Lock-free handoff of the latest value from one writer thread to one reader thread.
+ * The writer always has a buffer of its own to fill and the reader always has a complete one to read, so neither ever
+ * waits. Values the reader did not pick up in time are replaced by newer ones.
+ */
+template <typename T>
+class TTripleBuffer
+{
+public:
+	// Writer only. The buffer to fill, which keeps its previous contents.
+	T& GetWriteBuffer() { return Buffers[WriteIndex]; }
+
+	// Writer only. Hands the write buffer to the reader and takes back a free one.
+	void Publish()
+	{
+		const Uint8 PreviousShared = Shared.exchange(static_cast<Uint8>(WriteIndex | FRESH_BIT), std::memory_order_acq_rel);
+		WriteIndex = PreviousShared & INDEX_MASK;
+	}
+
+	// Reader only. Switches to the most recently published buffer.
+	/// @returns false if nothing was published since the last call, in which case the read buffer is unchanged.
+	bool Acquire()
+	{
+		if ((Shared.load(std::memory_order_relaxed) & FRESH_BIT) == 0)
+		{
+			return false;
+		}
+
+		const Uint8 PreviousShared = Shared.exchange(ReadIndex, std::memory_order_acq_rel);
+		ReadIndex = PreviousShared & INDEX_MASK;
+		return true;
+	}
+
+	// Reader only.
+	const T& GetReadBuffer() const { return Buffers[ReadIndex]; }
+
+private:
+	static constexpr Uint8 INDEX_MASK = 0x3;
+	static constexpr Uint8 FRESH_BIT = 0x4;
+
+	T Buffers[3];
+
+	// Index of the buffer between the two threads, plus whether it holds a value the reader has not taken yet.
+	std::atomic<Uint8> Shared = 1;
+
+	Uint8 WriteIndex = 0;
+	Uint8 ReadIndex = 2;
+};
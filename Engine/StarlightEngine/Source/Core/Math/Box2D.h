@@ -0,0 +1,113 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Starlight Engine
+#include "Math.h"
+#include "Vector2.h"
+#include "Framework/String.h"
+
+/**
+* @struct FBox2D
+* @brief Axis-aligned 2D bounding box.
+*/
+struct FBox2D
+{
+	FVector2 Min;
+	FVector2 Max;
+
+	// Constructors
+	constexpr FBox2D() : Min(0.0f), Max(0.0f) {}
+	constexpr FBox2D(const FVector2& InMin, const FVector2& InMax) : Min(InMin), Max(InMax) {}
+
+	static constexpr FBox2D FromCentreExtent(const FVector2& Centre, const FVector2& Extent) { return FBox2D(Centre - Extent, Centre + Extent); }
+
+	constexpr FVector2 GetCentre() const { return (Min + Max) * 0.5f; }
+	constexpr FVector2 GetSize() const { return Max - Min; }
+
+	// Half of the size.
+	constexpr FVector2 GetExtent() const { return (Max - Min) * 0.5f; }
+
+	constexpr bool IsValid() const { return Min.x <= Max.x && Min.y <= Max.y; }
+
+	// Touching edges count as intersecting.
+	constexpr bool Intersects(const FBox2D& Other) const
+	{
+		return Min.x <= Other.Max.x && Max.x >= Other.Min.x && Min.y <= Other.Max.y && Max.y >= Other.Min.y;
+	}
+
+	constexpr bool Contains(const FVector2& Point) const
+	{
+		return Point.x >= Min.x && Point.x <= Max.x && Point.y >= Min.y && Point.y <= Max.y;
+	}
+
+	constexpr bool Contains(const FBox2D& Other) const
+	{
+		return Other.Min.x >= Min.x && Other.Max.x <= Max.x && Other.Min.y >= Min.y && Other.Max.y <= Max.y;
+	}
+
+	// Grows the box by Amount on every side.
+	constexpr FBox2D ExpandedBy(const float Amount) const { return FBox2D(Min - FVector2(Amount), Max + FVector2(Amount)); }
+
+	constexpr FBox2D Union(const FBox2D& Other) const
+	{
+		return FBox2D(
+			FVector2(SMath::Min(Min.x, Other.Min.x), SMath::Min(Min.y, Other.Min.y)),
+			FVector2(SMath::Max(Max.x, Other.Max.x), SMath::Max(Max.y, Other.Max.y)));
+	}
+
+	// The overlap of both boxes. Not valid if they do not intersect.
+	constexpr FBox2D Intersection(const FBox2D& Other) const
+	{
+		return FBox2D(
+			FVector2(SMath::Max(Min.x, Other.Min.x), SMath::Max(Min.y, Other.Min.y)),
+			FVector2(SMath::Min(Max.x, Other.Max.x), SMath::Min(Max.y, Other.Max.y)));
+	}
+
+	// The point inside the box closest to Point.
+	constexpr FVector2 ClosestPoint(const FVector2& Point) const
+	{
+		return FVector2(SMath::Clamp(Point.x, Min.x, Max.x), SMath::Clamp(Point.y, Min.y, Max.y));
+	}
+
+	constexpr bool IntersectsCircle(const FVector2& Centre, const float Radius) const
+	{
+		return (ClosestPoint(Centre) - Centre).LengthSquared() <= Radius * Radius;
+	}
+
+	/**
+	* @brief Slab test of a ray segment against the box.
+	* @param Origin Start of the ray.
+	* @param InverseDirection 1 / direction per axis. Use a large finite value for zero components, see SafeInverse.
+	* @param MaxDistance Length of the segment in units of direction.
+	* @param OutDistance Entry distance along the ray, 0 if Origin is inside the box.
+	* @return Whether the segment touches the box.
+	*/
+	constexpr bool RayIntersects(const FVector2& Origin, const FVector2& InverseDirection, const float MaxDistance, float& OutDistance) const
+	{
+		const float TX1 = (Min.x - Origin.x) * InverseDirection.x;
+		const float TX2 = (Max.x - Origin.x) * InverseDirection.x;
+		const float TY1 = (Min.y - Origin.y) * InverseDirection.y;
+		const float TY2 = (Max.y - Origin.y) * InverseDirection.y;
+
+		const float TMin = SMath::Max(SMath::Max(SMath::Min(TX1, TX2), SMath::Min(TY1, TY2)), 0.0f);
+		const float TMax = SMath::Min(SMath::Min(SMath::Max(TX1, TX2), SMath::Max(TY1, TY2)), MaxDistance);
+
+		OutDistance = TMin;
+		return TMin <= TMax;
+	}
+
+	// Per-axis reciprocal for RayIntersects that avoids infinities (and the NaNs they produce on box edges).
+	static constexpr FVector2 SafeInverse(const FVector2& Direction)
+	{
+		constexpr float LARGE_INVERSE = 1e30f;
+		return FVector2(
+			SMath::Abs(Direction.x) > SMath::EPSILON ? 1.0f / Direction.x : LARGE_INVERSE,
+			SMath::Abs(Direction.y) > SMath::EPSILON ? 1.0f / Direction.y : LARGE_INVERSE);
+	}
+
+	FString ToString() const
+	{
+		return FString("[" + Min.ToString() + " - " + Max.ToString() + "]");
+	}
+};
@@ -4,5 +4,8 @@
 
 // Starlight Engine
 #include "Math.h"
+#include "Box2D.h"
+#include "Fixed.h"
+#include "FixedVector2.h"
 #include "Vector2.h"
 #include "Vector3.h"
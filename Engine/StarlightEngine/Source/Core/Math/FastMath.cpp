@@ -0,0 +1,239 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "FastMath.h"
+
+#if SL_SIMD_SSE2
+namespace
+{
+// Lanes of Mask take IfTrue, the others IfFalse.
+__m128 SelectPS(const __m128 Mask, const __m128 IfTrue, const __m128 IfFalse)
+{
+	return _mm_or_ps(_mm_and_ps(Mask, IfTrue), _mm_andnot_ps(Mask, IfFalse));
+}
+
+// Evaluates the polynomial with the given coefficients, highest power first, at X.
+template <size_t N>
+__m128 PolyPS(const __m128 X, const float (&Coefficients)[N])
+{
+	__m128 Result = _mm_set1_ps(Coefficients[0]);
+	for (size_t Index = 1; Index < N; ++Index)
+	{
+		Result = _mm_add_ps(_mm_mul_ps(Result, X), _mm_set1_ps(Coefficients[Index]));
+	}
+	return Result;
+}
+
+using namespace SMath::Fast::Detail;
+
+// Reduces to Y in [-pi/2, pi/2] and the sign bit to flip the results by, as in SMath::Fast::SinCos.
+void ReduceSinCosPS(const __m128 Radians, __m128& OutY, __m128& OutSignBit)
+{
+	// Converting rounds to nearest.
+	const __m128i Multiple = _mm_cvtps_epi32(_mm_mul_ps(Radians, _mm_set1_ps(INV_PI)));
+	const __m128 Q = _mm_cvtepi32_ps(Multiple);
+
+	OutY = _mm_sub_ps(_mm_sub_ps(Radians, _mm_mul_ps(Q, _mm_set1_ps(PI_HI))), _mm_mul_ps(Q, _mm_set1_ps(PI_LO)));
+	OutSignBit = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(Multiple, _mm_set1_epi32(1)), 31));
+}
+
+__m128 SinPS(const __m128 Radians)
+{
+	__m128 Y;
+	__m128 SignBit;
+	ReduceSinCosPS(Radians, Y, SignBit);
+	return _mm_xor_ps(_mm_mul_ps(Y, PolyPS(_mm_mul_ps(Y, Y), SIN_COEFFICIENTS)), SignBit);
+}
+
+__m128 CosPS(const __m128 Radians)
+{
+	__m128 Y;
+	__m128 SignBit;
+	ReduceSinCosPS(Radians, Y, SignBit);
+	return _mm_xor_ps(PolyPS(_mm_mul_ps(Y, Y), COS_COEFFICIENTS), SignBit);
+}
+
+__m128 ATan2PS(const __m128 Y, const __m128 X)
+{
+	const __m128 SignMask = _mm_set1_ps(-0.f);
+	const __m128 AbsY = _mm_andnot_ps(SignMask, Y);
+	const __m128 AbsX = _mm_andnot_ps(SignMask, X);
+	const __m128 Largest = _mm_max_ps(AbsX, AbsY);
+
+	// Both zero gives 0 / 0, masked to 0.
+	const __m128 Z = _mm_and_ps(_mm_div_ps(_mm_min_ps(AbsX, AbsY), Largest), _mm_cmpgt_ps(Largest, _mm_setzero_ps()));
+
+	__m128 Angle = _mm_mul_ps(Z, PolyPS(_mm_mul_ps(Z, Z), ATAN_COEFFICIENTS));
+	Angle = SelectPS(_mm_cmpgt_ps(AbsY, AbsX), _mm_sub_ps(_mm_set1_ps(SMath::HALF_PI), Angle), Angle);
+	Angle = SelectPS(_mm_cmplt_ps(X, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(SMath::PI), Angle), Angle);
+	return _mm_or_ps(Angle, _mm_and_ps(_mm_cmplt_ps(Y, _mm_setzero_ps()), SignMask));
+}
+
+__m128 RSqrtPS(const __m128 Value)
+{
+	const __m128 Estimate = _mm_rsqrt_ps(Value);
+	const __m128 HalfValueEstimate = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), Value), Estimate);
+	return _mm_mul_ps(Estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(HalfValueEstimate, Estimate)));
+}
+
+__m128 ExpPS(const __m128 Value)
+{
+	const __m128 Clamped = _mm_min_ps(_mm_max_ps(Value, _mm_set1_ps(EXP_MIN)), _mm_set1_ps(EXP_MAX));
+	const __m128i N = _mm_cvtps_epi32(_mm_mul_ps(Clamped, _mm_set1_ps(LOG2_E)));
+	const __m128 NFloat = _mm_cvtepi32_ps(N);
+	const __m128 R = _mm_sub_ps(_mm_sub_ps(Clamped, _mm_mul_ps(NFloat, _mm_set1_ps(LN_2_HI))), _mm_mul_ps(NFloat, _mm_set1_ps(LN_2_LO)));
+	const __m128 F = _mm_mul_ps(R, _mm_set1_ps(LOG2_E));
+
+	const __m128 Scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(N, _mm_set1_epi32(127)), 23));
+	return _mm_mul_ps(PolyPS(F, EXP2_COEFFICIENTS), Scale);
+}
+
+__m128 LnPS(const __m128 Value)
+{
+	const __m128i Bits = _mm_castps_si128(Value);
+	__m128 Exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(127)));
+	__m128 Mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+
+	const __m128 Above = _mm_cmpgt_ps(Mantissa, _mm_set1_ps(SQRT_2));
+	Mantissa = SelectPS(Above, _mm_mul_ps(Mantissa, _mm_set1_ps(0.5f)), Mantissa);
+	Exponent = _mm_add_ps(Exponent, _mm_and_ps(Above, _mm_set1_ps(1.f)));
+
+	const __m128 One = _mm_set1_ps(1.f);
+	const __m128 S = _mm_div_ps(_mm_sub_ps(Mantissa, One), _mm_add_ps(Mantissa, One));
+	const __m128 Series = _mm_mul_ps(S, PolyPS(_mm_mul_ps(S, S), LN_COEFFICIENTS));
+	return _mm_add_ps(_mm_mul_ps(Exponent, _mm_set1_ps(LN_2)), Series);
+}
+
+// Applies Function to the first Count values four lanes at a time. @returns how many were done, leaving a remainder of under four.
+template <typename TFunction>
+size_t TransformPS(const float* In, float* Out, const size_t Count, TFunction Function)
+{
+	size_t Index = 0;
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		_mm_storeu_ps(Out + Index, Function(_mm_loadu_ps(In + Index)));
+	}
+	return Index;
+}
+}
+#endif
+
+namespace SMath::Fast
+{
+void Sin(const std::span<const float> Radians, const std::span<float> Out)
+{
+	const size_t Count = SDL_min(Radians.size(), Out.size());
+	size_t Index = 0;
+
+#if SL_SIMD_SSE2
+	Index = TransformPS(Radians.data(), Out.data(), Count, SinPS);
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		Out[Index] = Sin(Radians[Index]);
+	}
+}
+
+void Cos(const std::span<const float> Radians, const std::span<float> Out)
+{
+	const size_t Count = SDL_min(Radians.size(), Out.size());
+	size_t Index = 0;
+
+#if SL_SIMD_SSE2
+	Index = TransformPS(Radians.data(), Out.data(), Count, CosPS);
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		Out[Index] = Cos(Radians[Index]);
+	}
+}
+
+void SinCos(const std::span<const float> Radians, const std::span<float> OutSin, const std::span<float> OutCos)
+{
+	const size_t Count = SDL_min(Radians.size(), SDL_min(OutSin.size(), OutCos.size()));
+	size_t Index = 0;
+
+#if SL_SIMD_SSE2
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		__m128 Y;
+		__m128 SignBit;
+		ReduceSinCosPS(_mm_loadu_ps(Radians.data() + Index), Y, SignBit);
+
+		const __m128 Y2 = _mm_mul_ps(Y, Y);
+		_mm_storeu_ps(OutSin.data() + Index, _mm_xor_ps(_mm_mul_ps(Y, PolyPS(Y2, SIN_COEFFICIENTS)), SignBit));
+		_mm_storeu_ps(OutCos.data() + Index, _mm_xor_ps(PolyPS(Y2, COS_COEFFICIENTS), SignBit));
+	}
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		SinCos(Radians[Index], OutSin[Index], OutCos[Index]);
+	}
+}
+
+void ATan2(const std::span<const float> Y, const std::span<const float> X, const std::span<float> Out)
+{
+	const size_t Count = SDL_min(Out.size(), SDL_min(Y.size(), X.size()));
+	size_t Index = 0;
+
+#if SL_SIMD_SSE2
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		_mm_storeu_ps(Out.data() + Index, ATan2PS(_mm_loadu_ps(Y.data() + Index), _mm_loadu_ps(X.data() + Index)));
+	}
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		Out[Index] = ATan2(Y[Index], X[Index]);
+	}
+}
+
+void RSqrt(const std::span<const float> Values, const std::span<float> Out)
+{
+	const size_t Count = SDL_min(Values.size(), Out.size());
+	size_t Index = 0;
+
+#if SL_SIMD_SSE2
+	Index = TransformPS(Values.data(), Out.data(), Count, RSqrtPS);
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		Out[Index] = RSqrt(Values[Index]);
+	}
+}
+
+void Exp(const std::span<const float> Values, const std::span<float> Out)
+{
+	const size_t Count = SDL_min(Values.size(), Out.size());
+	size_t Index = 0;
+
+#if SL_SIMD_SSE2
+	Index = TransformPS(Values.data(), Out.data(), Count, ExpPS);
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		Out[Index] = Exp(Values[Index]);
+	}
+}
+
+void Ln(const std::span<const float> Values, const std::span<float> Out)
+{
+	const size_t Count = SDL_min(Values.size(), Out.size());
+	size_t Index = 0;
+
+#if SL_SIMD_SSE2
+	Index = TransformPS(Values.data(), Out.data(), Count, LnPS);
+#endif
+
+	for (; Index < Count; ++Index)
+	{
+		Out[Index] = Ln(Values[Index]);
+	}
+}
+}
@@ -0,0 +1,203 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <span>
+#include <SDL3/SDL_stdinc.h>
+
+// Starlight Engine
+#include "Math.h"
+#include "Simd.h"
+
+/**
+ * @brief Fast tier of SMath, for code that evaluates millions of functions per second and can afford a tiny error,
+ * e.g. particles and animation. Nothing switches over implicitly: SMath stays precise and these are called by name.
+ *
+ * Polynomial approximations, with their worst errors against the precise SMath versions measured over the domain:
+ *
+ *   Function     Domain                  Worst error
+ *   Sin, Cos     |Radians| <= 10         2e-7 absolute
+ *                |Radians| <= 100000     2e-6 absolute, growing past that as range reduction loses precision
+ *   ATan2        any finite              6e-7 radians
+ *   RSqrt        positive normal         3e-7 relative with SSE2, 5e-6 without
+ *   Exp          [-87.3, 88.3]           3e-7 relative, clamped to that range outside it
+ *   Ln           positive normal         2e-7 absolute where |result| <= 1, 2e-7 relative past that
+ *
+ * No function checks for NaN, infinity, zero or negative inputs where the precise version would, and none set errno.
+ * Each also has a span overload for batches, which evaluates four values at a time where SSE2 is available.
+ * CheckAccuracy measures all of them against this table; run it with the "-CheckMath" command line flag.
+ */
+namespace SMath::Fast
+{
+namespace Detail
+{
+// Pi split so Q * PI_HI is exact for any reduction multiple Q below 2^16, keeping range reduction precise.
+constexpr float PI_HI = 3.140625f;
+constexpr float PI_LO = 9.67653589793e-4f;
+constexpr float INV_PI = 1.f / PI;
+
+constexpr float LOG2_E = 1.44269504089f;
+constexpr float LN_2 = 0.693147180560f;
+constexpr float SQRT_2 = 1.41421356237f;
+
+// Ln 2 split the same way as pi, for Exp.
+constexpr float LN_2_HI = 0.693145751953125f;
+constexpr float LN_2_LO = 1.42860682030941723e-6f;
+
+constexpr float EXP_MIN = -87.3f;
+constexpr float EXP_MAX = 88.3f;
+
+// Polynomial coefficients, highest power first.
+
+// Minimax fits of sin(x) / x and cos(x) in x^2 over [-pi/2, pi/2].
+constexpr float SIN_COEFFICIENTS[] = {2.59048683e-06f, -0.000198008968f, 0.00833289981f, -0.166666476f, 0.999999977f};
+constexpr float COS_COEFFICIENTS[] = {2.31539584e-05f, -0.00138537058f, 0.041663585f, -0.499999054f, 0.999999954f};
+
+// Minimax fit of atan(z) / z in z^2 over [0, 1].
+constexpr float ATAN_COEFFICIENTS[] = {0.00681182615f, -0.0336043283f, 0.0796238086f, -0.132333504f, 0.19807818f, -0.333173684f, 0.999996112f};
+
+// Minimax fit of 2^f over [-0.5, 0.5], by relative error.
+constexpr float EXP2_COEFFICIENTS[] = {0.00132764718f, 0.00967554133f, 0.0555071327f, 0.240221197f, 0.693146967f, 1.00000007f};
+
+// atanh(s) / s series, for ln(m) = 2 atanh((m - 1) / (m + 1)) with |s| <= 0.172 when m is in [sqrt(0.5), sqrt(2)].
+constexpr float LN_COEFFICIENTS[] = {2.f / 9.f, 2.f / 7.f, 2.f / 5.f, 2.f / 3.f, 2.f};
+
+template <size_t N>
+inline float Poly(const float X, const float (&Coefficients)[N])
+{
+	float Result = Coefficients[0];
+	for (size_t Index = 1; Index < N; ++Index)
+	{
+		Result = Result * X + Coefficients[Index];
+	}
+	return Result;
+}
+
+inline Uint32 FloatBits(const float Value)
+{
+	Uint32 Bits;
+	SDL_memcpy(&Bits, &Value, sizeof(Bits));
+	return Bits;
+}
+
+inline float BitsFloat(const Uint32 Bits)
+{
+	float Value;
+	SDL_memcpy(&Value, &Bits, sizeof(Value));
+	return Value;
+}
+}
+
+inline void SinCos(const float Radians, float& OutSin, float& OutCos)
+{
+	// Reduce to Y in [-pi/2, pi/2], where sin and cos of Radians are those of Y, negated for odd multiples of pi.
+	const Sint32 Multiple = static_cast<Sint32>(Radians * Detail::INV_PI + (Radians >= 0.f ? 0.5f : -0.5f));
+	const float Q = static_cast<float>(Multiple);
+	const float Y = (Radians - Q * Detail::PI_HI) - Q * Detail::PI_LO;
+	const float Y2 = Y * Y;
+
+	const float Sign = (Multiple & 1) != 0 ? -1.f : 1.f;
+	OutSin = Sign * Y * Detail::Poly(Y2, Detail::SIN_COEFFICIENTS);
+	OutCos = Sign * Detail::Poly(Y2, Detail::COS_COEFFICIENTS);
+}
+
+inline float Sin(const float Radians)
+{
+	float Sine;
+	float Cosine;
+	SinCos(Radians, Sine, Cosine);
+	return Sine;
+}
+
+inline float Cos(const float Radians)
+{
+	float Sine;
+	float Cosine;
+	SinCos(Radians, Sine, Cosine);
+	return Cosine;
+}
+
+inline float ATan2(const float Y, const float X)
+{
+	const float AbsY = SDL_fabsf(Y);
+	const float AbsX = SDL_fabsf(X);
+	const float Largest = SDL_max(AbsX, AbsY);
+	const float Z = Largest > 0.f ? SDL_min(AbsX, AbsY) / Largest : 0.f;
+
+	float Angle = Z * Detail::Poly(Z * Z, Detail::ATAN_COEFFICIENTS);
+	Angle = AbsY > AbsX ? HALF_PI - Angle : Angle;
+	Angle = X < 0.f ? PI - Angle : Angle;
+	return Y < 0.f ? -Angle : Angle;
+}
+
+// 1 / Sqrt(Value).
+inline float RSqrt(const float Value)
+{
+#if SL_SIMD_SSE2
+	// Hardware estimate, good to 12 bits.
+	const float Estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(Value)));
+#else
+	// Bit-level estimate, good to 4 bits, refined once here and once below.
+	float Estimate = Detail::BitsFloat(0x5F375A86u - (Detail::FloatBits(Value) >> 1));
+	Estimate *= 1.5f - 0.5f * Value * Estimate * Estimate;
+#endif
+
+	// One Newton step.
+	return Estimate * (1.5f - 0.5f * Value * Estimate * Estimate);
+}
+
+inline float Exp(const float Value)
+{
+	// e^x = 2^N * 2^F, with N whole and F in [-0.5, 0.5]. F comes from the remainder after taking N ln 2 off x, which
+	// keeps its precision where multiplying x by log2 e outright would not.
+	const float Clamped = SDL_clamp(Value, Detail::EXP_MIN, Detail::EXP_MAX);
+	const float T = Clamped * Detail::LOG2_E;
+	const Sint32 N = static_cast<Sint32>(T + (T >= 0.f ? 0.5f : -0.5f));
+	const float F = ((Clamped - static_cast<float>(N) * Detail::LN_2_HI) - static_cast<float>(N) * Detail::LN_2_LO) * Detail::LOG2_E;
+	return Detail::Poly(F, Detail::EXP2_COEFFICIENTS) * Detail::BitsFloat(static_cast<Uint32>(N + 127) << 23);
+}
+
+// Natural logarithm.
+inline float Ln(const float Value)
+{
+	// Value = M * 2^E, with M moved into [sqrt(0.5), sqrt(2)) so the series converges quickly.
+	const Uint32 Bits = Detail::FloatBits(Value);
+	Sint32 Exponent = static_cast<Sint32>((Bits >> 23) & 0xFF) - 127;
+	float Mantissa = Detail::BitsFloat((Bits & 0x007FFFFFu) | 0x3F800000u);
+	if (Mantissa > Detail::SQRT_2)
+	{
+		Mantissa *= 0.5f;
+		++Exponent;
+	}
+
+	const float S = (Mantissa - 1.f) / (Mantissa + 1.f);
+	return static_cast<float>(Exponent) * Detail::LN_2 + S * Detail::Poly(S * S, Detail::LN_COEFFICIENTS);
+}
+
+// =============================================
+// BATCHES
+// =============================================
+
+// Each writes one output per input, so the outputs must be at least as long as the inputs.
+
+void Sin(std::span<const float> Radians, std::span<float> Out);
+void Cos(std::span<const float> Radians, std::span<float> Out);
+void SinCos(std::span<const float> Radians, std::span<float> OutSin, std::span<float> OutCos);
+void ATan2(std::span<const float> Y, std::span<const float> X, std::span<float> Out);
+void RSqrt(std::span<const float> Values, std::span<float> Out);
+void Exp(std::span<const float> Values, std::span<float> Out);
+void Ln(std::span<const float> Values, std::span<float> Out);
+
+// =============================================
+// CHECKS
+// =============================================
+
+/**
+ * @brief Measures every function above, scalar and batch, against double precision libm over the domains in the table,
+ * and the batches against the scalar versions. Logs each function's worst errors, as errors where they pass the bound.
+ * Not run on start, launch with "-CheckMath" to run it.
+ * @returns true if every function is within its bound.
+ */
+bool CheckAccuracy();
+}
@@ -0,0 +1,213 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "FastMath.h"
+
+// Libraries
+#include <limits>
+#include <vector>
+#include <SDL3/SDL_error.h>
+
+// Starlight Engine
+#include "Debug/Logging.h"
+#include "Framework/String.h"
+
+namespace
+{
+// Not a multiple of four, so the batches' scalar remainder is measured too.
+constexpr size_t SAMPLE_COUNT = 16387;
+
+// Seed for the random inputs, fixed so every run measures the same values.
+constexpr Uint64 SAMPLE_SEED = 0x5EED5EED;
+
+// Reference magnitudes past which errors are measured relatively, for bounds that are always absolute or always relative.
+constexpr double ABSOLUTE_ERROR = std::numeric_limits<double>::max();
+constexpr double RELATIVE_ERROR = 0.0;
+
+// Evenly spaced values from Min to Max, inclusive.
+std::vector<float> SweepSamples(const float Min, const float Max)
+{
+	std::vector<float> Samples(SAMPLE_COUNT);
+	for (size_t Index = 0; Index < SAMPLE_COUNT; ++Index)
+	{
+		Samples[Index] = Min + (Max - Min) * (static_cast<float>(Index) / static_cast<float>(SAMPLE_COUNT - 1));
+	}
+	return Samples;
+}
+
+// Random values from Min to Max.
+std::vector<float> RandomSamples(const float Min, const float Max, Uint64& State)
+{
+	std::vector<float> Samples(SAMPLE_COUNT);
+	for (float& Sample : Samples)
+	{
+		Sample = Min + (Max - Min) * SDL_randf_r(&State);
+	}
+	return Samples;
+}
+
+// Random positive normal values, spread evenly over the exponents rather than the range.
+std::vector<float> PositiveNormalSamples(Uint64& State)
+{
+	std::vector<float> Samples(SAMPLE_COUNT);
+	for (float& Sample : Samples)
+	{
+		Sample = SDL_powf(2.f, -126.f + 253.f * SDL_randf_r(&State));
+	}
+	return Samples;
+}
+
+/**
+ * @brief Measures a function's scalar and batch outputs against the reference and each other, and logs the result.
+ * @param Domain Where the inputs were taken from, for the log.
+ * @param Bound Worst error allowed, from the table in FastMath.h.
+ * @param RelativeAbove Reference magnitude past which errors are measured relative to it rather than absolutely.
+ * @returns true if both outputs are within Bound of the reference and of each other.
+ */
+bool CheckOutputs(const char* Name, const char* Domain, const std::vector<float>& Scalar, const std::vector<float>& Batch, const std::vector<double>& Reference, const double Bound, const double RelativeAbove)
+{
+	double ScalarError = 0.0;
+	double BatchError = 0.0;
+	double Disagreement = 0.0;
+
+	for (size_t Index = 0; Index < Reference.size(); ++Index)
+	{
+		const double Magnitude = SDL_fabs(Reference[Index]);
+		const double Scale = Magnitude > RelativeAbove ? Magnitude : 1.0;
+
+		ScalarError = SDL_max(ScalarError, SDL_fabs(Scalar[Index] - Reference[Index]) / Scale);
+		BatchError = SDL_max(BatchError, SDL_fabs(Batch[Index] - Reference[Index]) / Scale);
+		Disagreement = SDL_max(Disagreement, SDL_fabs(static_cast<double>(Batch[Index]) - Scalar[Index]) / Scale);
+	}
+
+	const bool bWithinBound = ScalarError <= Bound && BatchError <= Bound && Disagreement <= Bound;
+
+	// FString prints fixed point, which would round errors this small to zero, so they are logged as fractions of the bound.
+	const FString Message = FString(Name) + " over " + Domain + ": worst errors as fractions of the bound, scalar "
+		+ FString(static_cast<float>(ScalarError / Bound)) + ", batch " + FString(static_cast<float>(BatchError / Bound))
+		+ ", batch against scalar " + FString(static_cast<float>(Disagreement / Bound)) + ".";
+	if (bWithinBound)
+	{
+		SL_LOG_FUNC(LogMaths, Debug, Message);
+	}
+	else
+	{
+		SL_LOG_FUNC(LogMaths, Error, Message);
+	}
+
+	return bWithinBound;
+}
+
+// Checks Sin, Cos and both halves of SinCos over Radians.
+bool CheckSinCos(const char* Domain, const std::vector<float>& Radians, const double Bound)
+{
+	const size_t Count = Radians.size();
+	std::vector<float> Scalar(Count);
+	std::vector<float> Batch(Count);
+	std::vector<float> BatchCos(Count);
+	std::vector<double> Reference(Count);
+	bool bPassed = true;
+
+	for (size_t Index = 0; Index < Count; ++Index)
+	{
+		Scalar[Index] = SMath::Fast::Sin(Radians[Index]);
+		Reference[Index] = SDL_sin(Radians[Index]);
+	}
+	SMath::Fast::Sin(Radians, Batch);
+	bPassed &= CheckOutputs("Sin", Domain, Scalar, Batch, Reference, Bound, ABSOLUTE_ERROR);
+
+	SMath::Fast::SinCos(Radians, Batch, BatchCos);
+	bPassed &= CheckOutputs("SinCos sine", Domain, Scalar, Batch, Reference, Bound, ABSOLUTE_ERROR);
+
+	for (size_t Index = 0; Index < Count; ++Index)
+	{
+		Scalar[Index] = SMath::Fast::Cos(Radians[Index]);
+		Reference[Index] = SDL_cos(Radians[Index]);
+	}
+	bPassed &= CheckOutputs("SinCos cosine", Domain, Scalar, BatchCos, Reference, Bound, ABSOLUTE_ERROR);
+
+	SMath::Fast::Cos(Radians, Batch);
+	bPassed &= CheckOutputs("Cos", Domain, Scalar, Batch, Reference, Bound, ABSOLUTE_ERROR);
+
+	return bPassed;
+}
+
+// Checks a one-argument function against its double precision libm counterpart over Values.
+template <typename TScalar, typename TBatch, typename TReference>
+bool CheckUnary(const char* Name, const char* Domain, const std::vector<float>& Values, const double Bound, const double RelativeAbove, TScalar Scalar, TBatch Batch, TReference Reference)
+{
+	const size_t Count = Values.size();
+	std::vector<float> ScalarOut(Count);
+	std::vector<float> BatchOut(Count);
+	std::vector<double> ReferenceOut(Count);
+
+	for (size_t Index = 0; Index < Count; ++Index)
+	{
+		ScalarOut[Index] = Scalar(Values[Index]);
+		ReferenceOut[Index] = Reference(Values[Index]);
+	}
+	Batch(Values, BatchOut);
+
+	return CheckOutputs(Name, Domain, ScalarOut, BatchOut, ReferenceOut, Bound, RelativeAbove);
+}
+}
+
+namespace SMath::Fast
+{
+bool CheckAccuracy()
+{
+	SL_LOG_FUNC_SCOPE(LogMaths, Debug);
+
+	Uint64 State = SAMPLE_SEED;
+	bool bPassed = true;
+
+	bPassed &= CheckSinCos("|Radians| <= 10", SweepSamples(-10.f, 10.f), 2e-7);
+	bPassed &= CheckSinCos("|Radians| <= 100000", RandomSamples(-100000.f, 100000.f, State), 2e-6);
+
+	{
+		const std::vector<float> Y = RandomSamples(-100.f, 100.f, State);
+		std::vector<float> X = RandomSamples(-100.f, 100.f, State);
+
+		// The axes, where the octant selects flip over.
+		X[0] = 0.f;
+		X[1] = Y[1];
+		X[2] = -Y[2];
+
+		std::vector<float> Scalar(SAMPLE_COUNT);
+		std::vector<float> Batch(SAMPLE_COUNT);
+		std::vector<double> Reference(SAMPLE_COUNT);
+		for (size_t Index = 0; Index < SAMPLE_COUNT; ++Index)
+		{
+			Scalar[Index] = ATan2(Y[Index], X[Index]);
+			Reference[Index] = SDL_atan2(Y[Index], X[Index]);
+		}
+		ATan2(Y, X, Batch);
+		bPassed &= CheckOutputs("ATan2", "|Y|, |X| <= 100", Scalar, Batch, Reference, 6e-7, ABSOLUTE_ERROR);
+	}
+
+#if SL_SIMD_SSE2
+	constexpr double RSQRT_BOUND = 3e-7;
+#else
+	constexpr double RSQRT_BOUND = 5e-6;
+#endif
+
+	const std::vector<float> PositiveNormals = PositiveNormalSamples(State);
+	bPassed &= CheckUnary("RSqrt", "positive normals", PositiveNormals, RSQRT_BOUND, RELATIVE_ERROR,
+		[](const float Value) { return RSqrt(Value); },
+		[](const std::span<const float> Values, const std::span<float> Out) { RSqrt(Values, Out); },
+		[](const float Value) { return 1.0 / SDL_sqrt(Value); });
+
+	bPassed &= CheckUnary("Exp", "[-87.3, 88.3]", SweepSamples(Detail::EXP_MIN, Detail::EXP_MAX), 3e-7, RELATIVE_ERROR,
+		[](const float Value) { return Exp(Value); },
+		[](const std::span<const float> Values, const std::span<float> Out) { Exp(Values, Out); },
+		[](const float Value) { return SDL_exp(Value); });
+
+	// Absolute while the result is within [-1, 1], and relative past that.
+	bPassed &= CheckUnary("Ln", "positive normals", PositiveNormals, 2e-7, 1.0,
+		[](const float Value) { return Ln(Value); },
+		[](const std::span<const float> Values, const std::span<float> Out) { Ln(Values, Out); },
+		[](const float Value) { return SDL_log(Value); });
+
+	return bPassed;
+}
+}
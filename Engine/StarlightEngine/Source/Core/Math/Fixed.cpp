@@ -0,0 +1,279 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "Fixed.h"
+
+// Libraries
+#include <array>
+
+namespace
+{
+// Tables and constants are in 2.30 fixed point, precise enough for both FFixed and FFixed64.
+constexpr int TABLE_FRACTION_BITS = 30;
+
+// Pi in 3.61 fixed point, the source of every other pi constant here.
+constexpr Uint64 PI_Q61 = 0x6487ED5110B4611AULL;
+
+constexpr Sint64 PI_Q30 = static_cast<Sint64>((PI_Q61 + (Uint64(1) << 30)) >> 31);
+constexpr Sint64 HALF_PI_Q30 = static_cast<Sint64>((PI_Q61 + (Uint64(1) << 31)) >> 32);
+
+// 1 / (2 pi) in 1.63 fixed point.
+constexpr Sint64 INV_TWO_PI_Q63 = 0x145F306DC9C882A5LL;
+
+constexpr double PI_DOUBLE = 3.14159265358979323846;
+
+// Quarter sine wave, (SINE_STEPS + 1) samples from 0 to pi / 2, plus one so interpolating at pi / 2 stays in bounds.
+constexpr Uint32 SINE_STEPS = 1024;
+
+// The tables are built at compile time from basic double arithmetic, which is exactly rounded on every compiler, so
+// every build gets bit-identical tables.
+constexpr auto SINE_TABLE = []
+{
+	constexpr double Step = PI_DOUBLE / 2.0 / SINE_STEPS;
+
+	// Taylor series, exact to double precision for such a small step.
+	constexpr double SinStep = Step - Step * Step * Step / 6.0 + Step * Step * Step * Step * Step / 120.0;
+	constexpr double CosStep = 1.0 - Step * Step / 2.0 + Step * Step * Step * Step / 24.0 - Step * Step * Step * Step * Step * Step / 720.0;
+
+	std::array<Sint32, SINE_STEPS + 2> Table = {};
+
+	// Chebyshev recurrence: sin((k + 1) h) = 2 cos(h) sin(k h) - sin((k - 1) h).
+	double Previous = 0.0;
+	double Current = SinStep;
+	Table[1] = static_cast<Sint32>(Current * (1 << TABLE_FRACTION_BITS) + 0.5);
+	for (Uint32 Index = 2; Index <= SINE_STEPS; ++Index)
+	{
+		const double Next = 2.0 * CosStep * Current - Previous;
+		Previous = Current;
+		Current = Next;
+		Table[Index] = static_cast<Sint32>(Current * (1 << TABLE_FRACTION_BITS) + 0.5);
+	}
+
+	Table[SINE_STEPS + 1] = Table[SINE_STEPS];
+	return Table;
+}();
+
+static_assert(SINE_TABLE[SINE_STEPS] == 1 << TABLE_FRACTION_BITS, "The sine table must end at exactly 1");
+
+// atan(z) for z from 0 to 1 in ATAN_STEPS steps, plus one so interpolating at 1 stays in bounds.
+constexpr Uint32 ATAN_STEPS = 256;
+
+constexpr double ConstexprSqrt(const double Value)
+{
+	double Root = Value > 1.0 ? Value : 1.0;
+	for (int Iteration = 0; Iteration < 64; ++Iteration)
+	{
+		Root = 0.5 * (Root + Value / Root);
+	}
+	return Root;
+}
+
+constexpr auto ATAN_TABLE = []
+{
+	std::array<Sint32, ATAN_STEPS + 2> Table = {};
+	for (Uint32 Index = 0; Index <= ATAN_STEPS; ++Index)
+	{
+		// atan(z) = 2 atan(z / (1 + sqrt(1 + z^2))), which brings z under 0.42 where the series converges quickly.
+		const double Z = static_cast<double>(Index) / ATAN_STEPS;
+		const double Reduced = Z / (1.0 + ConstexprSqrt(1.0 + Z * Z));
+		const double Reduced2 = Reduced * Reduced;
+
+		double Term = Reduced;
+		double Sum = 0.0;
+		for (int Power = 1; Power < 40; Power += 2)
+		{
+			Sum += Term / Power;
+			Term *= -Reduced2;
+		}
+
+		Table[Index] = static_cast<Sint32>(2.0 * Sum * (1 << TABLE_FRACTION_BITS) + 0.5);
+	}
+
+	Table[ATAN_STEPS + 1] = Table[ATAN_STEPS];
+	return Table;
+}();
+
+// Where Radians falls in a full turn, as a fraction of 2^32.
+template <typename TFixedType>
+Uint32 ToPhase(const TFixedType Radians)
+{
+	// Radians / (2 pi) with 32 bits after the point, taken from a full 128-bit product so precision holds up for large
+	// angles. Only the fraction is wanted, so the whole turns are allowed to overflow away.
+	return static_cast<Uint32>(SMath::Detail::FixedMultiply(static_cast<Sint64>(Radians.Raw), INV_TWO_PI_Q63, 31 + TFixedType::FRACTION_BITS));
+}
+
+// Sine of a phase, in 2.30.
+Sint64 SinPhase(const Uint32 Phase)
+{
+	// Mirror the quarter wave table into the other three quadrants.
+	const Uint32 Quadrant = Phase >> 30;
+	Uint32 Position = Phase & 0x3FFFFFFFu;
+	Position = (Quadrant & 1) != 0 ? 0x40000000u - Position : Position;
+
+	const Uint32 Index = Position >> 20;
+	const Sint64 Fraction = Position & 0xFFFFFu;
+	const Sint64 Value = SINE_TABLE[Index] + (((SINE_TABLE[Index + 1] - static_cast<Sint64>(SINE_TABLE[Index])) * Fraction) >> 20);
+	return Quadrant >= 2 ? -Value : Value;
+}
+
+template <typename TFixedType>
+TFixedType FromTableValue(const Sint64 Value)
+{
+	using TRaw = typename TFixedType::RawType;
+	constexpr int FRACTION_BITS = TFixedType::FRACTION_BITS;
+
+	if constexpr (FRACTION_BITS < TABLE_FRACTION_BITS)
+	{
+		constexpr int SHIFT = TABLE_FRACTION_BITS - FRACTION_BITS;
+		return TFixedType::FromRaw(static_cast<TRaw>((Value + (Sint64(1) << (SHIFT - 1))) >> SHIFT));
+	}
+	else
+	{
+		return TFixedType::FromRaw(static_cast<TRaw>(Value << (FRACTION_BITS - TABLE_FRACTION_BITS)));
+	}
+}
+
+template <typename TFixedType>
+void FixedSinCos(const TFixedType Radians, TFixedType& OutSin, TFixedType& OutCos)
+{
+	const Uint32 Phase = ToPhase(Radians);
+	OutSin = FromTableValue<TFixedType>(SinPhase(Phase));
+
+	// Cosine leads sine by a quarter turn.
+	OutCos = FromTableValue<TFixedType>(SinPhase(Phase + 0x40000000u));
+}
+
+template <typename TFixedType>
+TFixedType FixedATan2(const TFixedType Y, const TFixedType X)
+{
+	Uint64 AbsX = X.Raw < 0 ? 0 - static_cast<Uint64>(X.Raw) : static_cast<Uint64>(X.Raw);
+	Uint64 AbsY = Y.Raw < 0 ? 0 - static_cast<Uint64>(Y.Raw) : static_cast<Uint64>(Y.Raw);
+	if (AbsX == 0 && AbsY == 0)
+	{
+		return TFixedType();
+	}
+
+	// Look up the angle of the first octant, where the ratio of the smaller to the larger component is in [0, 1].
+	const bool bSteep = AbsY > AbsX;
+	Uint64 Numerator = bSteep ? AbsX : AbsY;
+	Uint64 Denominator = bSteep ? AbsY : AbsX;
+	while ((Denominator >> 39) != 0)
+	{
+		// Drop precision the ratio does not need, so shifting the numerator up cannot overflow.
+		Numerator >>= 1;
+		Denominator >>= 1;
+	}
+
+	// 8.24: the table index, then the interpolation fraction.
+	const Uint64 Ratio = (Numerator << 24) / Denominator;
+	const Uint64 Index = Ratio >> 16;
+	const Sint64 Fraction = static_cast<Sint64>(Ratio & 0xFFFFu);
+	Sint64 Angle = ATAN_TABLE[Index] + (((ATAN_TABLE[Index + 1] - static_cast<Sint64>(ATAN_TABLE[Index])) * Fraction) >> 16);
+
+	Angle = bSteep ? HALF_PI_Q30 - Angle : Angle;
+	Angle = X.Raw < 0 ? PI_Q30 - Angle : Angle;
+	return FromTableValue<TFixedType>(Y.Raw < 0 ? -Angle : Angle);
+}
+}
+
+namespace SMath
+{
+Uint32 IntegerSqrt(Uint64 Value)
+{
+	// Digit by digit, two bits of the value per bit of the root.
+	Uint64 Root = 0;
+	Uint64 Bit = Uint64(1) << 62;
+	while (Bit > Value)
+	{
+		Bit >>= 2;
+	}
+
+	while (Bit != 0)
+	{
+		if (Value >= Root + Bit)
+		{
+			Value -= Root + Bit;
+			Root = (Root >> 1) + Bit;
+		}
+		else
+		{
+			Root >>= 1;
+		}
+		Bit >>= 2;
+	}
+
+	return static_cast<Uint32>(Root);
+}
+
+FFixed Sqrt(const FFixed Value)
+{
+	if (Value.Raw <= 0)
+	{
+		return FFixed();
+	}
+
+	// sqrt(Raw * 2^16), the root already in 16.16.
+	return FFixed::FromRaw(static_cast<Sint32>(IntegerSqrt(static_cast<Uint64>(Value.Raw) << 16)));
+}
+
+FFixed64 Sqrt(const FFixed64 Value)
+{
+	if (Value.Raw <= 0)
+	{
+		return FFixed64();
+	}
+
+	// sqrt(Raw) * 2^16 is within 2^16 below the root, so starting just above it Newton's method descends onto the
+	// rounded down root in a step or two.
+	Sint64 Root = (static_cast<Sint64>(IntegerSqrt(static_cast<Uint64>(Value.Raw))) + 1) << 16;
+	for (;;)
+	{
+		const Sint64 Next = (Root + Detail::FixedDivide(Value.Raw, Root, FFixed64::FRACTION_BITS)) / 2;
+		if (Next >= Root)
+		{
+			return FFixed64::FromRaw(Root);
+		}
+		Root = Next;
+	}
+}
+
+FFixed Sin(const FFixed Radians)
+{
+	return FromTableValue<FFixed>(SinPhase(ToPhase(Radians)));
+}
+
+FFixed Cos(const FFixed Radians)
+{
+	return FromTableValue<FFixed>(SinPhase(ToPhase(Radians) + 0x40000000u));
+}
+
+void SinCos(const FFixed Radians, FFixed& OutSin, FFixed& OutCos)
+{
+	FixedSinCos(Radians, OutSin, OutCos);
+}
+
+FFixed ATan2(const FFixed Y, const FFixed X)
+{
+	return FixedATan2(Y, X);
+}
+
+FFixed64 Sin(const FFixed64 Radians)
+{
+	return FromTableValue<FFixed64>(SinPhase(ToPhase(Radians)));
+}
+
+FFixed64 Cos(const FFixed64 Radians)
+{
+	return FromTableValue<FFixed64>(SinPhase(ToPhase(Radians) + 0x40000000u));
+}
+
+void SinCos(const FFixed64 Radians, FFixed64& OutSin, FFixed64& OutCos)
+{
+	FixedSinCos(Radians, OutSin, OutCos);
+}
+
+FFixed64 ATan2(const FFixed64 Y, const FFixed64 X)
+{
+	return FixedATan2(Y, X);
+}
+}
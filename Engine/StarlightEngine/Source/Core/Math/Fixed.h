@@ -0,0 +1,222 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <compare>
+#include <concepts>
+#include <type_traits>
+#include <SDL3/SDL_stdinc.h>
+
+// Starlight Engine
+#include "Math.h"
+#include "Framework/String.h"
+
+namespace SMath::Detail
+{
+// (A * B) >> Shift, rounded to nearest with halves rounding up.
+constexpr Sint32 FixedMultiply(const Sint32 A, const Sint32 B, const int Shift)
+{
+	const Sint64 Product = static_cast<Sint64>(A) * B;
+	return static_cast<Sint32>((Product + (Sint64(1) << (Shift - 1))) >> Shift);
+}
+
+constexpr Sint64 FixedMultiply(const Sint64 A, const Sint64 B, const int Shift)
+{
+	// 128-bit product from 32-bit halves, unsigned first and then corrected for the signs.
+	const Uint64 UA = static_cast<Uint64>(A);
+	const Uint64 UB = static_cast<Uint64>(B);
+	const Uint64 A0 = UA & 0xFFFFFFFFu;
+	const Uint64 A1 = UA >> 32;
+	const Uint64 B0 = UB & 0xFFFFFFFFu;
+	const Uint64 B1 = UB >> 32;
+
+	const Uint64 Low = A0 * B0;
+	const Uint64 Middle = (Low >> 32) + (A0 * B1 & 0xFFFFFFFFu) + (A1 * B0 & 0xFFFFFFFFu);
+	Uint64 ProductLow = (Middle << 32) | (Low & 0xFFFFFFFFu);
+	Uint64 ProductHigh = A1 * B1 + (A0 * B1 >> 32) + (A1 * B0 >> 32) + (Middle >> 32);
+	ProductHigh -= (A < 0 ? UB : 0) + (B < 0 ? UA : 0);
+
+	const Uint64 Half = Uint64(1) << (Shift - 1);
+	ProductLow += Half;
+	ProductHigh += ProductLow < Half ? 1 : 0;
+
+	return static_cast<Sint64>((ProductHigh << (64 - Shift)) | (ProductLow >> Shift));
+}
+
+// (A << Shift) / B, truncated towards zero like integer division. B must not be zero.
+constexpr Sint32 FixedDivide(const Sint32 A, const Sint32 B, const int Shift)
+{
+	return static_cast<Sint32>((static_cast<Sint64>(A) << Shift) / B);
+}
+
+constexpr Sint64 FixedDivide(const Sint64 A, const Sint64 B, const int Shift)
+{
+	// Long division of the 128-bit magnitude, one bit at a time.
+	const Uint64 Dividend = A < 0 ? 0 - static_cast<Uint64>(A) : static_cast<Uint64>(A);
+	const Uint64 Divisor = B < 0 ? 0 - static_cast<Uint64>(B) : static_cast<Uint64>(B);
+	const Uint64 DividendHigh = Dividend >> (64 - Shift);
+	const Uint64 DividendLow = Dividend << Shift;
+
+	Uint64 Quotient = 0;
+	Uint64 Remainder = 0;
+	for (int Bit = 127; Bit >= 0; --Bit)
+	{
+		const Uint64 Next = Bit >= 64 ? DividendHigh >> (Bit - 64) : DividendLow >> Bit;
+		const bool bCarry = (Remainder >> 63) != 0;
+		Remainder = (Remainder << 1) | (Next & 1);
+		Quotient <<= 1;
+		if (bCarry || Remainder >= Divisor)
+		{
+			Remainder -= Divisor;
+			Quotient |= 1;
+		}
+	}
+
+	return (A < 0) != (B < 0) ? static_cast<Sint64>(0 - Quotient) : static_cast<Sint64>(Quotient);
+}
+}
+
+/**
+ * @brief Signed fixed-point number with FractionBits bits after the point, stored as a TRaw integer.
+ * Every operation is integer arithmetic with defined rounding and wrap-around on overflow, so results are bit-exact on
+ * any compiler, optimization level and CPU. Use it where simulations must stay in lockstep, e.g. replays and netcode.
+ * Converting from float is only deterministic for the same float input, so derive constants from integers or fixed
+ * values where it matters.
+ */
+template <typename TRaw, int FractionBits>
+struct TFixed
+{
+	static_assert(std::is_signed_v<TRaw> && FractionBits > 0 && FractionBits < static_cast<int>(sizeof(TRaw) * 8) - 1, "TFixed needs a signed integer with room for the fraction");
+
+	using RawType = TRaw;
+	static constexpr int FRACTION_BITS = FractionBits;
+	static constexpr TRaw ONE = TRaw(1) << FractionBits;
+
+	TRaw Raw = 0;
+
+	// Constructors
+	constexpr TFixed() = default;
+	// Whole numbers convert implicitly. Floats must be converted explicitly, so `FFixed Speed = 2.5f;` does not compile
+	// instead of silently truncating through int.
+	template <std::integral TInt>
+	constexpr TFixed(const TInt Value) : Raw(static_cast<TRaw>(static_cast<std::make_unsigned_t<TRaw>>(Value) << FractionBits)) {}
+	explicit constexpr TFixed(const double Value) : Raw(static_cast<TRaw>(Value * static_cast<double>(ONE) + (Value < 0.0 ? -0.5 : 0.5))) {}
+
+	static constexpr TFixed FromRaw(const TRaw InRaw)
+	{
+		TFixed Result;
+		Result.Raw = InRaw;
+		return Result;
+	}
+
+	// Numerator / Denominator, without going through float.
+	static constexpr TFixed FromRatio(const int Numerator, const int Denominator) { return TFixed(Numerator) / TFixed(Denominator); }
+
+	constexpr float ToFloat() const { return static_cast<float>(static_cast<double>(Raw) / ONE); }
+
+	// Rounds towards negative infinity.
+	constexpr TRaw FloorToInt() const { return Raw >> FractionBits; }
+
+	constexpr TRaw RoundToInt() const { return (Raw + (ONE >> 1)) >> FractionBits; }
+
+	// Operator Overloads for TFixed. Overflow wraps around instead of being undefined.
+	constexpr TFixed operator+(const TFixed Other) const { return FromRaw(static_cast<TRaw>(static_cast<URaw>(Raw) + static_cast<URaw>(Other.Raw))); }
+	constexpr TFixed operator-(const TFixed Other) const { return FromRaw(static_cast<TRaw>(static_cast<URaw>(Raw) - static_cast<URaw>(Other.Raw))); }
+	constexpr TFixed operator-() const { return FromRaw(static_cast<TRaw>(0 - static_cast<URaw>(Raw))); }
+	constexpr TFixed operator*(const TFixed Other) const { return FromRaw(SMath::Detail::FixedMultiply(Raw, Other.Raw, FractionBits)); }
+	constexpr TFixed operator/(const TFixed Other) const { return FromRaw(SMath::Detail::FixedDivide(Raw, Other.Raw, FractionBits)); }
+
+	// Scaling by a whole number is exact, unlike going through a fixed-point multiply. Scaling by a float is deleted rather
+	// than converting it to a whole number, so `FFixed(3) * 0.5f` fails to compile instead of giving 0.
+	template <std::integral TInt>
+	constexpr TFixed operator*(const TInt Scalar) const { return FromRaw(static_cast<TRaw>(static_cast<URaw>(Raw) * static_cast<URaw>(static_cast<TRaw>(Scalar)))); }
+	template <std::integral TInt>
+	constexpr TFixed operator/(const TInt Scalar) const { return FromRaw(Raw / static_cast<TRaw>(Scalar)); }
+	template <std::floating_point TFloat>
+	TFixed operator*(TFloat Scalar) const = delete;
+	template <std::floating_point TFloat>
+	TFixed operator/(TFloat Scalar) const = delete;
+
+	constexpr TFixed& operator+=(const TFixed Other) { return *this = *this + Other; }
+	constexpr TFixed& operator-=(const TFixed Other) { return *this = *this - Other; }
+	constexpr TFixed& operator*=(const TFixed Other) { return *this = *this * Other; }
+	constexpr TFixed& operator/=(const TFixed Other) { return *this = *this / Other; }
+	template <std::integral TInt>
+	constexpr TFixed& operator*=(const TInt Scalar) { return *this = *this * Scalar; }
+	template <std::integral TInt>
+	constexpr TFixed& operator/=(const TInt Scalar) { return *this = *this / Scalar; }
+	template <std::floating_point TFloat>
+	TFixed& operator*=(TFloat Scalar) = delete;
+	template <std::floating_point TFloat>
+	TFixed& operator/=(TFloat Scalar) = delete;
+
+	constexpr bool operator==(const TFixed& Other) const = default;
+	constexpr auto operator<=>(const TFixed& Other) const = default;
+
+	FString ToString() const { return FString(ToFloat()); }
+
+private:
+	using URaw = std::make_unsigned_t<TRaw>;
+};
+
+// 16.16 fixed point. Range of about +-32768 with a resolution of 1.5e-5.
+using FFixed = TFixed<Sint32, 16>;
+
+// 32.32 fixed point, for large worlds or accumulated values. Multiplying and dividing are a few times slower than FFixed.
+using FFixed64 = TFixed<Sint64, 32>;
+
+template <typename TRaw, int FractionBits>
+struct std::hash<TFixed<TRaw, FractionBits>>
+{
+	size_t operator()(const TFixed<TRaw, FractionBits>& Value) const noexcept
+	{
+		return std::hash<TRaw>{}(Value.Raw);
+	}
+};
+
+// =============================================
+// FIXED POINT MATH
+// =============================================
+
+// Overloads of SMath functions for fixed point, so code written against a simulation scalar type (see SimulationMath.h)
+// compiles for both. Trig functions interpolate lookup tables: Sin and Cos are accurate to 1e-5 for FFixed and 3e-7 for
+// FFixed64, ATan2 to 1e-5 for both.
+
+namespace SMath
+{
+template <typename TRaw, int FractionBits>
+constexpr TFixed<TRaw, FractionBits> Abs(const TFixed<TRaw, FractionBits> Value)
+{
+	return Value.Raw < 0 ? -Value : Value;
+}
+
+template <typename TRaw, int FractionBits>
+constexpr TFixed<TRaw, FractionBits> Floor(const TFixed<TRaw, FractionBits> Value)
+{
+	return TFixed<TRaw, FractionBits>::FromRaw(Value.Raw & ~(TFixed<TRaw, FractionBits>::ONE - 1));
+}
+
+template <typename TRaw, int FractionBits>
+constexpr bool NearlyEqual(const TFixed<TRaw, FractionBits> A, const TFixed<TRaw, FractionBits> B, const TFixed<TRaw, FractionBits> Tolerance = TFixed<TRaw, FractionBits>::FromRaw(1))
+{
+	return Abs(A - B) <= Tolerance;
+}
+
+// Square root of an integer, rounded down.
+Uint32 IntegerSqrt(Uint64 Value);
+
+// Rounded down to the nearest representable value. Negative values give zero.
+FFixed Sqrt(FFixed Value);
+FFixed64 Sqrt(FFixed64 Value);
+
+FFixed Sin(FFixed Radians);
+FFixed Cos(FFixed Radians);
+void SinCos(FFixed Radians, FFixed& OutSin, FFixed& OutCos);
+FFixed ATan2(FFixed Y, FFixed X);
+
+FFixed64 Sin(FFixed64 Radians);
+FFixed64 Cos(FFixed64 Radians);
+void SinCos(FFixed64 Radians, FFixed64& OutSin, FFixed64& OutCos);
+FFixed64 ATan2(FFixed64 Y, FFixed64 X);
+}
@@ -0,0 +1,115 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Starlight Engine
+#include "Fixed.h"
+#include "Vector2.h"
+#include "Framework/String.h"
+
+/**
+* @struct FFixedVector2
+* @brief 2D vector of FFixed, the deterministic counterpart of FVector2.
+*/
+struct FFixedVector2
+{
+	FFixed x;
+	FFixed y;
+
+	// Constructors
+	constexpr FFixedVector2() = default;
+	constexpr FFixedVector2(const FFixed _unit) : x(_unit), y(_unit) {}
+	constexpr FFixedVector2(const FFixed _x, const FFixed _y) : x(_x), y(_y) {}
+	explicit constexpr FFixedVector2(const FVector2& Vector) : x(static_cast<double>(Vector.x)), y(static_cast<double>(Vector.y)) {}
+
+	// Operator Overloads for FFixedVector2
+	constexpr FFixedVector2 operator+(const FFixedVector2& Other) const { return FFixedVector2(x + Other.x, y + Other.y); }
+	constexpr FFixedVector2 operator-(const FFixedVector2& Other) const { return FFixedVector2(x - Other.x, y - Other.y); }
+	constexpr FFixedVector2 operator-() const { return FFixedVector2(-x, -y); }
+	constexpr FFixedVector2 operator*(const FFixed Scalar) const { return FFixedVector2(x * Scalar, y * Scalar); }
+	constexpr FFixedVector2 operator/(const FFixed Scalar) const { return FFixedVector2(x / Scalar, y / Scalar); }
+
+	constexpr FFixedVector2& operator+=(const FFixedVector2& Other)
+	{
+		x += Other.x;
+		y += Other.y;
+		return *this;
+	}
+
+	constexpr FFixedVector2& operator-=(const FFixedVector2& Other)
+	{
+		x -= Other.x;
+		y -= Other.y;
+		return *this;
+	}
+
+	constexpr FFixedVector2& operator*=(const FFixed Scalar)
+	{
+		x *= Scalar;
+		y *= Scalar;
+		return *this;
+	}
+
+	constexpr FFixedVector2& operator/=(const FFixed Scalar)
+	{
+		x /= Scalar;
+		y /= Scalar;
+		return *this;
+	}
+
+	// Exact, unlike FVector2's, since there is no rounding error to allow for.
+	constexpr bool operator==(const FFixedVector2& Other) const = default;
+
+	// Overflows past a length of about 181, use Length for longer vectors.
+	constexpr FFixed LengthSquared() const { return x * x + y * y; }
+
+	FFixed Length() const
+	{
+		// Squared in 64-bit integers so long vectors do not overflow. The root of the squared raw values is already in 16.16.
+		const Uint64 SquaredRaw = static_cast<Uint64>(static_cast<Sint64>(x.Raw) * x.Raw) + static_cast<Uint64>(static_cast<Sint64>(y.Raw) * y.Raw);
+		return FFixed::FromRaw(static_cast<Sint32>(SMath::IntegerSqrt(SquaredRaw)));
+	}
+
+	/**
+	* @brief Returns the normalized vector without affecting the value.
+	* @returns The vector normalized, or zero for a zero vector.
+	*/
+	FFixedVector2 Normalized() const
+	{
+		const FFixed Len = Length();
+		if (Len.Raw > 0)
+		{
+			return *this / Len;
+		}
+		return FFixedVector2();
+	}
+
+	constexpr FFixed Dot(const FFixedVector2& Other) const { return x * Other.x + y * Other.y; }
+
+	constexpr FVector2 ToVector2() const { return FVector2(x.ToFloat(), y.ToFloat()); }
+
+	FString ToString() const
+	{
+		return FString("(" +
+			x.ToString() + ", " +
+			y.ToString() + ")");
+	}
+};
+
+// Global scalar multiplication for FFixedVector2 (e.g., Scalar * Vector)
+constexpr FFixedVector2 operator*(const FFixed Scalar, const FFixedVector2& Vector)
+{
+	return FFixedVector2(Vector.x * Scalar, Vector.y * Scalar);
+}
+
+template <>
+struct std::hash<FFixedVector2>
+{
+	size_t operator()(const FFixedVector2& Vector) const noexcept
+	{
+		const size_t h1 = std::hash<Sint32>{}(Vector.x.Raw);
+		const size_t h2 = std::hash<Sint32>{}(Vector.y.Raw);
+
+		return h1 ^ (h2 << 1);
+	}
+};
@@ -4,6 +4,7 @@
 
 // Libraries
 #include <iostream>
+#include <type_traits>
 #include <SDL3/SDL_stdinc.h>
 
 namespace SMath
@@ -14,98 +15,138 @@ constexpr float PI = SDL_PI_F;
 constexpr float TWO_PI = 2.0f * PI;
 constexpr float HALF_PI = 0.5f * PI;
 
+// Functions below that wrap SDL are still constexpr where a plain formula gives the same result, so constants built
+// from them fold at compile time. The SDL version is used whenever they run, since it can use dedicated instructions.
+
 // Absolute Value
-inline float Abs(const float Value)
+constexpr float Abs(const float Value)
 {
+	if (std::is_constant_evaluated())
+	{
+		// Subtracting from zero, so -0 becomes +0 like fabsf.
+		return Value <= 0.f ? 0.f - Value : Value;
+	}
+
 	return SDL_fabsf(Value);
 }
 
 // Check if floats are safely equal
 template <typename T>
-bool NearlyEqual(const T A, const T B, const float Epsilon = EPSILON)
+constexpr bool NearlyEqual(const T A, const T B, const float Epsilon = EPSILON)
 {
 	return Abs(A - B) < Epsilon;
 }
 
-// Round
-inline float Round(const float Value)
+// Truncates the decimal. Basically, rounds towards zero.
+constexpr float Trunc(const float Value)
 {
-	return SDL_roundf(Value);
+	if (std::is_constant_evaluated())
+	{
+		// Floats this large have no decimal to truncate.
+		constexpr float NO_FRACTION = 8388608.f;
+		return Abs(Value) < NO_FRACTION ? static_cast<float>(static_cast<Sint32>(Value)) : Value;
+	}
+
+	return SDL_truncf(Value);
 }
 
-// Truncates the decimal. Basically, rounds towards zero.
-inline float Trunc(const float Value)
+// Round
+constexpr float Round(const float Value)
 {
-	return SDL_truncf(Value);
+	if (std::is_constant_evaluated())
+	{
+		// Halves round away from zero, like roundf.
+		const float Truncated = Trunc(Value);
+		return Abs(Value - Truncated) >= 0.5f ? Truncated + (Value < 0.f ? -1.f : 1.f) : Truncated;
+	}
+
+	return SDL_roundf(Value);
 }
 
-inline float Floor(const float Value)
+constexpr float Floor(const float Value)
 {
+	if (std::is_constant_evaluated())
+	{
+		const float Truncated = Trunc(Value);
+		return Truncated > Value ? Truncated - 1.f : Truncated;
+	}
+
 	return SDL_floorf(Value);
 }
 
-inline float Ceil(const float Value)
+constexpr float Ceil(const float Value)
 {
+	if (std::is_constant_evaluated())
+	{
+		const float Truncated = Trunc(Value);
+		return Truncated < Value ? Truncated + 1.f : Truncated;
+	}
+
 	return SDL_ceilf(Value);
 }
 
-inline float Mod(const float A, const float B)
+constexpr float Mod(const float A, const float B)
 {
+	if (std::is_constant_evaluated())
+	{
+		return A - B * Trunc(A / B);
+	}
+
 	return SDL_fmodf(A, B);
 }
 
 template <typename T = float>
-T Clamp(const T Value, const T Min, const T Max)
+constexpr T Clamp(const T Value, const T Min, const T Max)
 {
 	return SDL_clamp(Value, Min, Max);
 }
 
 template <typename T = float>
-T Min(const T A, const T B)
+constexpr T Min(const T A, const T B)
 {
 	return SDL_min(A, B);
 }
 
 template <typename T = float>
-T Min(const T A, const T B, const T C)
+constexpr T Min(const T A, const T B, const T C)
 {
 	return Min(Min(A, B), C);
 }
 
 template <typename T = float>
-T Max(const T A, const T B)
+constexpr T Max(const T A, const T B)
 {
 	return SDL_max(A, B);
 }
 
 template <typename T = float>
-T Max(const T A, const T B, const T C)
+constexpr T Max(const T A, const T B, const T C)
 {
 	return Max(Max(A, B), C);
 }
 
 // Returns the Value from A to B, depending on Alpha from 0 to 1 respectively.
 template <typename T = float>
-T Lerp(const T A, const T B, const float Alpha)
+constexpr T Lerp(const T A, const T B, const float Alpha)
 {
 	return (B - A) * Alpha + A;
 }
 
 // Gives you the Alpha from 0 to 1, depending on the Value from A to B respectively.
 template <typename T = float>
-float InverseLerp(const T Value, const T A, const T B)
+constexpr float InverseLerp(const T Value, const T A, const T B)
 {
 	if (NearlyEqual(A, B))
 	{
 		return 0.0f;
 	}
 
-	return Value - A / (B - A);
+	return (Value - A) / (B - A);
 }
 
 // Remaps the Value proportionally from the Start range, to the End range.
 template <typename T = float>
-T RemapRange(const T Value, const T StartMin, const T StartMax, const T EndMin, const T EndMax)
+constexpr T RemapRange(const T Value, const T StartMin, const T StartMax, const T EndMin, const T EndMax)
 {
 	if (NearlyEqual(StartMin, StartMax))
 	{
@@ -156,7 +197,7 @@ inline float Log(const float Value, const float Base)
 * @param Degrees Angle in degrees.
 * @return Angle in radians.
 */
-inline float DegreesToRadians(const float Degrees)
+constexpr float DegreesToRadians(const float Degrees)
 {
 	return Degrees * (PI / 180.0f);
 }
@@ -166,7 +207,7 @@ inline float DegreesToRadians(const float Degrees)
 * @param Radians Angle in radians.
 * @return Angle in degrees.
 */
-inline float RadiansToDegrees(const float Radians)
+constexpr float RadiansToDegrees(const float Radians)
 {
 	return Radians * (180.0f / PI);
 }
@@ -0,0 +1,14 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <SDL3/SDL_intrin.h>
+
+// SL_SIMD_SSE2 is 1 where SSE2 is guaranteed at compile time, i.e. every x64 target, so SIMD paths can use it without
+// a runtime check. Code using it must keep a scalar fallback for other targets.
+#if defined(SDL_SSE2_INTRINSICS) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SL_SIMD_SSE2 1
+#else
+#define SL_SIMD_SSE2 0
+#endif
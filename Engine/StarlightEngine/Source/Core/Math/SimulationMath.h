@@ -0,0 +1,58 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Starlight Engine
+#include "Fixed.h"
+#include "FixedVector2.h"
+#include "Vector2.h"
+
+// Set SL_FIXED_POINT_SIMULATION=1 in the project's preprocessor definitions to switch FSimScalar and FSimVector2 to fixed
+// point, so code written against them stays bit-exact across machines for lockstep and replays. Floats are the default
+// since they are faster and simpler.
+// This only selects the type aliases below, for new gameplay code to build on. No engine system uses them yet: physics,
+// particles and the spatial index are all float, so setting it does not make an existing simulation deterministic.
+#ifndef SL_FIXED_POINT_SIMULATION
+#define SL_FIXED_POINT_SIMULATION 0
+#endif
+
+#if SL_FIXED_POINT_SIMULATION
+using FSimScalar = FFixed;
+using FSimVector2 = FFixedVector2;
+#else
+using FSimScalar = float;
+using FSimVector2 = FVector2;
+#endif
+
+namespace SMath
+{
+// Converts a float constant or render value into the simulation type. Results only match across machines if the float does.
+constexpr FSimScalar ToSimScalar(const float Value)
+{
+	return FSimScalar(Value);
+}
+
+constexpr FSimVector2 ToSimVector2(const FVector2& Value)
+{
+	return FSimVector2(Value);
+}
+
+// Converts a simulation value out for rendering, audio and other code that does not need to be deterministic.
+constexpr float ToFloat(const FSimScalar Value)
+{
+#if SL_FIXED_POINT_SIMULATION
+	return Value.ToFloat();
+#else
+	return Value;
+#endif
+}
+
+constexpr FVector2 ToVector2(const FSimVector2& Value)
+{
+#if SL_FIXED_POINT_SIMULATION
+	return Value.ToVector2();
+#else
+	return Value;
+#endif
+}
+}
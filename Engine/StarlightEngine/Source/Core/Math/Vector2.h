@@ -16,50 +16,51 @@ struct FVector2
 	float y;
 
 	// Constructors
-	FVector2() : x(0.0f), y(0.0f) {}
-	FVector2(const float _unit) : x(_unit), y(_unit) {}
-	FVector2(const float _x, const float _y) : x(_x), y(_y) {}
+	constexpr FVector2() : x(0.0f), y(0.0f) {}
+	constexpr FVector2(const float _unit) : x(_unit), y(_unit) {}
+	constexpr FVector2(const float _x, const float _y) : x(_x), y(_y) {}
 
 	// Operator Overloads for FVector2
-	FVector2 operator+(const FVector2& Other) const { return FVector2(x + Other.x, y + Other.y); }
-	FVector2 operator-(const FVector2& Other) const { return FVector2(x - Other.x, y - Other.y); }
-	FVector2 operator*(const float scalar) const { return FVector2(x * scalar, y * scalar); }
-	FVector2 operator/(const float scalar) const { return FVector2(x / scalar, y / scalar); }
+	constexpr FVector2 operator+(const FVector2& Other) const { return FVector2(x + Other.x, y + Other.y); }
+	constexpr FVector2 operator-(const FVector2& Other) const { return FVector2(x - Other.x, y - Other.y); }
+	constexpr FVector2 operator-() const { return FVector2(-x, -y); }
+	constexpr FVector2 operator*(const float scalar) const { return FVector2(x * scalar, y * scalar); }
+	constexpr FVector2 operator/(const float scalar) const { return FVector2(x / scalar, y / scalar); }
 
-	FVector2& operator+=(const FVector2& Other)
+	constexpr FVector2& operator+=(const FVector2& Other)
 	{
 		x += Other.x;
 		y += Other.y;
 		return *this;
 	}
 
-	FVector2& operator-=(const FVector2& Other)
+	constexpr FVector2& operator-=(const FVector2& Other)
 	{
 		x -= Other.x;
 		y -= Other.y;
 		return *this;
 	}
 
-	FVector2& operator*=(const float scalar)
+	constexpr FVector2& operator*=(const float scalar)
 	{
 		x *= scalar;
 		y *= scalar;
 		return *this;
 	}
 
-	FVector2& operator/=(const float scalar)
+	constexpr FVector2& operator/=(const float scalar)
 	{
 		x /= scalar;
 		y /= scalar;
 		return *this;
 	}
 
-	bool operator==(const FVector2& Other) const
+	constexpr bool operator==(const FVector2& Other) const
 	{
 		return SMath::NearlyEqual(x, Other.x) && SMath::NearlyEqual(y, Other.y);
 	}
 
-	bool operator!=(const FVector2& Other) const
+	constexpr bool operator!=(const FVector2& Other) const
 	{
 		return !(*this == Other);
 	}
@@ -69,7 +70,7 @@ struct FVector2
 	* Useful for comparisons as it avoids a sqrt operation.
 	* @return The squared magnitude.
 	*/
-	float LengthSquared() const { return x * x + y * y; }
+	constexpr float LengthSquared() const { return x * x + y * y; }
 
 	/**
 	* @brief Calculates the magnitude (length) of the vector.
@@ -106,7 +107,7 @@ struct FVector2
 	* @param other The other vector.
 	* @return The dot product.
 	*/
-	float Dot(const FVector2& other) const { return x * other.x + y * other.y; }
+	constexpr float Dot(const FVector2& other) const { return x * other.x + y * other.y; }
 
 	FString ToString() const
 	{
@@ -117,7 +118,7 @@ struct FVector2
 };
 
 // Global scalar multiplication for FVector2 (e.g., 5.0f * vec)
-inline FVector2 operator*(const float scalar, const FVector2& vec)
+constexpr FVector2 operator*(const float scalar, const FVector2& vec)
 {
 	return FVector2(vec.x * scalar, vec.y * scalar);
 }
@@ -136,7 +137,7 @@ struct std::hash<FVector2>
 
 namespace SMath
 {
-inline bool NearlyEqual(const FVector2& A, const FVector2& B, const float Epsilon)
+constexpr bool NearlyEqual(const FVector2& A, const FVector2& B, const float Epsilon)
 {
 	return Abs(B.x - A.x) < Epsilon && Abs(B.y - A.y) < Epsilon;
 }
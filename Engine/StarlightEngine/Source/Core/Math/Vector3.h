@@ -17,18 +17,18 @@ struct FVector3
 	float z;
 
 	// Constructors
-	FVector3() : x(0.0f), y(0.0f), z(0.0f) {}
-	FVector3(const float _unit) : x(_unit), y(_unit), z(_unit) {}
-	FVector3(const float _x = 0, const float _y = 0, const float _z = 0) : x(_x), y(_y), z(_z) {}
-	FVector3(const FVector2& Vector2, const float _z = 0) : x(Vector2.x), y(Vector2.y), z(_z) {} // From FVector2 and z
+	constexpr FVector3() : x(0.0f), y(0.0f), z(0.0f) {}
+	constexpr FVector3(const float _unit) : x(_unit), y(_unit), z(_unit) {}
+	constexpr FVector3(const float _x = 0, const float _y = 0, const float _z = 0) : x(_x), y(_y), z(_z) {}
+	constexpr FVector3(const FVector2& Vector2, const float _z = 0) : x(Vector2.x), y(Vector2.y), z(_z) {} // From FVector2 and z
 
 	// Operator Overloads for FVector3
-	FVector3 operator+(const FVector3& other) const { return FVector3(x + other.x, y + other.y, z + other.z); }
-	FVector3 operator-(const FVector3& other) const { return FVector3(x - other.x, y - other.y, z - other.z); }
-	FVector3 operator*(const float scalar) const { return FVector3(x * scalar, y * scalar, z * scalar); }
-	FVector3 operator/(const float scalar) const { return FVector3(x / scalar, y / scalar, z / scalar); }
+	constexpr FVector3 operator+(const FVector3& other) const { return FVector3(x + other.x, y + other.y, z + other.z); }
+	constexpr FVector3 operator-(const FVector3& other) const { return FVector3(x - other.x, y - other.y, z - other.z); }
+	constexpr FVector3 operator*(const float scalar) const { return FVector3(x * scalar, y * scalar, z * scalar); }
+	constexpr FVector3 operator/(const float scalar) const { return FVector3(x / scalar, y / scalar, z / scalar); }
 
-	FVector3& operator+=(const FVector3& other)
+	constexpr FVector3& operator+=(const FVector3& other)
 	{
 		x += other.x;
 		y += other.y;
@@ -36,7 +36,7 @@ struct FVector3
 		return *this;
 	}
 
-	FVector3& operator-=(const FVector3& other)
+	constexpr FVector3& operator-=(const FVector3& other)
 	{
 		x -= other.x;
 		y -= other.y;
@@ -44,7 +44,7 @@ struct FVector3
 		return *this;
 	}
 
-	FVector3& operator*=(const float scalar)
+	constexpr FVector3& operator*=(const float scalar)
 	{
 		x *= scalar;
 		y *= scalar;
@@ -52,7 +52,7 @@ struct FVector3
 		return *this;
 	}
 
-	FVector3& operator/=(const float scalar)
+	constexpr FVector3& operator/=(const float scalar)
 	{
 		x /= scalar;
 		y /= scalar;
@@ -60,12 +60,12 @@ struct FVector3
 		return *this;
 	}
 
-	bool operator==(const FVector3& Other) const
+	constexpr bool operator==(const FVector3& Other) const
 	{
 		return SMath::NearlyEqual(x, Other.x) && SMath::NearlyEqual(y, Other.y) && SMath::NearlyEqual(z, Other.z);
 	}
 
-	bool operator!=(const FVector3& Other) const
+	constexpr bool operator!=(const FVector3& Other) const
 	{
 		return !(*this == Other);
 	}
@@ -75,7 +75,7 @@ struct FVector3
 	* Useful for comparisons as it avoids a sqrt operation.
 	* @return The squared magnitude.
 	*/
-	float LengthSquared() const { return x * x + y * y + z * z; }
+	constexpr float LengthSquared() const { return x * x + y * y + z * z; }
 
 	/**
 	* @brief Calculates the magnitude (length) of the vector.
@@ -112,14 +112,14 @@ struct FVector3
 	* @param other The other vector.
 	* @return The dot product.
 	*/
-	float Dot(const FVector3& other) const { return x * other.x + y * other.y + z * other.z; }
+	constexpr float Dot(const FVector3& other) const { return x * other.x + y * other.y + z * other.z; }
 
 	/**
 	* @brief Calculates the cross product with another vector.
 	* @param other The other vector.
 	* @return A new Vector3 representing the cross product.
 	*/
-	FVector3 Cross(const FVector3& other) const
+	constexpr FVector3 Cross(const FVector3& other) const
 	{
 		return FVector3(
 			y * other.z - z * other.y,
@@ -138,7 +138,7 @@ struct FVector3
 };
 
 // Global scalar multiplication for FVector3 (e.g., 5.0f * vec)
-inline FVector3 operator*(const float scalar, const FVector3& vec)
+constexpr FVector3 operator*(const float scalar, const FVector3& vec)
 {
 	return FVector3(vec.x * scalar, vec.y * scalar, vec.z * scalar);
 }
@@ -158,7 +158,7 @@ struct std::hash<FVector3>
 
 namespace SMath
 {
-inline bool NearlyEqual(const FVector3& A, const FVector3& B, const float Epsilon)
+constexpr bool NearlyEqual(const FVector3& A, const FVector3& B, const float Epsilon)
 {
 	return Abs(B.x - A.x) < Epsilon && Abs(B.y - A.y) < Epsilon && Abs(B.z - A.z) < Epsilon;
 }
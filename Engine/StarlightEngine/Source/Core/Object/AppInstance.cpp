@@ -3,9 +3,41 @@
 // Header
 #include "AppInstance.h"
 
+// Starlight Engine
+#include "Serialization/WorldArchive.h"
+
+SL_IMPLEMENT_CLASS(SAppInstance, SL_PROPERTY(SAppInstance, CurrentWorld))
+
+SAppInstance::SAppInstance(SWeakObjectPtr InOuter, const FString& InName)
+	: SObject(InOuter, InName)
+{
+	//
+}
+
+void SAppInstance::Tick(float DeltaTime)
+{
+	if (CurrentWorld)
+	{
+		CurrentWorld->Tick(DeltaTime);
+	}
+}
+
 void SAppInstance::LoadWorld(const TObjectPtr<SWorld>& NewWorld)
 {
 	CurrentWorld.reset();
 
 	CurrentWorld = NewWorld;
 }
+
+bool SAppInstance::LoadWorldFromFile(const FString& FilePath)
+{
+	// No outer: SObject registers with its outer from inside its constructor, before the world's shared_ptr exists.
+	TObjectPtr<SWorld> NewWorld = NewObject<SWorld>(nullptr);
+	if (FWorldArchive::Load(*NewWorld, FilePath) == false)
+	{
+		return false;
+	}
+
+	LoadWorld(NewWorld);
+	return true;
+}
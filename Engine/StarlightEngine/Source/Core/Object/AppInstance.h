@@ -6,13 +6,23 @@
 #include "Object.h"
 #include "World.h"
 
-class SAppInstance : SObject
+class SAppInstance : public SObject
 {
+	SL_DECLARE_CLASS(SAppInstance, SObject)
+
 public:
+	SAppInstance(SWeakObjectPtr InOuter, const FString& InName = "");
+
 	TWeakObjectPtr<SWorld> GetWorld() { return CurrentWorld; }
 
+	virtual void Tick(float DeltaTime);
+
 	void LoadWorld(const TObjectPtr<SWorld>& NewWorld);
 
+	// Loads a world archive (see FWorldArchive) into a new world and makes it current.
+	/// @returns whether the file was loaded. The current world is kept on failure.
+	bool LoadWorldFromFile(const FString& FilePath);
+
 private:
 	TObjectPtr<SWorld> CurrentWorld;
 };
@@ -0,0 +1,84 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <type_traits>
+#include <SDL3/SDL_stdinc.h>
+
+// Starlight Engine
+#include "Framework/Color.h"
+#include "Math/Box2D.h"
+#include "Math/Vector2.h"
+
+// Stable handle to an entity inside an SWorld. Stays valid while the entity is alive, even if it moves in storage.
+using FEntityId = Uint32;
+
+constexpr FEntityId INVALID_ENTITY_ID = 0xFFFFFFFFu;
+constexpr Uint32 INVALID_ENTITY_INDEX = 0xFFFFFFFFu;
+
+// Position, scale and rotation of an entity in world space.
+struct FTransform2D
+{
+	FVector2 Position = FVector2(0.f);
+	FVector2 Scale = FVector2(1.f);
+
+	// Rotation in degrees.
+	float Rotation = 0.f;
+};
+
+// Visual representation of an entity. An entity with a zero Size is not drawn.
+struct FSpriteComponent
+{
+	// Size in world units before the transform's scale is applied.
+	FVector2 Size = FVector2(0.f);
+
+	// Normalised pivot, (0, 0) is the top left corner and (1, 1) the bottom right.
+	FVector2 Pivot = FVector2(0.5f);
+
+	FRenderColor Tint = FRenderColor();
+
+	// Resource handle of the texture, 0 draws a solid rectangle.
+	Uint32 TextureId = 0;
+
+	// Higher sort orders draw on top.
+	Sint32 SortOrder = 0;
+};
+
+// Location of an entity's name inside the world's name table. Stored as an offset so it survives relocation.
+struct FEntityName
+{
+	Uint32 Offset = 0;
+	Uint32 Length = 0;
+};
+
+// World-space axis-aligned bounds of a sprite, including its pivot, scale and rotation.
+// An entity without a sprite size is treated as a point at its position.
+inline FBox2D GetSpriteBounds(const FTransform2D& Transform, const FSpriteComponent& Sprite)
+{
+	const FVector2 ScaledSize(Sprite.Size.x * Transform.Scale.x, Sprite.Size.y * Transform.Scale.y);
+	const FVector2 Extent(SMath::Abs(ScaledSize.x) * 0.5f, SMath::Abs(ScaledSize.y) * 0.5f);
+
+	// Centre of the sprite relative to the pivot.
+	const FVector2 LocalCentre(ScaledSize.x * (0.5f - Sprite.Pivot.x), ScaledSize.y * (0.5f - Sprite.Pivot.y));
+
+	if (Transform.Rotation == 0.f)
+	{
+		return FBox2D::FromCentreExtent(Transform.Position + LocalCentre, Extent);
+	}
+
+	const float Radians = SMath::DegreesToRadians(Transform.Rotation);
+	const float Sin = SMath::Sin(Radians);
+	const float Cos = SMath::Cos(Radians);
+	const FVector2 RotatedCentre(LocalCentre.x * Cos - LocalCentre.y * Sin, LocalCentre.x * Sin + LocalCentre.y * Cos);
+	const FVector2 RotatedExtent(
+		SMath::Abs(Cos) * Extent.x + SMath::Abs(Sin) * Extent.y,
+		SMath::Abs(Sin) * Extent.x + SMath::Abs(Cos) * Extent.y);
+
+	return FBox2D::FromCentreExtent(Transform.Position + RotatedCentre, RotatedExtent);
+}
+
+// Component data is copied as raw bytes by the world archive.
+static_assert(std::is_trivially_copyable_v<FTransform2D>, "FTransform2D must stay trivially copyable for world serialization");
+static_assert(std::is_trivially_copyable_v<FSpriteComponent>, "FSpriteComponent must stay trivially copyable for world serialization");
+static_assert(std::is_trivially_copyable_v<FEntityName>, "FEntityName must stay trivially copyable for world serialization");
@@ -3,13 +3,23 @@
 // Header
 #include "Object.h"
 
+const FTypeInfo& SObject::StaticTypeInfo()
+{
+	static FTypeInfo TypeInfo("SObject", nullptr, sizeof(SObject), {SL_PROPERTY(SObject, Name), SL_PROPERTY(SObject, Outer)});
+	return TypeInfo;
+}
+
+static const FTypeInfo& GTypeInfo_SObject = SObject::StaticTypeInfo();
+
 SObject::SObject(SWeakObjectPtr InOuter, const FString& InName)
 	: Name(InName)
 	, Outer(InOuter)
 {
+	// NewObject names objects after their class. This only covers direct construction,
+	// where the derived type is not yet known.
 	if (Name.IsEmpty())
 	{
-		Name = typeid(InOuter).name();
+		Name = StaticTypeInfo().GetName();
 	}
 
 	if (SObjectPtr SharedOuter = Outer.lock())
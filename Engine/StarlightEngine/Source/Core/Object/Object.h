@@ -7,6 +7,7 @@
 
 // Starlight Engine
 #include "ObjectPtr.h"
+#include "TypeInfo.h"
 #include "Framework/String.h"
 
 // The base class for all objects in Starlight Engine.
@@ -20,6 +21,13 @@ protected:
 	virtual ~SObject();
 
 public:
+	static const FTypeInfo& StaticTypeInfo();
+	virtual const FTypeInfo& GetTypeInfo() const { return StaticTypeInfo(); }
+
+	// Whether this object is of type T or derives from it. Constant time, no RTTI.
+	template <typename T>
+	bool IsA() const { return GetTypeInfo().IsChildOf(T::StaticTypeInfo()); }
+
 	static bool IsValid(SObject* Object);
 
 	const FString& GetName() const { return Name; }
@@ -41,3 +49,23 @@ private:
 	SWeakObjectPtr Outer;
 	std::vector<SObjectPtr> Inners;
 };
+
+// Casts Object to T if it is a T (or derived from it), otherwise returns nullptr.
+// Uses the registered type ranges instead of dynamic_cast.
+template <typename T>
+T* Cast(SObject* Object)
+{
+	return (Object != nullptr && Object->IsA<T>()) ? static_cast<T*>(Object) : nullptr;
+}
+
+template <typename T>
+const T* Cast(const SObject* Object)
+{
+	return (Object != nullptr && Object->IsA<T>()) ? static_cast<const T*>(Object) : nullptr;
+}
+
+template <typename T>
+TObjectPtr<T> Cast(const SObjectPtr& Object)
+{
+	return (Object != nullptr && Object->IsA<T>()) ? std::static_pointer_cast<T>(Object) : nullptr;
+}
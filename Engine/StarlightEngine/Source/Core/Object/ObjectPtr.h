@@ -7,6 +7,7 @@
 
 // Starlight Engine
 #include "Pointers.h"
+#include "Framework/String.h"
 
 // Forward Declaration
 class SObject;
@@ -29,9 +30,10 @@ using TWeakObjectPtr = TWeakPtr<T>;
 using SObjectPtr = TObjectPtr<SObject>;
 using SWeakObjectPtr = TWeakObjectPtr<SObject>;
 
+// Creates a new object of type T. If no Name is given, the object is named after its class.
 template <typename T>
-static TObjectPtr<T> NewObject(SObjectPtr Outer)
+static TObjectPtr<T> NewObject(SObjectPtr Outer, const FString& Name = "")
 {
 	static_assert(is_sobject_derived<T>::value, "NewObject can only be used with types derived from SObject");
-	return std::make_shared<T>(Outer);
+	return std::make_shared<T>(Outer, Name.IsEmpty() ? FString(T::StaticTypeInfo().GetName()) : Name);
 }
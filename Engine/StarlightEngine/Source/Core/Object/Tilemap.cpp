@@ -0,0 +1,165 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "Tilemap.h"
+
+// Libraries
+#include <atomic>
+
+namespace
+{
+std::atomic<Uint32> NextTilemapId = 1;
+}
+
+FTilemap::FTilemap(const Uint32 InWidth, const Uint32 InHeight, const float InTileSize, const FVector2& InOrigin)
+	: Id(NextTilemapId.fetch_add(1, std::memory_order_relaxed))
+	, Width(InWidth)
+	, Height(InHeight)
+	, TileSize(InTileSize)
+	, Origin(InOrigin)
+	, ChunkCountX((InWidth + CHUNK_SIZE - 1) / CHUNK_SIZE)
+	, ChunkCountY((InHeight + CHUNK_SIZE - 1) / CHUNK_SIZE)
+{
+	const size_t ChunkCount = static_cast<size_t>(ChunkCountX) * ChunkCountY;
+	Tiles.resize(ChunkCount * CHUNK_TILE_COUNT, EMPTY_TILE);
+	ChunkRevisions.resize(ChunkCount, 1);
+	ChunkTileCounts.resize(ChunkCount, 0);
+}
+
+void FTilemap::SetTileset(const FTileset& NewValue)
+{
+	Tileset = NewValue;
+	for (Uint32& Revision : ChunkRevisions)
+	{
+		++Revision;
+	}
+}
+
+// =============================================
+// TILES
+// =============================================
+
+FTileId FTilemap::GetTile(const Uint32 X, const Uint32 Y) const
+{
+	if (X >= Width || Y >= Height)
+	{
+		return EMPTY_TILE;
+	}
+
+	const Uint32 ChunkIndex = GetChunkIndex(X / CHUNK_SIZE, Y / CHUNK_SIZE);
+	return Tiles[ChunkIndex * CHUNK_TILE_COUNT + (Y % CHUNK_SIZE) * CHUNK_SIZE + X % CHUNK_SIZE];
+}
+
+void FTilemap::SetTile(const Uint32 X, const Uint32 Y, const FTileId Tile)
+{
+	if (X < Width && Y < Height && WriteTile(X, Y, Tile))
+	{
+		++ChunkRevisions[GetChunkIndex(X / CHUNK_SIZE, Y / CHUNK_SIZE)];
+	}
+}
+
+void FTilemap::FillTiles(const Uint32 X, const Uint32 Y, const Uint32 FillWidth, const Uint32 FillHeight, const FTileId Tile)
+{
+	if (X >= Width || Y >= Height)
+	{
+		return;
+	}
+
+	const Uint32 EndX = X + SMath::Min(FillWidth, Width - X);
+	const Uint32 EndY = Y + SMath::Min(FillHeight, Height - Y);
+
+	// Walk chunk by chunk, so each touched chunk's revision changes once.
+	for (Uint32 ChunkY = Y / CHUNK_SIZE; ChunkY * CHUNK_SIZE < EndY; ++ChunkY)
+	{
+		for (Uint32 ChunkX = X / CHUNK_SIZE; ChunkX * CHUNK_SIZE < EndX; ++ChunkX)
+		{
+			bool bChanged = false;
+			for (Uint32 TileY = SMath::Max(Y, ChunkY * CHUNK_SIZE); TileY < SMath::Min(EndY, (ChunkY + 1) * CHUNK_SIZE); ++TileY)
+			{
+				for (Uint32 TileX = SMath::Max(X, ChunkX * CHUNK_SIZE); TileX < SMath::Min(EndX, (ChunkX + 1) * CHUNK_SIZE); ++TileX)
+				{
+					bChanged |= WriteTile(TileX, TileY, Tile);
+				}
+			}
+
+			if (bChanged)
+			{
+				++ChunkRevisions[GetChunkIndex(ChunkX, ChunkY)];
+			}
+		}
+	}
+}
+
+bool FTilemap::WorldToTile(const FVector2& WorldPosition, Uint32& OutX, Uint32& OutY) const
+{
+	const FVector2 Local = (WorldPosition - Origin) / TileSize;
+	if (Local.x < 0.f || Local.y < 0.f || Local.x >= static_cast<float>(Width) || Local.y >= static_cast<float>(Height))
+	{
+		return false;
+	}
+
+	OutX = static_cast<Uint32>(Local.x);
+	OutY = static_cast<Uint32>(Local.y);
+	return true;
+}
+
+bool FTilemap::WriteTile(const Uint32 X, const Uint32 Y, const FTileId Tile)
+{
+	const Uint32 ChunkIndex = GetChunkIndex(X / CHUNK_SIZE, Y / CHUNK_SIZE);
+	FTileId& Slot = Tiles[ChunkIndex * CHUNK_TILE_COUNT + (Y % CHUNK_SIZE) * CHUNK_SIZE + X % CHUNK_SIZE];
+	if (Slot == Tile)
+	{
+		return false;
+	}
+
+	if (Slot == EMPTY_TILE)
+	{
+		++ChunkTileCounts[ChunkIndex];
+	}
+	else if (Tile == EMPTY_TILE)
+	{
+		--ChunkTileCounts[ChunkIndex];
+	}
+
+	Slot = Tile;
+	return true;
+}
+
+// =============================================
+// CHUNKS
+// =============================================
+
+Uint32 FTilemap::GetChunkWidth(const Uint32 ChunkX) const
+{
+	return SMath::Min(CHUNK_SIZE, Width - ChunkX * CHUNK_SIZE);
+}
+
+Uint32 FTilemap::GetChunkHeight(const Uint32 ChunkY) const
+{
+	return SMath::Min(CHUNK_SIZE, Height - ChunkY * CHUNK_SIZE);
+}
+
+FBox2D FTilemap::GetChunkBounds(const Uint32 ChunkX, const Uint32 ChunkY) const
+{
+	const FVector2 Min = Origin + FVector2(static_cast<float>(ChunkX * CHUNK_SIZE), static_cast<float>(ChunkY * CHUNK_SIZE)) * TileSize;
+	const FVector2 Size = FVector2(static_cast<float>(GetChunkWidth(ChunkX)), static_cast<float>(GetChunkHeight(ChunkY))) * TileSize;
+	return FBox2D(Min, Min + Size);
+}
+
+bool FTilemap::GetChunkRange(const FBox2D& Box, Uint32& OutMinX, Uint32& OutMinY, Uint32& OutMaxX, Uint32& OutMaxY) const
+{
+	const FBox2D Overlap = Box.Intersection(GetBounds());
+	if (Overlap.IsValid() == false || ChunkCountX == 0 || ChunkCountY == 0)
+	{
+		return false;
+	}
+
+	const float ChunkWorldSize = TileSize * static_cast<float>(CHUNK_SIZE);
+	const FVector2 LocalMin = (Overlap.Min - Origin) / ChunkWorldSize;
+	const FVector2 LocalMax = (Overlap.Max - Origin) / ChunkWorldSize;
+	OutMinX = SMath::Min(static_cast<Uint32>(SMath::Max(LocalMin.x, 0.f)), ChunkCountX - 1);
+	OutMinY = SMath::Min(static_cast<Uint32>(SMath::Max(LocalMin.y, 0.f)), ChunkCountY - 1);
+	OutMaxX = SMath::Min(static_cast<Uint32>(SMath::Max(LocalMax.x, 0.f)), ChunkCountX - 1);
+	OutMaxY = SMath::Min(static_cast<Uint32>(SMath::Max(LocalMax.y, 0.f)), ChunkCountY - 1);
+	return true;
+}
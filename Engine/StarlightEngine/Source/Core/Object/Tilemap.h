@@ -0,0 +1,137 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <vector>
+#include <SDL3/SDL_stdinc.h>
+
+// Starlight Engine
+#include "Framework/Color.h"
+#include "Math/Box2D.h"
+#include "Math/Vector2.h"
+
+// Index of a tile's picture in a tileset. Tile 0 is empty and never drawn.
+using FTileId = Uint16;
+
+constexpr FTileId EMPTY_TILE = 0;
+
+// How tile IDs map to pictures. Tile N is cell N - 1 of the texture, counted left to right and top to bottom.
+struct FTileset
+{
+	// Resource handle of the texture, 0 draws every tile as a solid rectangle of its tint.
+	Uint32 TextureId = 0;
+
+	// Size of one tile's cell in the texture, in pixels. Also the resolution tiles are baked at.
+	Uint32 CellSize = 16;
+	Uint32 Columns = 1;
+
+	// Tint of each tile, indexed by ID - 1. Tiles past the end are white.
+	std::vector<FRenderColor> Tints;
+
+	// Non-zero for tiles that bodies pass through, e.g. decorations, indexed by ID - 1. Tiles past the end are solid.
+	std::vector<Uint8> Passable;
+
+	FRenderColor GetTint(const FTileId Tile) const { return Tile - 1u < Tints.size() ? Tints[Tile - 1u] : FRenderColor(); }
+
+	bool IsSolid(const FTileId Tile) const { return Tile != EMPTY_TILE && (Tile - 1u >= Passable.size() || Passable[Tile - 1u] == 0); }
+};
+
+/**
+ * @brief A grid of tiles, split into square chunks of CHUNK_SIZE tiles.
+ * Tiles are stored chunk by chunk, so everything built from a chunk (its baked image, its collision) reads one
+ * contiguous block. Each chunk carries a revision that changes whenever one of its tiles does, so those caches can tell
+ * when to rebuild without being told.
+ */
+class FTilemap
+{
+public:
+	// Tiles along each side of a chunk.
+	static constexpr Uint32 CHUNK_SIZE = 32;
+	static constexpr Uint32 CHUNK_TILE_COUNT = CHUNK_SIZE * CHUNK_SIZE;
+
+	/**
+	 * @param InTileSize Width and height of a tile in world units.
+	 * @param InOrigin World position of the top left corner of tile (0, 0).
+	 */
+	FTilemap(Uint32 InWidth, Uint32 InHeight, float InTileSize, const FVector2& InOrigin = FVector2(0.f));
+
+	// Unique for the lifetime of the program, unlike the tilemap's address.
+	Uint32 GetId() const { return Id; }
+
+	Uint32 GetWidth() const { return Width; }
+	Uint32 GetHeight() const { return Height; }
+	float GetTileSize() const { return TileSize; }
+
+	const FVector2& GetOrigin() const { return Origin; }
+	void SetOrigin(const FVector2& NewValue) { Origin = NewValue; }
+
+	FBox2D GetBounds() const { return FBox2D(Origin, Origin + FVector2(static_cast<float>(Width), static_cast<float>(Height)) * TileSize); }
+
+	const FTileset& GetTileset() const { return Tileset; }
+
+	// Changes every chunk's revision, since they may all look and collide differently now.
+	void SetTileset(const FTileset& NewValue);
+
+	// =============================================
+	// TILES
+	// =============================================
+
+	// Returns EMPTY_TILE outside the map.
+	FTileId GetTile(Uint32 X, Uint32 Y) const;
+
+	// Ignored outside the map.
+	void SetTile(Uint32 X, Uint32 Y, FTileId Tile);
+
+	// Sets every tile in the rectangle, clipped to the map, changing each touched chunk's revision once.
+	void FillTiles(Uint32 X, Uint32 Y, Uint32 FillWidth, Uint32 FillHeight, FTileId Tile);
+
+	/// @returns whether WorldPosition lies on the map, with the coordinates of the tile under it.
+	bool WorldToTile(const FVector2& WorldPosition, Uint32& OutX, Uint32& OutY) const;
+
+	// =============================================
+	// CHUNKS
+	// =============================================
+
+	Uint32 GetChunkCountX() const { return ChunkCountX; }
+	Uint32 GetChunkCountY() const { return ChunkCountY; }
+	Uint32 GetChunkIndex(const Uint32 ChunkX, const Uint32 ChunkY) const { return ChunkY * ChunkCountX + ChunkX; }
+
+	// Tiles in the chunk along each axis. Chunks on the right and bottom edges may be cut short by the map.
+	Uint32 GetChunkWidth(Uint32 ChunkX) const;
+	Uint32 GetChunkHeight(Uint32 ChunkY) const;
+
+	FBox2D GetChunkBounds(Uint32 ChunkX, Uint32 ChunkY) const;
+
+	/// @returns whether Box overlaps the map, with the inclusive range of chunk coordinates it covers.
+	bool GetChunkRange(const FBox2D& Box, Uint32& OutMinX, Uint32& OutMinY, Uint32& OutMaxX, Uint32& OutMaxY) const;
+
+	// Starts at 1 and changes whenever a tile in the chunk does.
+	Uint32 GetChunkRevision(const Uint32 ChunkIndex) const { return ChunkRevisions[ChunkIndex]; }
+
+	bool IsChunkEmpty(const Uint32 ChunkIndex) const { return ChunkTileCounts[ChunkIndex] == 0; }
+
+	// CHUNK_TILE_COUNT tiles, row by row. Tiles outside a chunk cut short by the map are empty.
+	const FTileId* GetChunkTiles(const Uint32 ChunkIndex) const { return Tiles.data() + ChunkIndex * CHUNK_TILE_COUNT; }
+
+private:
+	// Writes one tile, keeping the chunk's tile count up to date. Revisions are left to the caller.
+	bool WriteTile(Uint32 X, Uint32 Y, FTileId Tile);
+
+	Uint32 Id;
+	Uint32 Width;
+	Uint32 Height;
+	float TileSize;
+	FVector2 Origin;
+
+	FTileset Tileset;
+
+	Uint32 ChunkCountX;
+	Uint32 ChunkCountY;
+
+	std::vector<FTileId> Tiles;
+	std::vector<Uint32> ChunkRevisions;
+
+	// Non-empty tiles per chunk, so empty chunks cost nothing to skip.
+	std::vector<Uint32> ChunkTileCounts;
+};
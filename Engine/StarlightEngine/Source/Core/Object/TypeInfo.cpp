@@ -0,0 +1,118 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "TypeInfo.h"
+
+// Libraries
+#include <cstring>
+#include <unordered_map>
+
+FTypeInfo::FTypeInfo(const char* InName, const FTypeInfo* InParent, const size_t InSize, std::initializer_list<FPropertyInfo> InProperties)
+	: Name(InName)
+	, Parent(InParent)
+	, Size(InSize)
+	, Properties(InProperties)
+{
+	FTypeRegistry::Register(*this);
+}
+
+const FPropertyInfo* FTypeInfo::FindProperty(const char* PropertyName) const
+{
+	for (const FTypeInfo* Type = this; Type != nullptr; Type = Type->Parent)
+	{
+		for (const FPropertyInfo& Property : Type->Properties)
+		{
+			if (strcmp(Property.Name, PropertyName) == 0)
+			{
+				return &Property;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+const FTypeInfo* FTypeRegistry::FindType(const char* TypeName)
+{
+	for (const FTypeInfo* Type : GetTypes())
+	{
+		if (strcmp(Type->Name, TypeName) == 0)
+		{
+			return Type;
+		}
+	}
+
+	return nullptr;
+}
+
+void FTypeRegistry::Register(FTypeInfo& TypeInfo)
+{
+	GetMutableTypes().push_back(&TypeInfo);
+
+	// Types only register once each during startup, so renumbering everything keeps the ranges valid
+	// without needing an explicit "registration finished" step.
+	RebuildTypeIds();
+}
+
+void FTypeRegistry::RebuildTypeIds()
+{
+	const std::vector<FTypeInfo*>& Types = GetMutableTypes();
+
+	std::unordered_map<const FTypeInfo*, std::vector<FTypeInfo*>> Children;
+	std::vector<FTypeInfo*> Roots;
+	for (FTypeInfo* Type : Types)
+	{
+		if (Type->Parent == nullptr)
+		{
+			Roots.push_back(Type);
+		}
+		else
+		{
+			Children[Type->Parent].push_back(Type);
+		}
+	}
+
+	// Iterative pre-order walk, assigning each type its ID and the last ID in its subtree.
+	Uint32 NextTypeId = 0;
+	struct FStackEntry
+	{
+		FTypeInfo* Type;
+		bool bVisited;
+	};
+	std::vector<FStackEntry> Stack;
+	for (auto Root = Roots.rbegin(); Root != Roots.rend(); ++Root)
+	{
+		Stack.push_back({*Root, false});
+	}
+
+	while (Stack.empty() == false)
+	{
+		FStackEntry& Entry = Stack.back();
+		FTypeInfo* Type = Entry.Type;
+
+		if (Entry.bVisited)
+		{
+			Type->LastDescendantId = NextTypeId - 1;
+			Stack.pop_back();
+			continue;
+		}
+
+		Entry.bVisited = true;
+		Type->TypeId = NextTypeId++;
+
+		const auto FoundChildren = Children.find(Type);
+		if (FoundChildren != Children.end())
+		{
+			for (auto Child = FoundChildren->second.rbegin(); Child != FoundChildren->second.rend(); ++Child)
+			{
+				Stack.push_back({*Child, false});
+			}
+		}
+	}
+}
+
+std::vector<FTypeInfo*>& FTypeRegistry::GetMutableTypes()
+{
+	static std::vector<FTypeInfo*> Types;
+	return Types;
+}
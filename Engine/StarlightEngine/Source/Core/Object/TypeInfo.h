@@ -0,0 +1,160 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+#include <SDL3/SDL_stdinc.h>
+
+// Starlight Engine
+#include "ObjectPtr.h"
+
+// Forward Declarations
+struct FString;
+struct FVector2;
+struct FVector3;
+struct FRenderColor;
+
+// The kind of value a reflected property holds.
+enum class EPropertyType : Uint8
+{
+	Unknown = 0,
+	Bool,
+	Int32,
+	Uint32,
+	Float,
+	String,
+	Vector2,
+	Vector3,
+	RenderColor,
+	ObjectPtr,
+	WeakObjectPtr,
+};
+
+// Maps a C++ member type to its EPropertyType.
+template <typename T>
+struct TPropertyType
+{
+	static constexpr EPropertyType Value = EPropertyType::Unknown;
+};
+
+template <> struct TPropertyType<bool> { static constexpr EPropertyType Value = EPropertyType::Bool; };
+template <> struct TPropertyType<Sint32> { static constexpr EPropertyType Value = EPropertyType::Int32; };
+template <> struct TPropertyType<Uint32> { static constexpr EPropertyType Value = EPropertyType::Uint32; };
+template <> struct TPropertyType<float> { static constexpr EPropertyType Value = EPropertyType::Float; };
+template <> struct TPropertyType<FString> { static constexpr EPropertyType Value = EPropertyType::String; };
+template <> struct TPropertyType<FVector2> { static constexpr EPropertyType Value = EPropertyType::Vector2; };
+template <> struct TPropertyType<FVector3> { static constexpr EPropertyType Value = EPropertyType::Vector3; };
+template <> struct TPropertyType<FRenderColor> { static constexpr EPropertyType Value = EPropertyType::RenderColor; };
+template <typename T> struct TPropertyType<TObjectPtr<T>> { static constexpr EPropertyType Value = EPropertyType::ObjectPtr; };
+template <typename T> struct TPropertyType<TWeakObjectPtr<T>> { static constexpr EPropertyType Value = EPropertyType::WeakObjectPtr; };
+
+// A single reflected member variable, addressed by its byte offset from the start of the object.
+struct FPropertyInfo
+{
+	const char* Name;
+	size_t Offset;
+	size_t Size;
+	EPropertyType Type;
+
+	FPropertyInfo(const char* InName, const size_t InOffset, const size_t InSize, const EPropertyType InType)
+		: Name(InName), Offset(InOffset), Size(InSize), Type(InType) {}
+
+	// Returns the address of this property inside Object. T must match the declared member type.
+	template <typename T>
+	T* GetValuePtr(void* Object) const { return reinterpret_cast<T*>(static_cast<Uint8*>(Object) + Offset); }
+
+	template <typename T>
+	const T* GetValuePtr(const void* Object) const { return reinterpret_cast<const T*>(static_cast<const Uint8*>(Object) + Offset); }
+};
+
+/**
+ * @brief Static type description of an SObject class.
+ * One instance exists per class (see SL_DECLARE_CLASS / SL_IMPLEMENT_CLASS) and registers itself on construction.
+ * Types are numbered in depth-first order, so every subtree of the hierarchy is a contiguous ID range,
+ * which makes IsChildOf a constant time range check instead of a parent chain walk.
+ */
+struct FTypeInfo
+{
+	FTypeInfo(const char* InName, const FTypeInfo* InParent, size_t InSize, std::initializer_list<FPropertyInfo> InProperties);
+
+	FTypeInfo(const FTypeInfo&) = delete;
+	FTypeInfo& operator=(const FTypeInfo&) = delete;
+
+	const char* GetName() const { return Name; }
+	const FTypeInfo* GetParent() const { return Parent; }
+	size_t GetSize() const { return Size; }
+
+	// Properties declared directly on this type (not including parents).
+	const std::vector<FPropertyInfo>& GetProperties() const { return Properties; }
+
+	// Finds a property on this type or any of its parents. Returns nullptr if not found.
+	const FPropertyInfo* FindProperty(const char* PropertyName) const;
+
+	// Whether this type is Other or derives from it.
+	bool IsChildOf(const FTypeInfo& Other) const
+	{
+		// Unsigned wrap-around folds both range bounds into a single comparison.
+		return TypeId - Other.TypeId <= Other.LastDescendantId - Other.TypeId;
+	}
+
+	template <typename T>
+	bool IsChildOf() const { return IsChildOf(T::StaticTypeInfo()); }
+
+	// Depth-first index of this type. Only stable for the lifetime of the process.
+	Uint32 GetTypeId() const { return TypeId; }
+
+private:
+	friend class FTypeRegistry;
+
+	const char* Name;
+	const FTypeInfo* Parent;
+	size_t Size;
+	std::vector<FPropertyInfo> Properties;
+
+	Uint32 TypeId = 0;
+	Uint32 LastDescendantId = 0;
+};
+
+// Global list of every registered FTypeInfo.
+class FTypeRegistry
+{
+public:
+	static const std::vector<FTypeInfo*>& GetTypes() { return GetMutableTypes(); }
+
+	// Returns the registered type with the given class name, or nullptr.
+	static const FTypeInfo* FindType(const char* TypeName);
+
+private:
+	friend struct FTypeInfo;
+
+	static void Register(FTypeInfo& TypeInfo);
+	static void RebuildTypeIds();
+
+	// Function-local so registration is safe during static initialisation.
+	static std::vector<FTypeInfo*>& GetMutableTypes();
+};
+
+// Declares the reflection boilerplate for an SObject-derived class. Place at the top of the class body.
+#define SL_DECLARE_CLASS(ClassName, SuperClassName) \
+public: \
+	using Super = SuperClassName; \
+	static const FTypeInfo& StaticTypeInfo(); \
+	const FTypeInfo& GetTypeInfo() const override { return StaticTypeInfo(); } \
+private:
+
+// Defines and registers the FTypeInfo for a class declared with SL_DECLARE_CLASS. Place in the class' .cpp.
+// Any extra arguments are SL_PROPERTY entries.
+#define SL_IMPLEMENT_CLASS(ClassName, ...) \
+	const FTypeInfo& ClassName::StaticTypeInfo() \
+	{ \
+		static FTypeInfo TypeInfo(#ClassName, &Super::StaticTypeInfo(), sizeof(ClassName), {__VA_ARGS__}); \
+		return TypeInfo; \
+	} \
+	static const FTypeInfo& GTypeInfo_##ClassName = ClassName::StaticTypeInfo();
+
+// Describes a member variable for SL_IMPLEMENT_CLASS.
+#define SL_PROPERTY(ClassName, PropertyName) \
+	FPropertyInfo(#PropertyName, offsetof(ClassName, PropertyName), sizeof(ClassName::PropertyName), TPropertyType<decltype(ClassName::PropertyName)>::Value)
@@ -2,3 +2,11 @@
 
 // Header
 #include "UserController.h"
+
+SL_IMPLEMENT_CLASS(SUserController)
+
+SUserController::SUserController(SWeakObjectPtr InOuter, const FString& InName)
+	: SObject(InOuter, InName)
+{
+	//
+}
@@ -7,4 +7,8 @@
 
 class SUserController : public SObject
 {
+	SL_DECLARE_CLASS(SUserController, SObject)
+
+public:
+	SUserController(SWeakObjectPtr InOuter, const FString& InName = "");
 };
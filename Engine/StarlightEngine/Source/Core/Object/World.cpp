@@ -2,3 +2,401 @@
 
 // Header
 #include "World.h"
+
+// Libraries
+#include <algorithm>
+
+// Starlight Engine
+#include "Tilemap.h"
+#include "WorldPartition.h"
+#include "Particles/ParticleEmitter.h"
+#include "Physics/PhysicsScene.h"
+#include "Physics/TilemapCollision.h"
+#include "Spatial/LooseQuadtree.h"
+#include "Spatial/SpatialHash.h"
+
+SL_IMPLEMENT_CLASS(SWorld)
+
+SWorld::SWorld(SWeakObjectPtr InOuter, const FString& InName)
+	: SObject(InOuter, InName)
+	, SpatialIndex(new FSpatialHash())
+{
+	// Offset 0 is always the empty name.
+	NameTable.push_back('\0');
+}
+
+SWorld::~SWorld()
+{
+	// Partition holds a reference to this world, so it must go first.
+	Partition.reset();
+}
+
+void SWorld::Tick(float DeltaTime)
+{
+	if (Partition)
+	{
+		Partition->Update(StreamingOrigin);
+	}
+
+	UpdateTilemapCollision();
+
+	if (Physics)
+	{
+		Physics->Advance(DeltaTime);
+		Physics->WriteTransforms(*this);
+	}
+
+	for (const TUniquePtr<FParticleEmitter>& Emitter : ParticleEmitters)
+	{
+		Emitter->Update(DeltaTime);
+	}
+
+	UpdateSpatialIndex();
+}
+
+FEntityId SWorld::CreateEntity(const FString& EntityName, const FTransform2D& Transform)
+{
+	const FEntityId EntityId = AllocateEntityId();
+	EntityIndices[EntityId] = static_cast<Uint32>(EntityIds.size());
+
+	FEntityName Name;
+	if (EntityName.IsEmpty() == false)
+	{
+		Name.Offset = static_cast<Uint32>(NameTable.size());
+		Name.Length = static_cast<Uint32>(EntityName.GetLength());
+		NameTable.insert(NameTable.end(), EntityName.CStr(), EntityName.CStr() + EntityName.GetLength() + 1);
+	}
+
+	EntityIds.push_back(EntityId);
+	Transforms.push_back(Transform);
+	Sprites.emplace_back();
+	Names.push_back(Name);
+
+	return EntityId;
+}
+
+bool SWorld::DestroyEntity(const FEntityId EntityId)
+{
+	const Uint32 Index = GetEntityIndex(EntityId);
+	if (Index == INVALID_ENTITY_INDEX)
+	{
+		return false;
+	}
+
+	// The name bytes stay in the table until enough of it is dead to be worth compacting.
+	if (Names[Index].Length > 0)
+	{
+		DeadNameBytes += Names[Index].Length + 1;
+	}
+
+	// Swap the last entity into the hole so the arrays stay dense.
+	const Uint32 LastIndex = static_cast<Uint32>(EntityIds.size()) - 1;
+	if (Index != LastIndex)
+	{
+		const FEntityId MovedEntityId = EntityIds[LastIndex];
+		EntityIds[Index] = MovedEntityId;
+		Transforms[Index] = Transforms[LastIndex];
+		Sprites[Index] = Sprites[LastIndex];
+		Names[Index] = Names[LastIndex];
+		EntityIndices[MovedEntityId] = Index;
+	}
+
+	EntityIds.pop_back();
+	Transforms.pop_back();
+	Sprites.pop_back();
+	Names.pop_back();
+
+	EntityIndices[EntityId] = INVALID_ENTITY_INDEX;
+	FreeEntityIds.push_back(EntityId);
+	SpatialIndex->Remove(EntityId);
+	if (EntityId < IndexedBounds.size())
+	{
+		IndexedBounds[EntityId] = UNINDEXED_BOUNDS;
+	}
+
+	// Compacting only once half the table is dead keeps destruction amortised O(1), however many cells stream in and out.
+	if (DeadNameBytes > MIN_NAME_COMPACT_BYTES && DeadNameBytes * 2 > NameTable.size())
+	{
+		CompactNameTable();
+	}
+	return true;
+}
+
+void SWorld::DestroyAllEntities()
+{
+	EntityIds.clear();
+	EntityIndices.clear();
+	FreeEntityIds.clear();
+	Transforms.clear();
+	Sprites.clear();
+	Names.clear();
+
+	NameTable.clear();
+	NameTable.push_back('\0');
+	DeadNameBytes = 0;
+
+	SpatialIndex->Clear();
+	IndexedBounds.clear();
+}
+
+bool SWorld::IsEntityValid(const FEntityId EntityId) const
+{
+	return GetEntityIndex(EntityId) != INVALID_ENTITY_INDEX;
+}
+
+Uint32 SWorld::GetEntityIndex(const FEntityId EntityId) const
+{
+	if (EntityId >= EntityIndices.size())
+	{
+		return INVALID_ENTITY_INDEX;
+	}
+
+	return EntityIndices[EntityId];
+}
+
+FTransform2D* SWorld::GetTransform(const FEntityId EntityId)
+{
+	const Uint32 Index = GetEntityIndex(EntityId);
+	return Index != INVALID_ENTITY_INDEX ? &Transforms[Index] : nullptr;
+}
+
+FSpriteComponent* SWorld::GetSprite(const FEntityId EntityId)
+{
+	const Uint32 Index = GetEntityIndex(EntityId);
+	return Index != INVALID_ENTITY_INDEX ? &Sprites[Index] : nullptr;
+}
+
+const char* SWorld::GetEntityName(const FEntityId EntityId) const
+{
+	const Uint32 Index = GetEntityIndex(EntityId);
+	if (Index == INVALID_ENTITY_INDEX)
+	{
+		return NameTable.data();
+	}
+
+	return NameTable.data() + Names[Index].Offset;
+}
+
+void SWorld::AppendEntities(const FTransform2D* InTransforms, const FSpriteComponent* InSprites, const FEntityName* InNames, const char* InNameTable, const Uint32 Count, FEntityId* OutEntityIds)
+{
+	const size_t NewSize = EntityIds.size() + Count;
+	EntityIds.reserve(NewSize);
+	Transforms.reserve(NewSize);
+	Sprites.reserve(NewSize);
+	Names.reserve(NewSize);
+
+	Transforms.insert(Transforms.end(), InTransforms, InTransforms + Count);
+	Sprites.insert(Sprites.end(), InSprites, InSprites + Count);
+
+	for (Uint32 Index = 0; Index < Count; ++Index)
+	{
+		const FEntityId EntityId = AllocateEntityId();
+		EntityIndices[EntityId] = static_cast<Uint32>(EntityIds.size());
+		EntityIds.push_back(EntityId);
+		OutEntityIds[Index] = EntityId;
+
+		FEntityName Name;
+		if (InNames[Index].Length > 0)
+		{
+			const char* NameData = InNameTable + InNames[Index].Offset;
+			Name.Offset = static_cast<Uint32>(NameTable.size());
+			Name.Length = InNames[Index].Length;
+			NameTable.insert(NameTable.end(), NameData, NameData + Name.Length + 1);
+		}
+		Names.push_back(Name);
+	}
+}
+
+void SWorld::EnablePartition(const FWorldPartitionSettings& Settings)
+{
+	Partition.reset();
+	Partition = TUniquePtr<FWorldPartition>(new FWorldPartition(*this, Settings));
+}
+
+void SWorld::DisablePartition()
+{
+	Partition.reset();
+}
+
+void SWorld::EnablePhysics(const FPhysicsSettings& Settings)
+{
+	Physics = TUniquePtr<FPhysicsScene>(new FPhysicsScene(Settings));
+
+	// The old scene took the tile bodies with it. The next update adds them to the new one.
+	for (const TUniquePtr<FTilemapCollision>& Collision : TilemapCollisions)
+	{
+		Collision->ForgetBodies();
+	}
+}
+
+void SWorld::DisablePhysics()
+{
+	Physics.reset();
+
+	for (const TUniquePtr<FTilemapCollision>& Collision : TilemapCollisions)
+	{
+		Collision->ForgetBodies();
+	}
+}
+
+FTilemap& SWorld::AddTilemap(const Uint32 Width, const Uint32 Height, const float TileSize, const FVector2& Origin)
+{
+	Tilemaps.emplace_back(new FTilemap(Width, Height, TileSize, Origin));
+	TilemapCollisions.emplace_back(new FTilemapCollision(*Tilemaps.back()));
+	return *Tilemaps.back();
+}
+
+bool SWorld::RemoveTilemap(const FTilemap* Tilemap)
+{
+	const auto Found = std::find_if(Tilemaps.begin(), Tilemaps.end(), [Tilemap](const TUniquePtr<FTilemap>& Other) { return Other.get() == Tilemap; });
+	if (Found == Tilemaps.end())
+	{
+		return false;
+	}
+
+	const size_t Index = Found - Tilemaps.begin();
+	if (Physics)
+	{
+		TilemapCollisions[Index]->DestroyBodies(*Physics);
+	}
+
+	TilemapCollisions.erase(TilemapCollisions.begin() + Index);
+	Tilemaps.erase(Found);
+	return true;
+}
+
+void SWorld::UpdateTilemapCollision()
+{
+	for (const TUniquePtr<FTilemapCollision>& Collision : TilemapCollisions)
+	{
+		Collision->Update(Physics.get());
+	}
+}
+
+Uint32 SWorld::QueryTiles(const FBox2D& Box, FBox2D* OutRects, const Uint32 MaxResults) const
+{
+	Uint32 ResultCount = 0;
+	for (const TUniquePtr<FTilemapCollision>& Collision : TilemapCollisions)
+	{
+		ResultCount += Collision->QueryBox(Box, OutRects + ResultCount, MaxResults - ResultCount);
+	}
+
+	return ResultCount;
+}
+
+bool SWorld::RaycastTiles(const FVector2& Origin, const FVector2& Direction, const float MaxDistance, float& OutDistance) const
+{
+	// Each hit shortens the segment tested against the tilemaps after it.
+	float NearestDistance = MaxDistance;
+	bool bHit = false;
+	for (const TUniquePtr<FTilemapCollision>& Collision : TilemapCollisions)
+	{
+		bHit |= Collision->Raycast(Origin, Direction, NearestDistance, NearestDistance);
+	}
+
+	if (bHit)
+	{
+		OutDistance = NearestDistance;
+	}
+	return bHit;
+}
+
+FParticleEmitter& SWorld::AddParticleEmitter(const FParticleEmitterSettings& Settings, const FVector2& Position)
+{
+	// Each emitter gets its own random sequence, the same every run.
+	ParticleEmitters.emplace_back(new FParticleEmitter(Settings, Position, NextParticleSeed++));
+	return *ParticleEmitters.back();
+}
+
+bool SWorld::RemoveParticleEmitter(const FParticleEmitter* Emitter)
+{
+	const auto Found = std::find_if(ParticleEmitters.begin(), ParticleEmitters.end(), [Emitter](const TUniquePtr<FParticleEmitter>& Other) { return Other.get() == Emitter; });
+	if (Found == ParticleEmitters.end())
+	{
+		return false;
+	}
+
+	ParticleEmitters.erase(Found);
+	return true;
+}
+
+void SWorld::UseSpatialHash(const float CellSize)
+{
+	SpatialIndex = TUniquePtr<ISpatialIndex>(new FSpatialHash(CellSize));
+	UpdateSpatialIndex();
+}
+
+void SWorld::UseLooseQuadtree(const FBox2D& WorldBounds, const Uint32 MaxDepth)
+{
+	SpatialIndex = TUniquePtr<ISpatialIndex>(new FLooseQuadtree(WorldBounds, MaxDepth));
+	UpdateSpatialIndex();
+}
+
+void SWorld::UpdateSpatialIndex()
+{
+	IndexedBounds.resize(EntityIndices.size(), UNINDEXED_BOUNDS);
+
+	for (size_t Index = 0; Index < EntityIds.size(); ++Index)
+	{
+		const FEntityId EntityId = EntityIds[Index];
+		const FBox2D Bounds = GetSpriteBounds(Transforms[Index], Sprites[Index]);
+
+		// Exact comparison, so even the smallest move reaches the index.
+		FBox2D& Indexed = IndexedBounds[EntityId];
+		if (Bounds.Min.x == Indexed.Min.x && Bounds.Min.y == Indexed.Min.y && Bounds.Max.x == Indexed.Max.x && Bounds.Max.y == Indexed.Max.y)
+		{
+			continue;
+		}
+
+		SpatialIndex->Update(EntityId, Bounds);
+		Indexed = Bounds;
+	}
+}
+
+Uint32 SWorld::QueryBox(const FBox2D& Box, FEntityId* OutEntityIds, const Uint32 MaxResults) const
+{
+	return SpatialIndex->QueryBox(Box, OutEntityIds, MaxResults);
+}
+
+Uint32 SWorld::QueryRadius(const FVector2& Centre, const float Radius, FEntityId* OutEntityIds, const Uint32 MaxResults) const
+{
+	return SpatialIndex->QueryRadius(Centre, Radius, OutEntityIds, MaxResults);
+}
+
+Uint32 SWorld::Raycast(const FVector2& Origin, const FVector2& Direction, const float MaxDistance, FSpatialRayHit* OutHits, const Uint32 MaxHits) const
+{
+	return SpatialIndex->Raycast(Origin, Direction, MaxDistance, OutHits, MaxHits);
+}
+
+void SWorld::CompactNameTable()
+{
+	std::vector<char> CompactTable;
+	CompactTable.reserve(NameTable.size() - DeadNameBytes);
+	CompactTable.push_back('\0');
+
+	for (FEntityName& Name : Names)
+	{
+		if (Name.Length > 0)
+		{
+			const char* NameData = NameTable.data() + Name.Offset;
+			Name.Offset = static_cast<Uint32>(CompactTable.size());
+			CompactTable.insert(CompactTable.end(), NameData, NameData + Name.Length + 1);
+		}
+	}
+
+	NameTable = std::move(CompactTable);
+	DeadNameBytes = 0;
+}
+
+FEntityId SWorld::AllocateEntityId()
+{
+	if (FreeEntityIds.empty() == false)
+	{
+		const FEntityId EntityId = FreeEntityIds.back();
+		FreeEntityIds.pop_back();
+		return EntityId;
+	}
+
+	EntityIndices.push_back(INVALID_ENTITY_INDEX);
+	return static_cast<FEntityId>(EntityIndices.size() - 1);
+}
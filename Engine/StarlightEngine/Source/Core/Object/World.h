@@ -2,9 +2,216 @@
 
 #pragma once
 
+// Libraries
+#include <vector>
+
 // Starlight Engine
+#include "Entity.h"
 #include "Object.h"
 
-class SWorld : SObject
+// Forward Declarations
+class FWorldArchive;
+class ISpatialIndex;
+struct FSpatialRayHit;
+class FWorldPartition;
+struct FWorldPartitionSettings;
+class FPhysicsScene;
+struct FPhysicsSettings;
+class FTilemap;
+class FTilemapCollision;
+class FParticleEmitter;
+struct FParticleEmitterSettings;
+
+// Holds every entity in a level.
+// Components are kept in dense, parallel arrays (one element per live entity) so systems can iterate them linearly,
+// and so the world archive can copy them in and out as whole blocks.
+class SWorld : public SObject
 {
+	SL_DECLARE_CLASS(SWorld, SObject)
+
+	friend FWorldArchive;
+	friend FWorldPartition;
+
+public:
+	SWorld(SWeakObjectPtr InOuter, const FString& InName = "");
+	~SWorld() override;
+
+	virtual void Tick(float DeltaTime);
+
+	// =============================================
+	// ENTITIES
+	// =============================================
+
+	FEntityId CreateEntity(const FString& EntityName = "", const FTransform2D& Transform = FTransform2D());
+
+	/// @returns whether the entity existed and was destroyed.
+	bool DestroyEntity(FEntityId EntityId);
+
+	void DestroyAllEntities();
+
+	bool IsEntityValid(FEntityId EntityId) const;
+
+	Uint32 GetEntityCount() const { return static_cast<Uint32>(EntityIds.size()); }
+
+	// Index of the entity inside the dense component arrays, or INVALID_ENTITY_INDEX.
+	// Only valid until the next entity is destroyed.
+	Uint32 GetEntityIndex(FEntityId EntityId) const;
+
+	// Returns nullptr if the entity is invalid.
+	FTransform2D* GetTransform(FEntityId EntityId);
+	FSpriteComponent* GetSprite(FEntityId EntityId);
+
+	// Returns an empty string if the entity is invalid or unnamed. Only valid until the next entity is created or destroyed.
+	const char* GetEntityName(FEntityId EntityId) const;
+
+	/**
+	 * @brief Adds Count entities in one go, copying their components from the given arrays.
+	 * @param InNames Name offsets into InNameTable. Names are copied into this world's own table.
+	 * @param OutEntityIds Receives the new entity IDs, must have room for Count entries.
+	 */
+	void AppendEntities(const FTransform2D* InTransforms, const FSpriteComponent* InSprites, const FEntityName* InNames, const char* InNameTable, Uint32 Count, FEntityId* OutEntityIds);
+
+	// =============================================
+	// STREAMING
+	// =============================================
+
+	// Starts streaming this world's entities in cells (see FWorldPartition). Replaces any previous partition.
+	void EnablePartition(const FWorldPartitionSettings& Settings);
+	void DisablePartition();
+
+	// Returns nullptr if the world is not partitioned.
+	FWorldPartition* GetPartition() const { return Partition.get(); }
+
+	// The point cells are streamed around, usually the camera position.
+	void SetStreamingOrigin(const FVector2& NewValue) { StreamingOrigin = NewValue; }
+	const FVector2& GetStreamingOrigin() const { return StreamingOrigin; }
+
+	// =============================================
+	// PHYSICS
+	// =============================================
+
+	// Starts simulating rigid bodies (see FPhysicsScene), which Tick writes back to their entities. Replaces any
+	// previous scene and its bodies.
+	void EnablePhysics(const FPhysicsSettings& Settings);
+	void DisablePhysics();
+
+	// Returns nullptr if physics is disabled.
+	FPhysicsScene* GetPhysicsScene() const { return Physics.get(); }
+
+	// =============================================
+	// TILEMAPS
+	// =============================================
+
+	// Adds an empty tilemap, drawn beneath every sprite. Tilemaps draw in the order they were added.
+	FTilemap& AddTilemap(Uint32 Width, Uint32 Height, float TileSize, const FVector2& Origin = FVector2(0.f));
+
+	/// @returns whether Tilemap belonged to this world and was removed.
+	bool RemoveTilemap(const FTilemap* Tilemap);
+
+	const std::vector<TUniquePtr<FTilemap>>& GetTilemaps() const { return Tilemaps; }
+
+	// Solid tiles merged into rectangles (see FTilemapCollision), one per tilemap in the same order.
+	const std::vector<TUniquePtr<FTilemapCollision>>& GetTilemapCollisions() const { return TilemapCollisions; }
+
+	// Merges the solid tiles of chunks edited since the last update, and updates their static bodies if physics is
+	// enabled. Called by Tick, call it directly after editing tiles if queries need to see the edit within the same frame.
+	void UpdateTilemapCollision();
+
+	// Finds the merged solid tile rectangles of every tilemap overlapping Box, writing their bounds. Returns the number written.
+	Uint32 QueryTiles(const FBox2D& Box, FBox2D* OutRects, Uint32 MaxResults) const;
+
+	/**
+	 * @brief Finds the first solid tile of any tilemap crossed by the segment Origin + Direction * [0, MaxDistance].
+	 * @param OutDistance Where the segment enters the tile, in units of Direction.
+	 */
+	bool RaycastTiles(const FVector2& Origin, const FVector2& Direction, float MaxDistance, float& OutDistance) const;
+
+	// =============================================
+	// PARTICLES
+	// =============================================
+
+	// Adds an emitter that Tick updates, drawn over every sprite. Emitters draw in the order they were added.
+	FParticleEmitter& AddParticleEmitter(const FParticleEmitterSettings& Settings, const FVector2& Position = FVector2(0.f));
+
+	/// @returns whether Emitter belonged to this world and was removed.
+	bool RemoveParticleEmitter(const FParticleEmitter* Emitter);
+
+	const std::vector<TUniquePtr<FParticleEmitter>>& GetParticleEmitters() const { return ParticleEmitters; }
+
+	// =============================================
+	// SPATIAL QUERIES
+	// =============================================
+
+	// Switches the spatial index to a uniform hash grid (the default). Suits entities of similar size.
+	void UseSpatialHash(float CellSize = 256.f);
+
+	// Switches the spatial index to a loose quadtree covering WorldBounds. Suits entities of very different sizes.
+	void UseLooseQuadtree(const FBox2D& WorldBounds, Uint32 MaxDepth = 8);
+
+	// Refreshes the spatial index for entities whose bounds changed since the last call. Called by Tick, call it
+	// directly after moving entities if queries need to see the move within the same frame.
+	void UpdateSpatialIndex();
+
+	const ISpatialIndex& GetSpatialIndex() const { return *SpatialIndex; }
+
+	// See ISpatialIndex. Results reflect entity bounds as of the last UpdateSpatialIndex.
+	Uint32 QueryBox(const FBox2D& Box, FEntityId* OutEntityIds, Uint32 MaxResults) const;
+	Uint32 QueryRadius(const FVector2& Centre, float Radius, FEntityId* OutEntityIds, Uint32 MaxResults) const;
+	Uint32 Raycast(const FVector2& Origin, const FVector2& Direction, float MaxDistance, FSpatialRayHit* OutHits, Uint32 MaxHits) const;
+
+	// =============================================
+	// DENSE COMPONENT ARRAYS
+	// =============================================
+
+	const std::vector<FEntityId>& GetEntityIds() const { return EntityIds; }
+	std::vector<FTransform2D>& GetTransforms() { return Transforms; }
+	const std::vector<FTransform2D>& GetTransforms() const { return Transforms; }
+	std::vector<FSpriteComponent>& GetSprites() { return Sprites; }
+	const std::vector<FSpriteComponent>& GetSprites() const { return Sprites; }
+
+private:
+	// Name table bytes that may be dead before destroying an entity compacts the table.
+	static constexpr size_t MIN_NAME_COMPACT_BYTES = 4096;
+
+	// Inverted, so no sprite's bounds ever match it.
+	static constexpr FBox2D UNINDEXED_BOUNDS = FBox2D(FVector2(1.f), FVector2(-1.f));
+
+	FEntityId AllocateEntityId();
+
+	// Rebuilds NameTable with only the names of live entities.
+	void CompactNameTable();
+
+	// Dense index -> entity ID.
+	std::vector<FEntityId> EntityIds;
+
+	// Entity ID -> dense index, INVALID_ENTITY_INDEX for free IDs.
+	std::vector<Uint32> EntityIndices;
+	std::vector<FEntityId> FreeEntityIds;
+
+	std::vector<FTransform2D> Transforms;
+	std::vector<FSpriteComponent> Sprites;
+	std::vector<FEntityName> Names;
+
+	// Null-terminated entity names, referenced by FEntityName offsets.
+	std::vector<char> NameTable;
+
+	// Bytes of NameTable left behind by destroyed entities.
+	size_t DeadNameBytes = 0;
+
+	TUniquePtr<ISpatialIndex> SpatialIndex;
+
+	// Entity ID -> bounds last given to SpatialIndex, UNINDEXED_BOUNDS for IDs it does not hold. Entities whose bounds
+	// still match are skipped by UpdateSpatialIndex, so only the ones that moved are re-filed.
+	std::vector<FBox2D> IndexedBounds;
+
+	TUniquePtr<FWorldPartition> Partition;
+	FVector2 StreamingOrigin;
+
+	TUniquePtr<FPhysicsScene> Physics;
+
+	std::vector<TUniquePtr<FTilemap>> Tilemaps;
+	std::vector<TUniquePtr<FTilemapCollision>> TilemapCollisions;
+
+	std::vector<TUniquePtr<FParticleEmitter>> ParticleEmitters;
+	Uint64 NextParticleSeed = 1;
 };
@@ -0,0 +1,367 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "WorldPartition.h"
+
+// Starlight Engine
+#include "World.h"
+#include "Debug/Logging.h"
+
+// Cell keys are passed through the async IO userdata pointer.
+static_assert(sizeof(void*) >= sizeof(Uint64), "FWorldPartition requires 64-bit pointers");
+
+// Entities added or removed between budget checks.
+static constexpr Uint32 CELL_WORK_SLICE = 256;
+
+FWorldPartition::FWorldPartition(SWorld& InWorld, const FWorldPartitionSettings& InSettings)
+	: World(InWorld)
+	, Settings(InSettings)
+{
+	// Cell coordinates are divided by the size. Compared this way round so NaN is rejected too.
+	if ((Settings.CellSize > 0.f) == false)
+	{
+		SL_LOG_FUNC(LogSWorld, Error, "Cell size must be positive, got " + FString(Settings.CellSize) + ". Nothing will stream.");
+		return;
+	}
+
+	LoadQueue = SDL_CreateAsyncIOQueue();
+	if (LoadQueue == nullptr)
+	{
+		SL_LOG_FUNC(LogSWorld, Error, "Could not create the cell load queue! SDL_Error: " + SDL_GetErrorFString());
+	}
+}
+
+FWorldPartition::~FWorldPartition()
+{
+	for (auto& [Key, Cell] : Cells)
+	{
+		ReleaseFileData(Cell);
+	}
+
+	if (LoadQueue != nullptr)
+	{
+		// Wait out reads still in flight and free their buffers here, rather than relying on the queue to drop them.
+		SDL_AsyncIOOutcome Outcome;
+		while (LoadsInFlight > 0 && SDL_WaitAsyncIOResult(LoadQueue, &Outcome, -1))
+		{
+			--LoadsInFlight;
+			SDL_free(Outcome.buffer);
+		}
+
+		SDL_DestroyAsyncIOQueue(LoadQueue);
+		LoadQueue = nullptr;
+	}
+}
+
+void FWorldPartition::Update(const FVector2& StreamingOrigin)
+{
+	if (LoadQueue == nullptr)
+	{
+		return;
+	}
+
+	ProcessLoadResults();
+	ReleaseCells(StreamingOrigin);
+	RequestCells(StreamingOrigin);
+	ProcessCellWork();
+}
+
+bool FWorldPartition::SaveCells(const SWorld& SourceWorld, const FWorldPartitionSettings& Settings)
+{
+	if ((Settings.CellSize > 0.f) == false)
+	{
+		SL_LOG_FUNC(LogSWorld, Error, "Cell size must be positive, got " + FString(Settings.CellSize) + ".");
+		return false;
+	}
+
+	std::unordered_map<Uint64, std::vector<Uint32>> CellEntityIndices;
+	const std::vector<FTransform2D>& Transforms = SourceWorld.GetTransforms();
+	for (Uint32 Index = 0; Index < SourceWorld.GetEntityCount(); ++Index)
+	{
+		const Sint32 CellX = static_cast<Sint32>(SMath::Floor(Transforms[Index].Position.x / Settings.CellSize));
+		const Sint32 CellY = static_cast<Sint32>(SMath::Floor(Transforms[Index].Position.y / Settings.CellSize));
+		CellEntityIndices[MakeCellKey(CellX, CellY)].push_back(Index);
+	}
+
+	bool bSuccess = true;
+	for (const auto& [Key, EntityIndices] : CellEntityIndices)
+	{
+		TObjectPtr<SWorld> CellWorld = NewObject<SWorld>(nullptr);
+		for (const Uint32 Index : EntityIndices)
+		{
+			FEntityId EntityId;
+			CellWorld->AppendEntities(&SourceWorld.Transforms[Index], &SourceWorld.Sprites[Index], &SourceWorld.Names[Index], SourceWorld.NameTable.data(), 1, &EntityId);
+		}
+
+		const auto CellX = static_cast<Sint32>(Key >> 32);
+		const auto CellY = static_cast<Sint32>(Key & 0xFFFFFFFFu);
+		bSuccess &= FWorldArchive::Save(*CellWorld, GetCellFilePath(Settings.CellDirectory, CellX, CellY));
+	}
+
+	return bSuccess;
+}
+
+EWorldCellState FWorldPartition::GetCellState(const Sint32 CellX, const Sint32 CellY) const
+{
+	const auto FoundCell = Cells.find(MakeCellKey(CellX, CellY));
+	return FoundCell != Cells.end() ? FoundCell->second.State : EWorldCellState::Unloaded;
+}
+
+Uint32 FWorldPartition::GetPendingCellCount() const
+{
+	Uint32 PendingCount = 0;
+	for (const auto& [Key, Cell] : Cells)
+	{
+		if (Cell.State == EWorldCellState::Loading || Cell.State == EWorldCellState::Activating || Cell.State == EWorldCellState::Unloading)
+		{
+			++PendingCount;
+		}
+	}
+
+	return PendingCount;
+}
+
+Uint64 FWorldPartition::MakeCellKey(const Sint32 CellX, const Sint32 CellY)
+{
+	return (static_cast<Uint64>(static_cast<Uint32>(CellX)) << 32) | static_cast<Uint32>(CellY);
+}
+
+FString FWorldPartition::GetCellFilePath(const FString& CellDirectory, const Sint32 CellX, const Sint32 CellY)
+{
+	FString FilePath = CellDirectory;
+	const size_t Length = static_cast<size_t>(FilePath.GetLength());
+	if (Length > 0 && FilePath[Length - 1] != '/' && FilePath[Length - 1] != '\\')
+	{
+		FilePath += "/";
+	}
+
+	return FilePath + "Cell_" + FString(CellX) + "_" + FString(CellY) + ".slworld";
+}
+
+void FWorldPartition::RequestCells(const FVector2& StreamingOrigin)
+{
+	const float LoadRadiusSquared = Settings.LoadRadius * Settings.LoadRadius;
+	const auto MinX = static_cast<Sint32>(SMath::Floor((StreamingOrigin.x - Settings.LoadRadius) / Settings.CellSize));
+	const auto MaxX = static_cast<Sint32>(SMath::Floor((StreamingOrigin.x + Settings.LoadRadius) / Settings.CellSize));
+	const auto MinY = static_cast<Sint32>(SMath::Floor((StreamingOrigin.y - Settings.LoadRadius) / Settings.CellSize));
+	const auto MaxY = static_cast<Sint32>(SMath::Floor((StreamingOrigin.y + Settings.LoadRadius) / Settings.CellSize));
+
+	for (Sint32 CellY = MinY; CellY <= MaxY; ++CellY)
+	{
+		for (Sint32 CellX = MinX; CellX <= MaxX; ++CellX)
+		{
+			const FVector2 CellCentre((static_cast<float>(CellX) + 0.5f) * Settings.CellSize, (static_cast<float>(CellY) + 0.5f) * Settings.CellSize);
+			if ((CellCentre - StreamingOrigin).LengthSquared() > LoadRadiusSquared)
+			{
+				continue;
+			}
+
+			FWorldCell& Cell = Cells[MakeCellKey(CellX, CellY)];
+			Cell.X = CellX;
+			Cell.Y = CellY;
+			Cell.bWanted = true;
+
+			if (Cell.State == EWorldCellState::Unloaded && LoadsInFlight < Settings.MaxConcurrentLoads)
+			{
+				StartLoad(Cell);
+			}
+		}
+	}
+}
+
+void FWorldPartition::ReleaseCells(const FVector2& StreamingOrigin)
+{
+	const float UnloadRadiusSquared = Settings.UnloadRadius * Settings.UnloadRadius;
+	for (auto CellIt = Cells.begin(); CellIt != Cells.end();)
+	{
+		FWorldCell& Cell = CellIt->second;
+		if ((GetCellCentre(Cell) - StreamingOrigin).LengthSquared() > UnloadRadiusSquared)
+		{
+			Cell.bWanted = false;
+		}
+
+		if (Cell.bWanted == false)
+		{
+			switch (Cell.State)
+			{
+			case EWorldCellState::Unloaded:
+				CellIt = Cells.erase(CellIt);
+				continue;
+
+			case EWorldCellState::Activating:
+			case EWorldCellState::Active:
+				ReleaseFileData(Cell);
+				Cell.State = EWorldCellState::Unloading;
+				break;
+
+			case EWorldCellState::Loading:
+			case EWorldCellState::Unloading:
+			default:
+				// Loading cells are dropped when their read completes.
+				break;
+			}
+		}
+
+		++CellIt;
+	}
+}
+
+void FWorldPartition::ProcessLoadResults()
+{
+	if (LoadQueue == nullptr)
+	{
+		return;
+	}
+
+	SDL_AsyncIOOutcome Outcome;
+	while (SDL_GetAsyncIOResult(LoadQueue, &Outcome))
+	{
+		--LoadsInFlight;
+
+		const auto Key = static_cast<Uint64>(reinterpret_cast<uintptr_t>(Outcome.userdata));
+		const auto FoundCell = Cells.find(Key);
+		if (FoundCell == Cells.end() || FoundCell->second.bWanted == false)
+		{
+			SDL_free(Outcome.buffer);
+			if (FoundCell != Cells.end())
+			{
+				FoundCell->second.State = EWorldCellState::Unloaded;
+			}
+			continue;
+		}
+
+		FWorldCell& Cell = FoundCell->second;
+		if (Outcome.result != SDL_ASYNCIO_COMPLETE)
+		{
+			SL_LOG_FUNC(LogSWorld, Warning, "Failed to read cell " + FString(Cell.X) + ", " + FString(Cell.Y) + ".");
+			SDL_free(Outcome.buffer);
+
+			// Treat as empty rather than retrying every frame.
+			Cell.State = EWorldCellState::Active;
+			continue;
+		}
+
+		FinishLoad(Cell, Outcome.buffer, Outcome.bytes_transferred);
+	}
+}
+
+void FWorldPartition::ProcessCellWork()
+{
+	const Uint64 DeadlineNS = SDL_GetTicksNS() + Settings.FrameBudgetNS;
+
+	// Unloading goes first so memory is released before more is added.
+	for (auto& [Key, Cell] : Cells)
+	{
+		if (Cell.State == EWorldCellState::Unloading && UnloadCell(Cell, DeadlineNS) == false)
+		{
+			return;
+		}
+	}
+
+	for (auto& [Key, Cell] : Cells)
+	{
+		if (Cell.State == EWorldCellState::Activating && ActivateCell(Cell, DeadlineNS) == false)
+		{
+			return;
+		}
+	}
+}
+
+bool FWorldPartition::StartLoad(FWorldCell& Cell)
+{
+	if (LoadQueue == nullptr)
+	{
+		return false;
+	}
+
+	const FString FilePath = GetCellFilePath(Settings.CellDirectory, Cell.X, Cell.Y);
+	void* Userdata = reinterpret_cast<void*>(static_cast<uintptr_t>(MakeCellKey(Cell.X, Cell.Y)));
+	if (SDL_LoadFileAsync(FilePath, LoadQueue, Userdata) == false)
+	{
+		// Cells without a file are empty.
+		Cell.State = EWorldCellState::Active;
+		return false;
+	}
+
+	++LoadsInFlight;
+	Cell.State = EWorldCellState::Loading;
+	return true;
+}
+
+void FWorldPartition::FinishLoad(FWorldCell& Cell, void* Data, const Uint64 DataSize)
+{
+	Cell.FileData = Data;
+	if (FWorldArchive::Parse(Data, static_cast<size_t>(DataSize), Cell.View) == false)
+	{
+		SL_LOG_FUNC(LogSWorld, Warning, "Cell " + FString(Cell.X) + ", " + FString(Cell.Y) + " is not a valid world archive.");
+		ReleaseFileData(Cell);
+		Cell.State = EWorldCellState::Active;
+		return;
+	}
+
+	Cell.Cursor = 0;
+	Cell.Entities.reserve(static_cast<size_t>(Cell.View.EntityCount));
+	Cell.State = EWorldCellState::Activating;
+}
+
+void FWorldPartition::ReleaseFileData(FWorldCell& Cell)
+{
+	if (Cell.FileData != nullptr)
+	{
+		SDL_free(Cell.FileData);
+		Cell.FileData = nullptr;
+	}
+
+	Cell.View = FWorldArchiveView();
+}
+
+bool FWorldPartition::ActivateCell(FWorldCell& Cell, const Uint64 DeadlineNS)
+{
+	const FWorldArchiveView& View = Cell.View;
+	while (Cell.Cursor < View.EntityCount)
+	{
+		const auto SliceCount = static_cast<Uint32>(SDL_min(static_cast<Uint64>(CELL_WORK_SLICE), View.EntityCount - Cell.Cursor));
+		const size_t Start = static_cast<size_t>(Cell.Cursor);
+
+		Cell.Entities.resize(Cell.Entities.size() + SliceCount);
+		World.AppendEntities(View.Transforms + Start, View.Sprites + Start, View.Names + Start, View.NameTable, SliceCount, Cell.Entities.data() + Start);
+		Cell.Cursor += SliceCount;
+
+		if (SDL_GetTicksNS() >= DeadlineNS && Cell.Cursor < View.EntityCount)
+		{
+			return false;
+		}
+	}
+
+	ReleaseFileData(Cell);
+	Cell.State = EWorldCellState::Active;
+	return SDL_GetTicksNS() < DeadlineNS;
+}
+
+bool FWorldPartition::UnloadCell(FWorldCell& Cell, const Uint64 DeadlineNS)
+{
+	while (Cell.Entities.empty() == false)
+	{
+		const size_t SliceCount = SDL_min(static_cast<size_t>(CELL_WORK_SLICE), Cell.Entities.size());
+		for (size_t Index = 0; Index < SliceCount; ++Index)
+		{
+			World.DestroyEntity(Cell.Entities.back());
+			Cell.Entities.pop_back();
+		}
+
+		if (SDL_GetTicksNS() >= DeadlineNS && Cell.Entities.empty() == false)
+		{
+			return false;
+		}
+	}
+
+	Cell.Entities.shrink_to_fit();
+	Cell.Cursor = 0;
+	Cell.State = EWorldCellState::Unloaded;
+	return SDL_GetTicksNS() < DeadlineNS;
+}
+
+FVector2 FWorldPartition::GetCellCentre(const FWorldCell& Cell) const
+{
+	return FVector2((static_cast<float>(Cell.X) + 0.5f) * Settings.CellSize, (static_cast<float>(Cell.Y) + 0.5f) * Settings.CellSize);
+}
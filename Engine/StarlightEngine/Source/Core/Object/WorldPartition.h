@@ -0,0 +1,129 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <unordered_map>
+#include <vector>
+#include <SDL3/SDL_asyncio.h>
+#include <SDL3/SDL_timer.h>
+
+// Starlight Engine
+#include "Entity.h"
+#include "Framework/String.h"
+#include "Serialization/WorldArchive.h"
+
+// Forward Declarations
+class SWorld;
+
+struct FWorldPartitionSettings
+{
+	// Folder containing one world archive per cell, named "Cell_<X>_<Y>.slworld". The trailing separator is optional.
+	FString CellDirectory;
+
+	// Width and height of a cell in world units. Must be positive, a partition with any other size streams nothing.
+	float CellSize = 1024.f;
+
+	// Cells whose centre is within this distance of the streaming origin are loaded.
+	float LoadRadius = 2048.f;
+
+	// Loaded cells whose centre is further than this are unloaded. Should be larger than LoadRadius
+	// so cells on the boundary don't thrash.
+	float UnloadRadius = 2560.f;
+
+	// Time per frame that may be spent adding and removing streamed entities.
+	Uint64 FrameBudgetNS = 2 * SDL_NS_PER_MS;
+
+	// Upper limit of cell files being read at the same time.
+	Uint32 MaxConcurrentLoads = 8;
+};
+
+enum class EWorldCellState : Uint8
+{
+	Unloaded = 0,
+	// File read in flight on the async IO queue.
+	Loading,
+	// File data is in memory, entities are being added a slice at a time.
+	Activating,
+	// All entities are in the world.
+	Active,
+	// Entities are being removed a slice at a time.
+	Unloading,
+};
+
+/**
+ * @brief Streams a world in and out in grid cells around a moving origin.
+ * Cell files are read in the background through SDL's async IO, then their entities are appended to the
+ * world (and removed again) within a per-frame time budget, so neither file IO nor large cells stall a frame.
+ */
+class FWorldPartition
+{
+public:
+	FWorldPartition(SWorld& InWorld, const FWorldPartitionSettings& InSettings);
+	~FWorldPartition();
+
+	FWorldPartition(const FWorldPartition&) = delete;
+	FWorldPartition& operator=(const FWorldPartition&) = delete;
+
+	// Requests and releases cells around StreamingOrigin, then spends the frame budget on pending cell work. Does nothing
+	// if the settings were rejected or the load queue could not be created.
+	void Update(const FVector2& StreamingOrigin);
+
+	// Splits every entity in SourceWorld into cell files in Settings.CellDirectory by position.
+	/// @returns whether every cell was written, false without writing anything if Settings.CellSize is not positive.
+	static bool SaveCells(const SWorld& SourceWorld, const FWorldPartitionSettings& Settings);
+
+	const FWorldPartitionSettings& GetSettings() const { return Settings; }
+
+	EWorldCellState GetCellState(Sint32 CellX, Sint32 CellY) const;
+
+	// Number of cells that are not fully active or unloaded yet.
+	Uint32 GetPendingCellCount() const;
+
+private:
+	struct FWorldCell
+	{
+		Sint32 X = 0;
+		Sint32 Y = 0;
+		EWorldCellState State = EWorldCellState::Unloaded;
+
+		// Cleared when the cell leaves the unload radius while its file is still being read.
+		bool bWanted = false;
+
+		// Buffer from SDL_LoadFileAsync, released once the cell is fully active.
+		void* FileData = nullptr;
+		FWorldArchiveView View;
+
+		// Activation: next archive entity to add. Unloading: number of entities still to remove.
+		Uint64 Cursor = 0;
+
+		// Entities this cell added to the world.
+		std::vector<FEntityId> Entities;
+	};
+
+	static Uint64 MakeCellKey(Sint32 CellX, Sint32 CellY);
+	static FString GetCellFilePath(const FString& CellDirectory, Sint32 CellX, Sint32 CellY);
+
+	void RequestCells(const FVector2& StreamingOrigin);
+	void ReleaseCells(const FVector2& StreamingOrigin);
+	void ProcessLoadResults();
+	void ProcessCellWork();
+
+	bool StartLoad(FWorldCell& Cell);
+	void FinishLoad(FWorldCell& Cell, void* Data, Uint64 DataSize);
+	void ReleaseFileData(FWorldCell& Cell);
+
+	// @returns whether the cell finished within the budget.
+	bool ActivateCell(FWorldCell& Cell, Uint64 DeadlineNS);
+	bool UnloadCell(FWorldCell& Cell, Uint64 DeadlineNS);
+
+	FVector2 GetCellCentre(const FWorldCell& Cell) const;
+
+	SWorld& World;
+	FWorldPartitionSettings Settings;
+
+	SDL_AsyncIOQueue* LoadQueue = nullptr;
+	Uint32 LoadsInFlight = 0;
+
+	std::unordered_map<Uint64, FWorldCell> Cells;
+};
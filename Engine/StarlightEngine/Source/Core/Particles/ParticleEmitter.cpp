@@ -0,0 +1,319 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "ParticleEmitter.h"
+
+// Libraries
+#include <bit>
+#include <limits>
+
+// Starlight Engine
+#include "Framework/TaskSystem.h"
+#include "Math/Simd.h"
+
+namespace
+{
+// Floats per ALIGNMENT bytes. Capacities are rounded up to this, so every array starts on a cache line.
+constexpr Uint32 LANE_PADDING = static_cast<Uint32>(FParticleEmitter::ALIGNMENT / sizeof(float));
+
+// Arrays in an emitter's allocation, all 4 bytes per particle.
+constexpr size_t ARRAY_COUNT = 7;
+
+static_assert(sizeof(FPackedColor) == sizeof(float), "Particle colors share the allocation's 4-byte stride");
+static_assert(FParticleEmitter::PARALLEL_CHUNK_SIZE % LANE_PADDING == 0, "Parallel chunks must start on aligned lanes");
+
+// Age of the slots past the last particle.
+constexpr float DEAD_AGE = 1.f;
+
+constexpr FBox2D EMPTY_BOUNDS = FBox2D(FVector2(std::numeric_limits<float>::max()), FVector2(std::numeric_limits<float>::lowest()));
+}
+
+FParticleEmitter::FParticleEmitter(const FParticleEmitterSettings& InSettings, const FVector2& InPosition, const Uint64 Seed)
+	: Settings(InSettings)
+	, Position(InPosition)
+	, RandomState(Seed)
+	, CentreBounds(EMPTY_BOUNDS)
+{
+	Reallocate(Settings.MaxParticles);
+}
+
+FParticleEmitter::~FParticleEmitter()
+{
+	SDL_aligned_free(Memory);
+}
+
+void FParticleEmitter::SetSettings(const FParticleEmitterSettings& NewValue)
+{
+	Settings = NewValue;
+	if (Settings.MaxParticles != Capacity)
+	{
+		Reallocate(Settings.MaxParticles);
+	}
+}
+
+void FParticleEmitter::Burst(const Uint32 Count)
+{
+	Spawn(Count);
+}
+
+void FParticleEmitter::Update(const float DeltaTime)
+{
+	const Uint32 ChunkCount = SDL_max((ParticleCount + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE, 1u);
+	if (ChunkResults.size() < ChunkCount)
+	{
+		ChunkResults.resize(ChunkCount);
+	}
+
+	if (ChunkCount > 1)
+	{
+		FTaskSystem::ParallelFor(ChunkCount, [this, DeltaTime](const Uint32 ChunkIndex)
+		{
+			const Uint32 Begin = ChunkIndex * PARALLEL_CHUNK_SIZE;
+			Simulate(Begin, SMath::Min(Begin + PARALLEL_CHUNK_SIZE, ParticleCount), DeltaTime, ChunkResults[ChunkIndex]);
+		});
+	}
+	else
+	{
+		Simulate(0, ParticleCount, DeltaTime, ChunkResults[0]);
+	}
+
+	CentreBounds = EMPTY_BOUNDS;
+	for (Uint32 ChunkIndex = 0; ChunkIndex < ChunkCount; ++ChunkIndex)
+	{
+		CentreBounds = CentreBounds.Union(ChunkResults[ChunkIndex].Bounds);
+	}
+
+	RemoveDead(ChunkCount);
+
+	if (bEmitting)
+	{
+		SpawnAccumulator += Settings.SpawnRate * DeltaTime;
+		const Uint32 SpawnCount = static_cast<Uint32>(SpawnAccumulator);
+		SpawnAccumulator -= static_cast<float>(SpawnCount);
+		Spawn(SpawnCount);
+	}
+	else
+	{
+		SpawnAccumulator = 0.f;
+	}
+}
+
+void FParticleEmitter::Clear()
+{
+	for (Uint32 Index = 0; Index < ParticleCount; ++Index)
+	{
+		Ages[Index] = DEAD_AGE;
+	}
+
+	ParticleCount = 0;
+	CentreBounds = EMPTY_BOUNDS;
+}
+
+void FParticleEmitter::Reallocate(const Uint32 NewCapacity)
+{
+	const Uint32 PaddedCapacity = (NewCapacity + LANE_PADDING - 1) / LANE_PADDING * LANE_PADDING;
+
+	// Padding lanes are simulated along with the live particles, so they start zeroed to hold finite values.
+	const size_t ArrayBytes = static_cast<size_t>(PaddedCapacity) * sizeof(float);
+	Uint8* NewMemory = static_cast<Uint8*>(SDL_aligned_alloc(ALIGNMENT, SDL_max(ArrayBytes * ARRAY_COUNT, ALIGNMENT)));
+	SDL_memset(NewMemory, 0, ArrayBytes * ARRAY_COUNT);
+
+	float* NewAges = reinterpret_cast<float*>(NewMemory + ArrayBytes * 4);
+	for (Uint32 Index = 0; Index < PaddedCapacity; ++Index)
+	{
+		NewAges[Index] = DEAD_AGE;
+	}
+
+	float* const NewArrays[ARRAY_COUNT - 1] = {
+		reinterpret_cast<float*>(NewMemory),
+		reinterpret_cast<float*>(NewMemory + ArrayBytes),
+		reinterpret_cast<float*>(NewMemory + ArrayBytes * 2),
+		reinterpret_cast<float*>(NewMemory + ArrayBytes * 3),
+		reinterpret_cast<float*>(NewMemory + ArrayBytes * 4),
+		reinterpret_cast<float*>(NewMemory + ArrayBytes * 5),
+	};
+	FPackedColor* NewColors = reinterpret_cast<FPackedColor*>(NewMemory + ArrayBytes * 6);
+
+	ParticleCount = SDL_min(ParticleCount, NewCapacity);
+	if (Memory != nullptr)
+	{
+		const float* const OldArrays[ARRAY_COUNT - 1] = {PositionsX, PositionsY, VelocitiesX, VelocitiesY, Ages, AgeRates};
+		for (size_t ArrayIndex = 0; ArrayIndex < ARRAY_COUNT - 1; ++ArrayIndex)
+		{
+			SDL_memcpy(NewArrays[ArrayIndex], OldArrays[ArrayIndex], ParticleCount * sizeof(float));
+		}
+		SDL_memcpy(NewColors, Colors, ParticleCount * sizeof(FPackedColor));
+		SDL_aligned_free(Memory);
+	}
+
+	Memory = NewMemory;
+	Capacity = NewCapacity;
+	PositionsX = NewArrays[0];
+	PositionsY = NewArrays[1];
+	VelocitiesX = NewArrays[2];
+	VelocitiesY = NewArrays[3];
+	Ages = NewArrays[4];
+	AgeRates = NewArrays[5];
+	Colors = NewColors;
+}
+
+void FParticleEmitter::Simulate(const Uint32 Begin, const Uint32 End, const float DeltaTime, FChunkResult& Result)
+{
+	// Padding lanes past the last particle are simulated too, which is cheaper than a scalar remainder loop. Their age
+	// keeps them out of the bounds and the dead list.
+	const Uint32 PaddedEnd = (End + 3) & ~3u;
+	const float DragFactor = SMath::Max(1.f - Settings.Drag * DeltaTime, 0.f);
+	const FVector2 VelocityChange = Settings.Acceleration * DeltaTime;
+
+	Result.DeadIndices.clear();
+
+#if SL_SIMD_SSE2
+	const __m128 DragFactorPS = _mm_set1_ps(DragFactor);
+	const __m128 VelocityChangeX = _mm_set1_ps(VelocityChange.x);
+	const __m128 VelocityChangeY = _mm_set1_ps(VelocityChange.y);
+	const __m128 DeltaTimePS = _mm_set1_ps(DeltaTime);
+	const __m128 DeadAge = _mm_set1_ps(DEAD_AGE);
+	const __m128 Largest = _mm_set1_ps(std::numeric_limits<float>::max());
+	const __m128 Lowest = _mm_set1_ps(std::numeric_limits<float>::lowest());
+
+	__m128 MinX = Largest;
+	__m128 MinY = Largest;
+	__m128 MaxX = Lowest;
+	__m128 MaxY = Lowest;
+	for (Uint32 Index = Begin; Index < PaddedEnd; Index += 4)
+	{
+		const __m128 VelocityX = _mm_add_ps(_mm_mul_ps(_mm_load_ps(VelocitiesX + Index), DragFactorPS), VelocityChangeX);
+		const __m128 VelocityY = _mm_add_ps(_mm_mul_ps(_mm_load_ps(VelocitiesY + Index), DragFactorPS), VelocityChangeY);
+		const __m128 PositionX = _mm_add_ps(_mm_load_ps(PositionsX + Index), _mm_mul_ps(VelocityX, DeltaTimePS));
+		const __m128 PositionY = _mm_add_ps(_mm_load_ps(PositionsY + Index), _mm_mul_ps(VelocityY, DeltaTimePS));
+		const __m128 Age = _mm_add_ps(_mm_load_ps(Ages + Index), _mm_mul_ps(_mm_load_ps(AgeRates + Index), DeltaTimePS));
+		_mm_store_ps(VelocitiesX + Index, VelocityX);
+		_mm_store_ps(VelocitiesY + Index, VelocityY);
+		_mm_store_ps(PositionsX + Index, PositionX);
+		_mm_store_ps(PositionsY + Index, PositionY);
+		_mm_store_ps(Ages + Index, Age);
+
+		// Dead lanes are swapped for values that leave the bounds as they are.
+		const __m128 bDead = _mm_cmpge_ps(Age, DeadAge);
+		MinX = _mm_min_ps(MinX, _mm_or_ps(_mm_and_ps(bDead, Largest), _mm_andnot_ps(bDead, PositionX)));
+		MinY = _mm_min_ps(MinY, _mm_or_ps(_mm_and_ps(bDead, Largest), _mm_andnot_ps(bDead, PositionY)));
+		MaxX = _mm_max_ps(MaxX, _mm_or_ps(_mm_and_ps(bDead, Lowest), _mm_andnot_ps(bDead, PositionX)));
+		MaxY = _mm_max_ps(MaxY, _mm_or_ps(_mm_and_ps(bDead, Lowest), _mm_andnot_ps(bDead, PositionY)));
+
+		for (int DeadLanes = _mm_movemask_ps(bDead); DeadLanes != 0; DeadLanes &= DeadLanes - 1)
+		{
+			const Uint32 DeadIndex = Index + static_cast<Uint32>(std::countr_zero(static_cast<unsigned>(DeadLanes)));
+			if (DeadIndex < End)
+			{
+				Result.DeadIndices.push_back(DeadIndex);
+			}
+		}
+	}
+
+	alignas(16) float Lanes[4][4];
+	_mm_store_ps(Lanes[0], MinX);
+	_mm_store_ps(Lanes[1], MinY);
+	_mm_store_ps(Lanes[2], MaxX);
+	_mm_store_ps(Lanes[3], MaxY);
+	Result.Bounds.Min = FVector2(SMath::Min(SMath::Min(Lanes[0][0], Lanes[0][1]), SMath::Min(Lanes[0][2], Lanes[0][3])), SMath::Min(SMath::Min(Lanes[1][0], Lanes[1][1]), SMath::Min(Lanes[1][2], Lanes[1][3])));
+	Result.Bounds.Max = FVector2(SMath::Max(SMath::Max(Lanes[2][0], Lanes[2][1]), SMath::Max(Lanes[2][2], Lanes[2][3])), SMath::Max(SMath::Max(Lanes[3][0], Lanes[3][1]), SMath::Max(Lanes[3][2], Lanes[3][3])));
+#else
+	Result.Bounds = EMPTY_BOUNDS;
+	for (Uint32 Index = Begin; Index < PaddedEnd; ++Index)
+	{
+		VelocitiesX[Index] = VelocitiesX[Index] * DragFactor + VelocityChange.x;
+		VelocitiesY[Index] = VelocitiesY[Index] * DragFactor + VelocityChange.y;
+		PositionsX[Index] += VelocitiesX[Index] * DeltaTime;
+		PositionsY[Index] += VelocitiesY[Index] * DeltaTime;
+		Ages[Index] += AgeRates[Index] * DeltaTime;
+
+		if (Ages[Index] < DEAD_AGE)
+		{
+			Result.Bounds.Min = FVector2(SMath::Min(Result.Bounds.Min.x, PositionsX[Index]), SMath::Min(Result.Bounds.Min.y, PositionsY[Index]));
+			Result.Bounds.Max = FVector2(SMath::Max(Result.Bounds.Max.x, PositionsX[Index]), SMath::Max(Result.Bounds.Max.y, PositionsY[Index]));
+		}
+		else if (Index < End)
+		{
+			Result.DeadIndices.push_back(Index);
+		}
+	}
+#endif
+
+	// Gathering from the gradient has no SIMD form, but stays in the chunk that is already in cache.
+	const FColorGradientLUT& Gradient = Settings.Colors;
+	if (Gradient.IsEmpty() == false)
+	{
+		const float Scale = static_cast<float>(Gradient.GetResolution() - 1);
+		for (Uint32 Index = Begin; Index < End; ++Index)
+		{
+			Colors[Index] = Gradient.Sample(static_cast<Uint32>(SMath::Min(Ages[Index], 1.f) * Scale + 0.5f));
+		}
+	}
+}
+
+void FParticleEmitter::RemoveDead(const Uint32 ChunkCount)
+{
+	// Dead indices come out of the chunks in ascending order, so each hole is filled from the end, past every hole
+	// still to come, and only dead particles are ever visited.
+	for (Uint32 ChunkIndex = 0; ChunkIndex < ChunkCount; ++ChunkIndex)
+	{
+		for (const Uint32 DeadIndex : ChunkResults[ChunkIndex].DeadIndices)
+		{
+			// Dead particles at the end need no hole filled.
+			while (ParticleCount > 0 && Ages[ParticleCount - 1] >= DEAD_AGE)
+			{
+				--ParticleCount;
+			}
+
+			if (DeadIndex >= ParticleCount)
+			{
+				return;
+			}
+
+			const Uint32 LastIndex = --ParticleCount;
+			PositionsX[DeadIndex] = PositionsX[LastIndex];
+			PositionsY[DeadIndex] = PositionsY[LastIndex];
+			VelocitiesX[DeadIndex] = VelocitiesX[LastIndex];
+			VelocitiesY[DeadIndex] = VelocitiesY[LastIndex];
+			Ages[DeadIndex] = Ages[LastIndex];
+			AgeRates[DeadIndex] = AgeRates[LastIndex];
+			Colors[DeadIndex] = Colors[LastIndex];
+			Ages[LastIndex] = DEAD_AGE;
+		}
+	}
+}
+
+void FParticleEmitter::Spawn(const Uint32 Count)
+{
+	const Uint32 SpawnCount = SDL_min(Count, Capacity - ParticleCount);
+	const FPackedColor BirthColor = Settings.Colors.IsEmpty() ? FPackedColor() : Settings.Colors.Sample(0);
+	const float Direction = SMath::DegreesToRadians(Settings.Direction);
+	const float Spread = SMath::DegreesToRadians(Settings.Spread);
+
+	for (Uint32 Index = ParticleCount; Index < ParticleCount + SpawnCount; ++Index)
+	{
+		const float Angle = Direction + (SDL_randf_r(&RandomState) - 0.5f) * Spread;
+		const float Speed = SMath::Lerp(Settings.MinSpeed, Settings.MaxSpeed, SDL_randf_r(&RandomState));
+		const float Lifetime = SMath::Lerp(Settings.MinLifetime, Settings.MaxLifetime, SDL_randf_r(&RandomState));
+
+		FVector2 Offset(0.f);
+		if (Settings.SpawnRadius > 0.f)
+		{
+			// Square root of a uniform radius spreads particles evenly over the disc rather than bunching them at its centre.
+			const float OffsetAngle = SDL_randf_r(&RandomState) * SMath::TWO_PI;
+			const float OffsetDistance = SDL_sqrtf(SDL_randf_r(&RandomState)) * Settings.SpawnRadius;
+			Offset = FVector2(SDL_cosf(OffsetAngle), SDL_sinf(OffsetAngle)) * OffsetDistance;
+		}
+
+		PositionsX[Index] = Position.x + Offset.x;
+		PositionsY[Index] = Position.y + Offset.y;
+		VelocitiesX[Index] = SDL_cosf(Angle) * Speed;
+		VelocitiesY[Index] = SDL_sinf(Angle) * Speed;
+		Ages[Index] = 0.f;
+		AgeRates[Index] = Lifetime > SMath::EPSILON ? 1.f / Lifetime : 1.f / SMath::EPSILON;
+		Colors[Index] = BirthColor;
+		AddToBounds(PositionsX[Index], PositionsY[Index]);
+	}
+
+	ParticleCount += SpawnCount;
+}
@@ -0,0 +1,176 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <vector>
+#include <SDL3/SDL_stdinc.h>
+
+// Starlight Engine
+#include "Framework/ColorGradient.h"
+#include "Math/Box2D.h"
+#include "Math/Vector2.h"
+
+struct FParticleEmitterSettings
+{
+	// Particles alive at once. Spawning stops while the emitter is full.
+	Uint32 MaxParticles = 10000;
+
+	// Particles spawned per second while emitting.
+	float SpawnRate = 100.f;
+
+	// Seconds, picked at random per particle.
+	float MinLifetime = 1.f;
+	float MaxLifetime = 2.f;
+
+	// World units per second, picked at random per particle.
+	float MinSpeed = 50.f;
+	float MaxSpeed = 100.f;
+
+	// Degrees, like FTransform2D. Particles leave within Spread / 2 either side of Direction.
+	float Direction = -90.f;
+	float Spread = 30.f;
+
+	// Particles spawn within this distance of the emitter's position.
+	float SpawnRadius = 0.f;
+
+	// World units per second squared, e.g. gravity.
+	FVector2 Acceleration = FVector2(0.f);
+
+	// Fraction of its velocity a particle loses per second.
+	float Drag = 0.f;
+
+	// Width and height in world units at birth and at death, blended linearly in between.
+	float StartSize = 4.f;
+	float EndSize = 0.f;
+
+	// Color over each particle's life. Empty draws white.
+	FColorGradientLUT Colors;
+
+	// Resource handle of the texture, 0 draws solid squares.
+	Uint32 TextureId = 0;
+};
+
+/**
+ * @brief A pool of particles simulated on the CPU.
+ * Each attribute lives in its own array, aligned to a cache line and padded to a whole number of SIMD lanes, so the
+ * update streams through memory four particles at a time with no scalar remainder. Large emitters are updated in
+ * parallel chunks. Dead particles are removed by moving the last live particle into their slot, which keeps the arrays
+ * dense without shifting anything.
+ */
+class FParticleEmitter
+{
+public:
+	// Particles per parallel update chunk. Emitters with fewer particles update on the calling thread.
+	static constexpr Uint32 PARALLEL_CHUNK_SIZE = 16384;
+
+	// Alignment of each attribute array, in bytes.
+	static constexpr size_t ALIGNMENT = 64;
+
+	explicit FParticleEmitter(const FParticleEmitterSettings& InSettings, const FVector2& InPosition = FVector2(0.f), Uint64 Seed = 0);
+	~FParticleEmitter();
+
+	FParticleEmitter(const FParticleEmitter&) = delete;
+	FParticleEmitter& operator=(const FParticleEmitter&) = delete;
+
+	const FParticleEmitterSettings& GetSettings() const { return Settings; }
+
+	// Live particles are kept, apart from those past the new MaxParticles.
+	void SetSettings(const FParticleEmitterSettings& NewValue);
+
+	const FVector2& GetPosition() const { return Position; }
+	void SetPosition(const FVector2& NewValue) { Position = NewValue; }
+
+	bool IsEmitting() const { return bEmitting; }
+	void SetEmitting(const bool bInEmitting) { bEmitting = bInEmitting; }
+
+	// Spawns Count particles at once, as far as there is room.
+	void Burst(Uint32 Count);
+
+	// Moves and ages every particle, removes the dead ones, then spawns new ones if emitting.
+	void Update(float DeltaTime);
+
+	void Clear();
+
+	Uint32 GetParticleCount() const { return ParticleCount; }
+
+	// Bounds of every live particle as of the last Update or Burst, including their size. Invalid while there are none.
+	FBox2D GetBounds() const { return CentreBounds.IsValid() ? CentreBounds.ExpandedBy(SMath::Max(Settings.StartSize, Settings.EndSize) * 0.5f) : CentreBounds; }
+
+	// =============================================
+	// PARTICLE ARRAYS
+	// =============================================
+
+	// Each holds GetParticleCount() live particles.
+
+	const float* GetPositionsX() const { return PositionsX; }
+	const float* GetPositionsY() const { return PositionsY; }
+
+	// How far through its life each particle is, from 0 at birth to 1 at death.
+	const float* GetAges() const { return Ages; }
+
+	const FPackedColor* GetColors() const { return Colors; }
+
+	float GetSize(const float Age) const { return SMath::Lerp(Settings.StartSize, Settings.EndSize, Age); }
+
+private:
+	// Moves the live particles into arrays with room for Capacity, padded to whole SIMD lanes.
+	void Reallocate(Uint32 Capacity);
+
+	// What one update chunk found, merged once every chunk has finished.
+	struct FChunkResult
+	{
+		// Bounds of the centres of the particles still alive.
+		FBox2D Bounds;
+
+		// Particles that reached the end of their life, in ascending order.
+		std::vector<Uint32> DeadIndices;
+	};
+
+	// Moves and ages the particles in [Begin, End), rounded up to whole SIMD lanes.
+	void Simulate(Uint32 Begin, Uint32 End, float DeltaTime, FChunkResult& Result);
+
+	// Fills each dead particle's slot with the last live particle.
+	void RemoveDead(Uint32 ChunkCount);
+
+	void Spawn(Uint32 Count);
+
+	void AddToBounds(const float X, const float Y)
+	{
+		CentreBounds.Min = FVector2(SMath::Min(CentreBounds.Min.x, X), SMath::Min(CentreBounds.Min.y, Y));
+		CentreBounds.Max = FVector2(SMath::Max(CentreBounds.Max.x, X), SMath::Max(CentreBounds.Max.y, Y));
+	}
+
+	FParticleEmitterSettings Settings;
+	FVector2 Position;
+	bool bEmitting = true;
+
+	// Spawns owed by SpawnRate but not made yet, carried between updates.
+	float SpawnAccumulator = 0.f;
+
+	// State of SDL_randf_r.
+	Uint64 RandomState;
+
+	// Bounds of the live particles' centres.
+	FBox2D CentreBounds;
+
+	std::vector<FChunkResult> ChunkResults;
+
+	// One allocation holding every array below.
+	void* Memory = nullptr;
+	Uint32 Capacity = 0;
+	Uint32 ParticleCount = 0;
+
+	float* PositionsX = nullptr;
+	float* PositionsY = nullptr;
+	float* VelocitiesX = nullptr;
+	float* VelocitiesY = nullptr;
+
+	// Slots past the last particle always hold an age of at least 1, so SIMD lanes reaching past the end never count
+	// as alive.
+	float* Ages = nullptr;
+
+	// Age gained per second, 1 / lifetime.
+	float* AgeRates = nullptr;
+	FPackedColor* Colors = nullptr;
+};
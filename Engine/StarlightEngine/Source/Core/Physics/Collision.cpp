@@ -0,0 +1,522 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "Collision.h"
+
+// Libraries
+#include <limits>
+#include <utility>
+
+namespace
+{
+// A polygon moved into world space, so the tests below never transform a vertex twice.
+struct FWorldPolygon
+{
+	Uint32 VertexCount = 0;
+	FVector2 Vertices[FPhysicsShape::MAX_POLYGON_VERTICES];
+	FVector2 Normals[FPhysicsShape::MAX_POLYGON_VERTICES];
+
+	FWorldPolygon(const FPhysicsShape& Shape, const FPhysicsTransform& Transform) : VertexCount(Shape.VertexCount)
+	{
+		for (Uint32 Index = 0; Index < VertexCount; ++Index)
+		{
+			Vertices[Index] = Transform.TransformPoint(Shape.Vertices[Index]);
+			Normals[Index] = Transform.Rotate(Shape.Normals[Index]);
+		}
+	}
+};
+
+// Finds the edge of A whose outward normal separates the polygons the most.
+float FindMaxSeparation(const FWorldPolygon& A, const FWorldPolygon& B, Uint32& OutEdgeIndex)
+{
+	float MaxSeparation = std::numeric_limits<float>::lowest();
+	OutEdgeIndex = 0;
+
+	for (Uint32 EdgeIndex = 0; EdgeIndex < A.VertexCount; ++EdgeIndex)
+	{
+		const FVector2& Normal = A.Normals[EdgeIndex];
+		const FVector2& Vertex = A.Vertices[EdgeIndex];
+
+		// Deepest vertex of B along the normal.
+		float Separation = std::numeric_limits<float>::max();
+		for (Uint32 VertexIndex = 0; VertexIndex < B.VertexCount; ++VertexIndex)
+		{
+			Separation = SMath::Min(Separation, Normal.Dot(B.Vertices[VertexIndex] - Vertex));
+		}
+
+		if (Separation > MaxSeparation)
+		{
+			MaxSeparation = Separation;
+			OutEdgeIndex = EdgeIndex;
+		}
+	}
+
+	return MaxSeparation;
+}
+
+struct FClipVertex
+{
+	FVector2 Position;
+	Uint32 FeatureId = 0;
+};
+
+// Keeps the part of the segment In on the negative side of the plane Dot(Normal, X) = Offset.
+/// @returns how many vertices were written to Out, 2 unless the segment lies entirely outside.
+Uint32 ClipSegment(const FClipVertex (&In)[2], FClipVertex (&Out)[2], const FVector2& Normal, const float Offset, const Uint32 ClipFeature)
+{
+	const float Distance0 = Normal.Dot(In[0].Position) - Offset;
+	const float Distance1 = Normal.Dot(In[1].Position) - Offset;
+
+	Uint32 Count = 0;
+	if (Distance0 <= 0.f)
+	{
+		Out[Count++] = In[0];
+	}
+	if (Distance1 <= 0.f)
+	{
+		Out[Count++] = In[1];
+	}
+
+	if (Distance0 * Distance1 < 0.f)
+	{
+		const float Alpha = Distance0 / (Distance0 - Distance1);
+		Out[Count].Position = In[0].Position + (In[1].Position - In[0].Position) * Alpha;
+		Out[Count].FeatureId = (Distance0 > 0.f ? In[0].FeatureId : In[1].FeatureId) | ClipFeature;
+		++Count;
+	}
+
+	return Count;
+}
+
+bool CollidePolygons(const FPhysicsShape& ShapeA, const FPhysicsTransform& TransformA, const FPhysicsShape& ShapeB, const FPhysicsTransform& TransformB, FContactManifold& OutManifold)
+{
+	const FWorldPolygon PolygonA(ShapeA, TransformA);
+	const FWorldPolygon PolygonB(ShapeB, TransformB);
+
+	Uint32 EdgeA;
+	const float SeparationA = FindMaxSeparation(PolygonA, PolygonB, EdgeA);
+	if (SeparationA > 0.f)
+	{
+		return false;
+	}
+
+	Uint32 EdgeB;
+	const float SeparationB = FindMaxSeparation(PolygonB, PolygonA, EdgeB);
+	if (SeparationB > 0.f)
+	{
+		return false;
+	}
+
+	// Prefer A's face unless B's is clearly better, so the choice does not flicker between near-equal faces.
+	constexpr float FACE_TOLERANCE = 0.05f;
+	const bool bFlip = SeparationB > SeparationA + FACE_TOLERANCE;
+	const FWorldPolygon& Reference = bFlip ? PolygonB : PolygonA;
+	const FWorldPolygon& Incident = bFlip ? PolygonA : PolygonB;
+	const Uint32 ReferenceEdge = bFlip ? EdgeB : EdgeA;
+	const FVector2& ReferenceNormal = Reference.Normals[ReferenceEdge];
+
+	// The incident edge is the one facing the reference face the most.
+	Uint32 IncidentEdge = 0;
+	float MinDot = std::numeric_limits<float>::max();
+	for (Uint32 EdgeIndex = 0; EdgeIndex < Incident.VertexCount; ++EdgeIndex)
+	{
+		const float Dot = ReferenceNormal.Dot(Incident.Normals[EdgeIndex]);
+		if (Dot < MinDot)
+		{
+			MinDot = Dot;
+			IncidentEdge = EdgeIndex;
+		}
+	}
+
+	// Feature IDs pack the reference edge, the incident vertex and which side plane clipped it.
+	const Uint32 EdgeFeature = (ReferenceEdge << 24) | (bFlip ? 1u : 0u);
+	const Uint32 IncidentNext = IncidentEdge + 1 < Incident.VertexCount ? IncidentEdge + 1 : 0;
+	const FClipVertex IncidentSegment[2] = {
+		{Incident.Vertices[IncidentEdge], EdgeFeature | (IncidentEdge << 16)},
+		{Incident.Vertices[IncidentNext], EdgeFeature | (IncidentNext << 16)}};
+
+	// Clip the incident edge to the side planes of the reference face.
+	const FVector2& Reference1 = Reference.Vertices[ReferenceEdge];
+	const FVector2& Reference2 = Reference.Vertices[ReferenceEdge + 1 < Reference.VertexCount ? ReferenceEdge + 1 : 0];
+	const FVector2 Tangent = (Reference2 - Reference1).Normalized();
+
+	FClipVertex Clipped1[2];
+	FClipVertex Clipped2[2];
+	if (ClipSegment(IncidentSegment, Clipped1, -Tangent, -Tangent.Dot(Reference1), 1u << 8) < 2
+		|| ClipSegment(Clipped1, Clipped2, Tangent, Tangent.Dot(Reference2), 2u << 8) < 2)
+	{
+		return false;
+	}
+
+	OutManifold.Normal = bFlip ? -ReferenceNormal : ReferenceNormal;
+	OutManifold.PointCount = 0;
+	for (const FClipVertex& Vertex : Clipped2)
+	{
+		const float Separation = ReferenceNormal.Dot(Vertex.Position - Reference1);
+		if (Separation <= 0.f)
+		{
+			FContactPoint& Point = OutManifold.Points[OutManifold.PointCount++];
+			Point.Position = Vertex.Position;
+			Point.Separation = Separation;
+			Point.FeatureId = Vertex.FeatureId;
+		}
+	}
+
+	return OutManifold.PointCount > 0;
+}
+
+bool CollidePolygonCircle(const FPhysicsShape& Polygon, const FPhysicsTransform& PolygonTransform, const FPhysicsShape& Circle, const FPhysicsTransform& CircleTransform, FContactManifold& OutManifold)
+{
+	// Work in the polygon's local space, where its vertices and normals already are.
+	const FVector2 Centre = PolygonTransform.InverseTransformPoint(CircleTransform.Position);
+	const float Radius = Circle.Radius;
+
+	Uint32 Edge = 0;
+	float MaxSeparation = std::numeric_limits<float>::lowest();
+	for (Uint32 EdgeIndex = 0; EdgeIndex < Polygon.VertexCount; ++EdgeIndex)
+	{
+		const float Separation = Polygon.Normals[EdgeIndex].Dot(Centre - Polygon.Vertices[EdgeIndex]);
+		if (Separation > Radius)
+		{
+			return false;
+		}
+
+		if (Separation > MaxSeparation)
+		{
+			MaxSeparation = Separation;
+			Edge = EdgeIndex;
+		}
+	}
+
+	const FVector2& Vertex1 = Polygon.Vertices[Edge];
+	const FVector2& Vertex2 = Polygon.Vertices[Edge + 1 < Polygon.VertexCount ? Edge + 1 : 0];
+
+	// Past either end of the nearest edge, the nearest feature is that corner.
+	FVector2 LocalNormal = Polygon.Normals[Edge];
+	float Separation = MaxSeparation - Radius;
+	if (MaxSeparation > SMath::EPSILON)
+	{
+		const FVector2* Corner = nullptr;
+		if ((Centre - Vertex1).Dot(Vertex2 - Vertex1) <= 0.f)
+		{
+			Corner = &Vertex1;
+		}
+		else if ((Centre - Vertex2).Dot(Vertex1 - Vertex2) <= 0.f)
+		{
+			Corner = &Vertex2;
+		}
+
+		if (Corner != nullptr)
+		{
+			const float Distance = (Centre - *Corner).Length();
+			if (Distance > Radius)
+			{
+				return false;
+			}
+
+			LocalNormal = (Centre - *Corner) / Distance;
+			Separation = Distance - Radius;
+		}
+	}
+
+	OutManifold.Normal = PolygonTransform.Rotate(LocalNormal);
+	OutManifold.PointCount = 1;
+	OutManifold.Points[0].Position = CircleTransform.Position - OutManifold.Normal * Radius;
+	OutManifold.Points[0].Separation = Separation;
+	OutManifold.Points[0].FeatureId = Edge;
+	return true;
+}
+
+bool CollideCircles(const FPhysicsShape& CircleA, const FPhysicsTransform& TransformA, const FPhysicsShape& CircleB, const FPhysicsTransform& TransformB, FContactManifold& OutManifold)
+{
+	const FVector2 Offset = TransformB.Position - TransformA.Position;
+	const float Distance = Offset.Length();
+	const float RadiusSum = CircleA.Radius + CircleB.Radius;
+	if (Distance > RadiusSum)
+	{
+		return false;
+	}
+
+	// Exactly coincident circles have no direction to separate along, so pick one.
+	OutManifold.Normal = Distance > SMath::EPSILON ? Offset / Distance : FVector2(0.f, 1.f);
+	OutManifold.PointCount = 1;
+	OutManifold.Points[0].Position = TransformA.Position + OutManifold.Normal * CircleA.Radius;
+	OutManifold.Points[0].Separation = Distance - RadiusSum;
+	OutManifold.Points[0].FeatureId = 0;
+	return true;
+}
+
+FVector2 ClosestPointOnSegment(const FVector2& Point, const FVector2& Start, const FVector2& End)
+{
+	const FVector2 Edge = End - Start;
+	const float Alpha = SMath::Clamp((Point - Start).Dot(Edge) / SMath::Max(Edge.Dot(Edge), SMath::EPSILON), 0.f, 1.f);
+	return Start + Edge * Alpha;
+}
+
+// Nearest point on the edges of a polygon to a point outside of it.
+FVector2 ClosestPointOnPolygon(const FWorldPolygon& Polygon, const FVector2& Point)
+{
+	FVector2 Closest;
+	float MinDistanceSquared = std::numeric_limits<float>::max();
+	for (Uint32 Index = 0; Index < Polygon.VertexCount; ++Index)
+	{
+		const FVector2& Next = Polygon.Vertices[Index + 1 < Polygon.VertexCount ? Index + 1 : 0];
+		const FVector2 Candidate = ClosestPointOnSegment(Point, Polygon.Vertices[Index], Next);
+		const float DistanceSquared = (Point - Candidate).Dot(Point - Candidate);
+		if (DistanceSquared < MinDistanceSquared)
+		{
+			MinDistanceSquared = DistanceSquared;
+			Closest = Candidate;
+		}
+	}
+
+	return Closest;
+}
+
+float PolygonSeparation(const FPhysicsShape& ShapeA, const FPhysicsTransform& TransformA, const FPhysicsShape& ShapeB, const FPhysicsTransform& TransformB, FVector2& OutNormal)
+{
+	const FWorldPolygon PolygonA(ShapeA, TransformA);
+	const FWorldPolygon PolygonB(ShapeB, TransformB);
+
+	Uint32 EdgeA;
+	Uint32 EdgeB;
+	const float SeparationA = FindMaxSeparation(PolygonA, PolygonB, EdgeA);
+	const float SeparationB = FindMaxSeparation(PolygonB, PolygonA, EdgeB);
+	if (SeparationA <= 0.f && SeparationB <= 0.f)
+	{
+		OutNormal = SeparationA >= SeparationB ? PolygonA.Normals[EdgeA] : -PolygonB.Normals[EdgeB];
+		return SMath::Max(SeparationA, SeparationB);
+	}
+
+	// Separated convex polygons are nearest at a vertex of one, which the axis test only bounds from below near corners.
+	FVector2 Offset;
+	float MinDistanceSquared = std::numeric_limits<float>::max();
+	const auto TestVertex = [&](const FWorldPolygon& Polygon, const FVector2& Vertex, const float Sign)
+	{
+		const FVector2 VertexOffset = (Vertex - ClosestPointOnPolygon(Polygon, Vertex)) * Sign;
+		const float DistanceSquared = VertexOffset.Dot(VertexOffset);
+		if (DistanceSquared < MinDistanceSquared)
+		{
+			MinDistanceSquared = DistanceSquared;
+			Offset = VertexOffset;
+		}
+	};
+
+	for (Uint32 Index = 0; Index < PolygonA.VertexCount; ++Index)
+	{
+		TestVertex(PolygonB, PolygonA.Vertices[Index], -1.f);
+	}
+	for (Uint32 Index = 0; Index < PolygonB.VertexCount; ++Index)
+	{
+		TestVertex(PolygonA, PolygonB.Vertices[Index], 1.f);
+	}
+
+	const float Distance = SMath::Sqrt(MinDistanceSquared);
+	OutNormal = Offset / SMath::Max(Distance, SMath::EPSILON);
+	return Distance;
+}
+
+// OutNormal points from the polygon to the circle.
+float PolygonCircleSeparation(const FPhysicsShape& Polygon, const FPhysicsTransform& PolygonTransform, const FPhysicsShape& Circle, const FPhysicsTransform& CircleTransform, FVector2& OutNormal)
+{
+	const FWorldPolygon WorldPolygon(Polygon, PolygonTransform);
+	const FVector2& Centre = CircleTransform.Position;
+
+	Uint32 Edge = 0;
+	float MaxSeparation = std::numeric_limits<float>::lowest();
+	for (Uint32 Index = 0; Index < WorldPolygon.VertexCount; ++Index)
+	{
+		const float Separation = WorldPolygon.Normals[Index].Dot(Centre - WorldPolygon.Vertices[Index]);
+		if (Separation > MaxSeparation)
+		{
+			MaxSeparation = Separation;
+			Edge = Index;
+		}
+	}
+
+	if (MaxSeparation <= 0.f)
+	{
+		OutNormal = WorldPolygon.Normals[Edge];
+		return MaxSeparation - Circle.Radius;
+	}
+
+	const FVector2 Offset = Centre - ClosestPointOnPolygon(WorldPolygon, Centre);
+	const float Distance = Offset.Length();
+	OutNormal = Offset / SMath::Max(Distance, SMath::EPSILON);
+	return Distance - Circle.Radius;
+}
+}
+
+bool CollideShapes(const FPhysicsShape& ShapeA, const FPhysicsTransform& TransformA, const FPhysicsShape& ShapeB, const FPhysicsTransform& TransformB, FContactManifold& OutManifold)
+{
+	if (ShapeA.Type == EPhysicsShapeType::Polygon)
+	{
+		return ShapeB.Type == EPhysicsShapeType::Polygon
+			? CollidePolygons(ShapeA, TransformA, ShapeB, TransformB, OutManifold)
+			: CollidePolygonCircle(ShapeA, TransformA, ShapeB, TransformB, OutManifold);
+	}
+
+	if (ShapeB.Type == EPhysicsShapeType::Polygon)
+	{
+		// Collide the other way around, then flip the normal back to point from A to B.
+		if (CollidePolygonCircle(ShapeB, TransformB, ShapeA, TransformA, OutManifold) == false)
+		{
+			return false;
+		}
+
+		OutManifold.Normal = -OutManifold.Normal;
+		return true;
+	}
+
+	return CollideCircles(ShapeA, TransformA, ShapeB, TransformB, OutManifold);
+}
+
+// =============================================
+// TIME OF IMPACT
+// =============================================
+
+float ComputeSeparation(const FPhysicsShape& ShapeA, const FPhysicsTransform& TransformA, const FPhysicsShape& ShapeB, const FPhysicsTransform& TransformB, FVector2& OutNormal)
+{
+	if (ShapeA.Type == EPhysicsShapeType::Polygon)
+	{
+		return ShapeB.Type == EPhysicsShapeType::Polygon
+			? PolygonSeparation(ShapeA, TransformA, ShapeB, TransformB, OutNormal)
+			: PolygonCircleSeparation(ShapeA, TransformA, ShapeB, TransformB, OutNormal);
+	}
+
+	if (ShapeB.Type == EPhysicsShapeType::Polygon)
+	{
+		const float Separation = PolygonCircleSeparation(ShapeB, TransformB, ShapeA, TransformA, OutNormal);
+		OutNormal = -OutNormal;
+		return Separation;
+	}
+
+	const FVector2 Offset = TransformB.Position - TransformA.Position;
+	const float Distance = Offset.Length();
+
+	// Exactly coincident circles have no direction to separate along, so pick one.
+	OutNormal = Distance > SMath::EPSILON ? Offset / Distance : FVector2(0.f, 1.f);
+	return Distance - ShapeA.Radius - ShapeB.Radius;
+}
+
+bool SweepBox(const FBox2D& Box, const FVector2& Displacement, const FBox2D& Target, float& OutTime)
+{
+	// Slab test per axis: the interval of time over which the boxes overlap along it, intersected over both axes.
+	float EnterTime = 0.f;
+	float ExitTime = 1.f;
+	for (int Axis = 0; Axis < 2; ++Axis)
+	{
+		const float BoxMin = Axis == 0 ? Box.Min.x : Box.Min.y;
+		const float BoxMax = Axis == 0 ? Box.Max.x : Box.Max.y;
+		const float TargetMin = Axis == 0 ? Target.Min.x : Target.Min.y;
+		const float TargetMax = Axis == 0 ? Target.Max.x : Target.Max.y;
+		const float Delta = Axis == 0 ? Displacement.x : Displacement.y;
+
+		if (SMath::Abs(Delta) <= SMath::EPSILON)
+		{
+			if (BoxMax < TargetMin || BoxMin > TargetMax)
+			{
+				return false;
+			}
+			continue;
+		}
+
+		float AxisEnter = (TargetMin - BoxMax) / Delta;
+		float AxisExit = (TargetMax - BoxMin) / Delta;
+		if (AxisEnter > AxisExit)
+		{
+			std::swap(AxisEnter, AxisExit);
+		}
+
+		EnterTime = SMath::Max(EnterTime, AxisEnter);
+		ExitTime = SMath::Min(ExitTime, AxisExit);
+		if (EnterTime > ExitTime)
+		{
+			return false;
+		}
+	}
+
+	OutTime = EnterTime;
+	return true;
+}
+
+bool SweepCircle(const FVector2& Centre, const float Radius, const FVector2& Displacement, const FVector2& TargetCentre, const float TargetRadius, float& OutTime)
+{
+	// Solve |Offset - Displacement * t| = RadiusSum for the smaller t.
+	const FVector2 Offset = TargetCentre - Centre;
+	const float RadiusSum = Radius + TargetRadius;
+	const float C = Offset.Dot(Offset) - RadiusSum * RadiusSum;
+	if (C <= 0.f)
+	{
+		OutTime = 0.f;
+		return true;
+	}
+
+	const float A = Displacement.Dot(Displacement);
+	const float B = Offset.Dot(Displacement);
+	const float Discriminant = B * B - A * C;
+	if (B <= 0.f || Discriminant < 0.f)
+	{
+		// Moving away, or passing by.
+		return false;
+	}
+
+	const float Time = (B - SMath::Sqrt(Discriminant)) / A;
+	if (Time > 1.f)
+	{
+		return false;
+	}
+
+	OutTime = Time;
+	return true;
+}
+
+bool ComputeTimeOfImpact(const FPhysicsShape& ShapeA, const FPhysicsSweep& SweepA, const FPhysicsShape& ShapeB, const FPhysicsSweep& SweepB, const float TargetSeparation, const float Tolerance, float& OutTime)
+{
+	constexpr Uint32 MAX_ITERATIONS = 20;
+
+	// No point of either shape moves further than this over the whole sweep by turning. Circles turn in place.
+	const auto GetRotationBound = [](const FPhysicsShape& Shape, const FPhysicsSweep& Sweep)
+	{
+		if (Shape.Type == EPhysicsShapeType::Circle)
+		{
+			return 0.f;
+		}
+
+		float MinExtent;
+		float MaxExtent;
+		Shape.ComputeExtents(MinExtent, MaxExtent);
+		return SMath::Abs(Sweep.EndAngle - Sweep.StartAngle) * MaxExtent;
+	};
+	const float RotationBound = GetRotationBound(ShapeA, SweepA) + GetRotationBound(ShapeB, SweepB);
+	const FVector2 RelativeDisplacement = (SweepB.EndPosition - SweepB.StartPosition) - (SweepA.EndPosition - SweepA.StartPosition);
+
+	float Time = 0.f;
+	for (Uint32 Iteration = 0; Iteration < MAX_ITERATIONS; ++Iteration)
+	{
+		FVector2 Normal;
+		const float Separation = ComputeSeparation(ShapeA, SweepA.GetTransform(Time), ShapeB, SweepB.GetTransform(Time), Normal);
+		if (Separation <= TargetSeparation + Tolerance)
+		{
+			OutTime = Time;
+			return true;
+		}
+
+		// While translating, separation is a convex function of time, so it never closes faster than it does now along
+		// the separating direction. Turning can add to that, by at most RotationBound.
+		const float ClosingBound = SMath::Max(-RelativeDisplacement.Dot(Normal), 0.f) + RotationBound;
+		if (ClosingBound <= SMath::EPSILON)
+		{
+			return false;
+		}
+
+		Time += (Separation - TargetSeparation) / ClosingBound;
+		if (Time >= 1.f)
+		{
+			return false;
+		}
+	}
+
+	OutTime = Time;
+	return true;
+}
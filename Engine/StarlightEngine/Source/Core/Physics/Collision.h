@@ -0,0 +1,91 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <SDL3/SDL_stdinc.h>
+
+// Starlight Engine
+#include "PhysicsTypes.h"
+
+struct FContactPoint
+{
+	// World position of the contact.
+	FVector2 Position;
+
+	// Distance between the shapes along the normal, negative while they overlap.
+	float Separation = 0.f;
+
+	// Identifies the pair of features (edges, vertices) that made the point, so it can be matched from step to step.
+	Uint32 FeatureId = 0;
+};
+
+// Up to two contact points sharing one normal, enough for any pair of convex 2D shapes.
+struct FContactManifold
+{
+	// Unit vector from the first shape towards the second.
+	FVector2 Normal;
+
+	FContactPoint Points[2];
+	Uint32 PointCount = 0;
+};
+
+/**
+ * @brief Separating axis test between two shapes, generating the contact points if they touch.
+ * Polygon pairs clip the most anti-parallel edge of one against the face of least penetration on the other, which gives
+ * stable two-point contacts for resting boxes.
+ * @returns whether the shapes touch. OutManifold is only written if they do.
+ */
+bool CollideShapes(const FPhysicsShape& ShapeA, const FPhysicsTransform& TransformA, const FPhysicsShape& ShapeB, const FPhysicsTransform& TransformB, FContactManifold& OutManifold);
+
+// =============================================
+// TIME OF IMPACT
+// =============================================
+
+// A shape's motion over one step, moving and turning at a constant rate from the start to the end pose.
+struct FPhysicsSweep
+{
+	FVector2 StartPosition;
+	FVector2 EndPosition;
+
+	// Radians.
+	float StartAngle = 0.f;
+	float EndAngle = 0.f;
+
+	// Pose at Time, from 0 at the start to 1 at the end.
+	FPhysicsTransform GetTransform(const float Time) const
+	{
+		return FPhysicsTransform(SMath::Lerp(StartPosition, EndPosition, Time), SMath::Lerp(StartAngle, EndAngle, Time));
+	}
+};
+
+/**
+ * @brief Distance between two shapes, or the negated depth of the shallowest way out while they overlap.
+ * @param OutNormal Unit direction from A towards B along which the separation is measured.
+ */
+float ComputeSeparation(const FPhysicsShape& ShapeA, const FPhysicsTransform& TransformA, const FPhysicsShape& ShapeB, const FPhysicsTransform& TransformB, FVector2& OutNormal);
+
+/**
+ * @brief Swept AABB test: when Box, moved by Displacement, first touches Target.
+ * @returns whether they touch within the move, with OutTime from 0 at the start to 1 at the end. Boxes that already
+ * overlap touch at 0.
+ */
+bool SweepBox(const FBox2D& Box, const FVector2& Displacement, const FBox2D& Target, float& OutTime);
+
+/**
+ * @brief Swept circle test: when a circle, moved by Displacement, first touches a circle standing still.
+ * @returns whether they touch within the move, with OutTime from 0 at the start to 1 at the end. Circles that already
+ * overlap touch at 0.
+ */
+bool SweepCircle(const FVector2& Centre, float Radius, const FVector2& Displacement, const FVector2& TargetCentre, float TargetRadius, float& OutTime);
+
+/**
+ * @brief Finds when two moving shapes first come within TargetSeparation, by conservative advancement: each iteration
+ * measures the separation and moves time forward by as much as the shapes could possibly close it, so the result never
+ * lies past the true time of impact.
+ * Converges in a few iterations unless the shapes spin quickly. If it runs out of iterations, the last time reached is
+ * returned, which is still safe, just early.
+ * @param Tolerance How far above TargetSeparation counts as arrived.
+ * @returns whether the shapes come that close within the sweeps, with OutTime from 0 at the start to 1 at the end.
+ */
+bool ComputeTimeOfImpact(const FPhysicsShape& ShapeA, const FPhysicsSweep& SweepA, const FPhysicsShape& ShapeB, const FPhysicsSweep& SweepB, float TargetSeparation, float Tolerance, float& OutTime);
@@ -0,0 +1,858 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "PhysicsScene.h"
+
+// Libraries
+#include <algorithm>
+#include <numeric>
+
+// Starlight Engine
+#include "Framework/TaskSystem.h"
+#include "Object/World.h"
+
+namespace
+{
+float Cross(const FVector2& A, const FVector2& B)
+{
+	return A.x * B.y - A.y * B.x;
+}
+
+// Angular velocity crossed with an offset: the linear velocity of a point rotating about the origin.
+FVector2 Cross(const float AngularVelocity, const FVector2& Offset)
+{
+	return FVector2(-AngularVelocity * Offset.y, AngularVelocity * Offset.x);
+}
+
+Uint64 MakePairKey(const FPhysicsBodyId BodyIdA, const FPhysicsBodyId BodyIdB)
+{
+	return (static_cast<Uint64>(BodyIdA) << 32) | BodyIdB;
+}
+
+// Calls Function(Begin, End) for ChunkCount even slices of [0, Count), in parallel.
+template <typename TFunction>
+void ParallelForChunks(const Uint32 Count, const Uint32 ChunkCount, TFunction&& Function)
+{
+	FTaskSystem::ParallelFor(ChunkCount, [&](const Uint32 ChunkIndex)
+	{
+		const Uint32 Begin = static_cast<Uint32>(static_cast<Uint64>(Count) * ChunkIndex / ChunkCount);
+		const Uint32 End = static_cast<Uint32>(static_cast<Uint64>(Count) * (ChunkIndex + 1) / ChunkCount);
+		Function(Begin, End);
+	});
+}
+}
+
+FPhysicsScene::FPhysicsScene(const FPhysicsSettings& InSettings)
+	: Settings(InSettings)
+{
+	//
+}
+
+// =============================================
+// BODIES
+// =============================================
+
+FPhysicsBodyId FPhysicsScene::CreateBody(const FPhysicsBodyDesc& Desc)
+{
+	const FPhysicsBodyId BodyId = AllocateBodyId();
+	const Uint32 Index = static_cast<Uint32>(BodyIds.size());
+	BodyIndices[BodyId] = Index;
+
+	float InverseMass = 0.f;
+	float InverseInertia = 0.f;
+	if (Desc.Type == EPhysicsBodyType::Dynamic)
+	{
+		float Mass;
+		float Inertia;
+		Desc.Shape.ComputeMass(Desc.Density, Mass, Inertia);
+
+		// A dynamic body always has some mass, or it would behave as a static one.
+		InverseMass = Mass > SMath::EPSILON ? 1.f / Mass : 1.f;
+		InverseInertia = Desc.bFixedRotation == false && Inertia > SMath::EPSILON ? 1.f / Inertia : 0.f;
+	}
+
+	const float Angle = SMath::DegreesToRadians(Desc.Rotation);
+
+	BodyIds.push_back(BodyId);
+	Types.push_back(Desc.Type);
+	Shapes.push_back(Desc.Shape);
+	Positions.push_back(Desc.Position);
+	Angles.push_back(Angle);
+	PreviousPositions.push_back(Desc.Position);
+	PreviousAngles.push_back(Angle);
+	LinearVelocities.push_back(Desc.Type == EPhysicsBodyType::Static ? FVector2(0.f) : Desc.LinearVelocity);
+	AngularVelocities.push_back(Desc.Type == EPhysicsBodyType::Static ? 0.f : SMath::DegreesToRadians(Desc.AngularVelocity));
+	Forces.emplace_back(0.f);
+	InverseMasses.push_back(InverseMass);
+	InverseInertias.push_back(InverseInertia);
+	Frictions.push_back(Desc.Friction);
+	Restitutions.push_back(Desc.Restitution);
+	Bounds.push_back(Desc.Shape.ComputeBounds(FPhysicsTransform(Desc.Position, Angle)));
+	EntityIds.push_back(Desc.EntityId);
+	Bullets.push_back(Desc.bBullet ? 1 : 0);
+
+	// Sorted into place by the next step.
+	SortedBodies.push_back(Index);
+
+	return BodyId;
+}
+
+bool FPhysicsScene::DestroyBody(const FPhysicsBodyId BodyId)
+{
+	const Uint32 Index = GetBodyIndex(BodyId);
+	if (Index == INVALID_ENTITY_INDEX)
+	{
+		return false;
+	}
+
+	// Swap the last body into the hole so the arrays stay dense.
+	const Uint32 LastIndex = static_cast<Uint32>(BodyIds.size()) - 1;
+	const auto RemoveAt = [Index, LastIndex](auto& Array)
+	{
+		Array[Index] = Array[LastIndex];
+		Array.pop_back();
+	};
+
+	BodyIndices[BodyIds[LastIndex]] = Index;
+	RemoveAt(BodyIds);
+	RemoveAt(Types);
+	RemoveAt(Shapes);
+	RemoveAt(Positions);
+	RemoveAt(Angles);
+	RemoveAt(PreviousPositions);
+	RemoveAt(PreviousAngles);
+	RemoveAt(LinearVelocities);
+	RemoveAt(AngularVelocities);
+	RemoveAt(Forces);
+	RemoveAt(InverseMasses);
+	RemoveAt(InverseInertias);
+	RemoveAt(Frictions);
+	RemoveAt(Restitutions);
+	RemoveAt(Bounds);
+	RemoveAt(EntityIds);
+	RemoveAt(Bullets);
+
+	std::erase(SortedBodies, Index);
+	std::replace(SortedBodies.begin(), SortedBodies.end(), LastIndex, Index);
+
+	// The ID may be reused before the next step, which must not inherit this body's contacts.
+	std::erase_if(ImpulseCache, [BodyId](const auto& Entry)
+	{
+		return static_cast<FPhysicsBodyId>(Entry.first >> 32) == BodyId || static_cast<FPhysicsBodyId>(Entry.first) == BodyId;
+	});
+
+	BodyIndices[BodyId] = INVALID_ENTITY_INDEX;
+	FreeBodyIds.push_back(BodyId);
+	return true;
+}
+
+void FPhysicsScene::DestroyAllBodies()
+{
+	BodyIds.clear();
+	BodyIndices.clear();
+	FreeBodyIds.clear();
+	Types.clear();
+	Shapes.clear();
+	Positions.clear();
+	Angles.clear();
+	PreviousPositions.clear();
+	PreviousAngles.clear();
+	LinearVelocities.clear();
+	AngularVelocities.clear();
+	Forces.clear();
+	InverseMasses.clear();
+	InverseInertias.clear();
+	Frictions.clear();
+	Restitutions.clear();
+	Bounds.clear();
+	EntityIds.clear();
+	Bullets.clear();
+	SortedBodies.clear();
+	Pairs.clear();
+	Contacts.clear();
+	Islands.clear();
+	ImpulseCache.clear();
+}
+
+FVector2 FPhysicsScene::GetPosition(const FPhysicsBodyId BodyId) const
+{
+	const Uint32 Index = GetBodyIndex(BodyId);
+	return Index != INVALID_ENTITY_INDEX ? Positions[Index] : FVector2(0.f);
+}
+
+float FPhysicsScene::GetRotation(const FPhysicsBodyId BodyId) const
+{
+	const Uint32 Index = GetBodyIndex(BodyId);
+	return Index != INVALID_ENTITY_INDEX ? SMath::RadiansToDegrees(Angles[Index]) : 0.f;
+}
+
+void FPhysicsScene::SetTransform(const FPhysicsBodyId BodyId, const FVector2& Position, const float Rotation)
+{
+	const Uint32 Index = GetBodyIndex(BodyId);
+	if (Index != INVALID_ENTITY_INDEX)
+	{
+		Positions[Index] = Position;
+		Angles[Index] = SMath::DegreesToRadians(Rotation);
+		PreviousPositions[Index] = Positions[Index];
+		PreviousAngles[Index] = Angles[Index];
+		Bounds[Index] = Shapes[Index].ComputeBounds(FPhysicsTransform(Positions[Index], Angles[Index]));
+	}
+}
+
+FVector2 FPhysicsScene::GetLinearVelocity(const FPhysicsBodyId BodyId) const
+{
+	const Uint32 Index = GetBodyIndex(BodyId);
+	return Index != INVALID_ENTITY_INDEX ? LinearVelocities[Index] : FVector2(0.f);
+}
+
+void FPhysicsScene::SetLinearVelocity(const FPhysicsBodyId BodyId, const FVector2& Velocity)
+{
+	const Uint32 Index = GetBodyIndex(BodyId);
+	if (Index != INVALID_ENTITY_INDEX && Types[Index] != EPhysicsBodyType::Static)
+	{
+		LinearVelocities[Index] = Velocity;
+	}
+}
+
+void FPhysicsScene::ApplyForce(const FPhysicsBodyId BodyId, const FVector2& Force)
+{
+	const Uint32 Index = GetBodyIndex(BodyId);
+	if (Index != INVALID_ENTITY_INDEX)
+	{
+		Forces[Index] += Force;
+	}
+}
+
+void FPhysicsScene::ApplyImpulse(const FPhysicsBodyId BodyId, const FVector2& Impulse, const FVector2& WorldPoint)
+{
+	const Uint32 Index = GetBodyIndex(BodyId);
+	if (Index != INVALID_ENTITY_INDEX)
+	{
+		LinearVelocities[Index] += Impulse * InverseMasses[Index];
+		AngularVelocities[Index] += InverseInertias[Index] * Cross(WorldPoint - Positions[Index], Impulse);
+	}
+}
+
+Uint32 FPhysicsScene::GetBodyIndex(const FPhysicsBodyId BodyId) const
+{
+	return BodyId < BodyIndices.size() ? BodyIndices[BodyId] : INVALID_ENTITY_INDEX;
+}
+
+FPhysicsBodyId FPhysicsScene::AllocateBodyId()
+{
+	if (FreeBodyIds.empty() == false)
+	{
+		const FPhysicsBodyId BodyId = FreeBodyIds.back();
+		FreeBodyIds.pop_back();
+		return BodyId;
+	}
+
+	BodyIndices.push_back(INVALID_ENTITY_INDEX);
+	return static_cast<FPhysicsBodyId>(BodyIndices.size() - 1);
+}
+
+// =============================================
+// SIMULATION
+// =============================================
+
+Uint32 FPhysicsScene::Advance(const float DeltaTime)
+{
+	Accumulator += DeltaTime;
+
+	Uint32 StepCount = 0;
+	while (Accumulator >= Settings.FixedTimeStep && StepCount < Settings.MaxStepsPerFrame)
+	{
+		Step();
+		Accumulator -= Settings.FixedTimeStep;
+		++StepCount;
+	}
+
+	// Out of steps for this frame, so the simulation falls behind real time instead of trying to catch up.
+	if (Accumulator >= Settings.FixedTimeStep)
+	{
+		Accumulator = SMath::Mod(Accumulator, Settings.FixedTimeStep);
+	}
+
+	return StepCount;
+}
+
+void FPhysicsScene::Step()
+{
+	const float TimeStep = Settings.FixedTimeStep;
+
+	PreviousPositions = Positions;
+	PreviousAngles = Angles;
+
+	IntegrateVelocities(TimeStep);
+	FindPairs();
+	FindContacts(TimeStep);
+	BuildIslands();
+
+	// Islands share no dynamic bodies, so they can be solved at the same time.
+	FTaskSystem::ParallelFor(static_cast<Uint32>(Islands.size()), [this](const Uint32 IslandIndex)
+	{
+		SolveIsland(Islands[IslandIndex]);
+	});
+
+	IntegratePositions(TimeStep);
+
+	// Bounds are kept up to date between steps, for the sweeps below and the next step's pairs.
+	UpdateBounds();
+	SolveContinuous();
+	StoreImpulses();
+}
+
+void FPhysicsScene::WriteTransforms(SWorld& World) const
+{
+	const float Alpha = GetInterpolationAlpha();
+	for (size_t Index = 0; Index < BodyIds.size(); ++Index)
+	{
+		if (EntityIds[Index] == INVALID_ENTITY_ID)
+		{
+			continue;
+		}
+
+		if (FTransform2D* Transform = World.GetTransform(EntityIds[Index]))
+		{
+			Transform->Position = SMath::Lerp(PreviousPositions[Index], Positions[Index], Alpha);
+			Transform->Rotation = SMath::RadiansToDegrees(SMath::Lerp(PreviousAngles[Index], Angles[Index], Alpha));
+		}
+	}
+}
+
+Uint32 FPhysicsScene::GetChunkCount() const
+{
+	return GetBodyCount() >= PARALLEL_BODY_THRESHOLD ? FTaskSystem::GetWorkerCount() + 1 : 1;
+}
+
+void FPhysicsScene::IntegrateVelocities(const float TimeStep)
+{
+	for (size_t Index = 0; Index < BodyIds.size(); ++Index)
+	{
+		if (Types[Index] == EPhysicsBodyType::Dynamic)
+		{
+			LinearVelocities[Index] += (Settings.Gravity + Forces[Index] * InverseMasses[Index]) * TimeStep;
+		}
+		Forces[Index] = FVector2(0.f);
+	}
+}
+
+void FPhysicsScene::UpdateBounds()
+{
+	ParallelForChunks(GetBodyCount(), GetChunkCount(), [this](const Uint32 Begin, const Uint32 End)
+	{
+		for (Uint32 Index = Begin; Index < End; ++Index)
+		{
+			Bounds[Index] = Shapes[Index].ComputeBounds(FPhysicsTransform(Positions[Index], Angles[Index]));
+		}
+	});
+}
+
+void FPhysicsScene::SortBodies()
+{
+	// Insertion sort, which is close to linear since bodies only move a little per step.
+	for (size_t SortedIndex = 1; SortedIndex < SortedBodies.size(); ++SortedIndex)
+	{
+		const Uint32 BodyIndex = SortedBodies[SortedIndex];
+		const float MinX = Bounds[BodyIndex].Min.x;
+
+		size_t Hole = SortedIndex;
+		while (Hole > 0 && Bounds[SortedBodies[Hole - 1]].Min.x > MinX)
+		{
+			SortedBodies[Hole] = SortedBodies[Hole - 1];
+			--Hole;
+		}
+		SortedBodies[Hole] = BodyIndex;
+	}
+}
+
+void FPhysicsScene::FindPairs()
+{
+	SortBodies();
+
+	// Sweep: each body is paired with the bodies after it whose range along x starts before its own ends. Every chunk
+	// sweeps from its own slice of bodies into its own list, so the lists come out the same however they are scheduled.
+	const Uint32 ChunkCount = GetChunkCount();
+	if (PairChunks.size() < ChunkCount)
+	{
+		PairChunks.resize(ChunkCount);
+	}
+
+	const Uint32 BodyCount = GetBodyCount();
+	FTaskSystem::ParallelFor(ChunkCount, [&](const Uint32 ChunkIndex)
+	{
+		std::vector<FBodyPair>& ChunkPairs = PairChunks[ChunkIndex];
+		ChunkPairs.clear();
+
+		const Uint32 Begin = static_cast<Uint32>(static_cast<Uint64>(BodyCount) * ChunkIndex / ChunkCount);
+		const Uint32 End = static_cast<Uint32>(static_cast<Uint64>(BodyCount) * (ChunkIndex + 1) / ChunkCount);
+		for (Uint32 SortedIndex = Begin; SortedIndex < End; ++SortedIndex)
+		{
+			const Uint32 IndexA = SortedBodies[SortedIndex];
+			const FBox2D& BoundsA = Bounds[IndexA];
+
+			for (Uint32 OtherIndex = SortedIndex + 1; OtherIndex < BodyCount; ++OtherIndex)
+			{
+				const Uint32 IndexB = SortedBodies[OtherIndex];
+				const FBox2D& BoundsB = Bounds[IndexB];
+				if (BoundsB.Min.x > BoundsA.Max.x)
+				{
+					break;
+				}
+
+				// Bodies that cannot be moved by the contact have nothing to solve.
+				if (BoundsA.Min.y > BoundsB.Max.y || BoundsB.Min.y > BoundsA.Max.y
+					|| (Types[IndexA] != EPhysicsBodyType::Dynamic && Types[IndexB] != EPhysicsBodyType::Dynamic))
+				{
+					continue;
+				}
+
+				// Ordered by body ID, which stays the same while indices get shuffled, so cached impulses keep matching.
+				ChunkPairs.push_back(BodyIds[IndexA] < BodyIds[IndexB] ? FBodyPair{IndexA, IndexB} : FBodyPair{IndexB, IndexA});
+			}
+		}
+	});
+
+	Pairs.clear();
+	for (Uint32 ChunkIndex = 0; ChunkIndex < ChunkCount; ++ChunkIndex)
+	{
+		Pairs.insert(Pairs.end(), PairChunks[ChunkIndex].begin(), PairChunks[ChunkIndex].end());
+	}
+}
+
+void FPhysicsScene::FindContacts(const float TimeStep)
+{
+	const Uint32 PairCount = static_cast<Uint32>(Pairs.size());
+	Manifolds.resize(PairCount);
+
+	ParallelForChunks(PairCount, GetChunkCount(), [this](const Uint32 Begin, const Uint32 End)
+	{
+		for (Uint32 PairIndex = Begin; PairIndex < End; ++PairIndex)
+		{
+			const FBodyPair& Pair = Pairs[PairIndex];
+			const FPhysicsTransform TransformA(Positions[Pair.IndexA], Angles[Pair.IndexA]);
+			const FPhysicsTransform TransformB(Positions[Pair.IndexB], Angles[Pair.IndexB]);
+
+			FContactManifold& Manifold = Manifolds[PairIndex];
+			if (CollideShapes(Shapes[Pair.IndexA], TransformA, Shapes[Pair.IndexB], TransformB, Manifold) == false)
+			{
+				Manifold.PointCount = 0;
+			}
+		}
+	});
+
+	Contacts.clear();
+	for (Uint32 PairIndex = 0; PairIndex < PairCount; ++PairIndex)
+	{
+		const FContactManifold& Manifold = Manifolds[PairIndex];
+		if (Manifold.PointCount == 0)
+		{
+			continue;
+		}
+
+		const Uint32 IndexA = Pairs[PairIndex].IndexA;
+		const Uint32 IndexB = Pairs[PairIndex].IndexB;
+		const float InverseMassSum = InverseMasses[IndexA] + InverseMasses[IndexB];
+		const float Restitution = SMath::Max(Restitutions[IndexA], Restitutions[IndexB]);
+		const FVector2 Tangent(Manifold.Normal.y, -Manifold.Normal.x);
+
+		const auto Cached = ImpulseCache.find(MakePairKey(BodyIds[IndexA], BodyIds[IndexB]));
+
+		FContactConstraint& Contact = Contacts.emplace_back();
+		Contact.IndexA = IndexA;
+		Contact.IndexB = IndexB;
+		Contact.Normal = Manifold.Normal;
+		Contact.Friction = SMath::Sqrt(Frictions[IndexA] * Frictions[IndexB]);
+		Contact.PointCount = Manifold.PointCount;
+
+		for (Uint32 PointIndex = 0; PointIndex < Manifold.PointCount; ++PointIndex)
+		{
+			const FContactPoint& ManifoldPoint = Manifold.Points[PointIndex];
+			FContactConstraintPoint& Point = Contact.Points[PointIndex];
+			Point = FContactConstraintPoint();
+			Point.OffsetA = ManifoldPoint.Position - Positions[IndexA];
+			Point.OffsetB = ManifoldPoint.Position - Positions[IndexB];
+			Point.FeatureId = ManifoldPoint.FeatureId;
+
+			const float NormalCrossA = Cross(Point.OffsetA, Manifold.Normal);
+			const float NormalCrossB = Cross(Point.OffsetB, Manifold.Normal);
+			const float NormalMass = InverseMassSum + InverseInertias[IndexA] * NormalCrossA * NormalCrossA + InverseInertias[IndexB] * NormalCrossB * NormalCrossB;
+			Point.NormalMass = NormalMass > 0.f ? 1.f / NormalMass : 0.f;
+
+			const float TangentCrossA = Cross(Point.OffsetA, Tangent);
+			const float TangentCrossB = Cross(Point.OffsetB, Tangent);
+			const float TangentMass = InverseMassSum + InverseInertias[IndexA] * TangentCrossA * TangentCrossA + InverseInertias[IndexB] * TangentCrossB * TangentCrossB;
+			Point.TangentMass = TangentMass > 0.f ? 1.f / TangentMass : 0.f;
+
+			// Bounce off fast impacts, and push apart overlap beyond the slop. Whichever asks for more wins, so
+			// correcting overlap never adds to a bounce.
+			const float ClosingSpeed = GetRelativeVelocity(Contact, Point).Dot(Manifold.Normal);
+			const float BounceBias = ClosingSpeed < -Settings.RestitutionThreshold ? -Restitution * ClosingSpeed : 0.f;
+			const float OverlapBias = Settings.Baumgarte / TimeStep * SMath::Max(0.f, -ManifoldPoint.Separation - Settings.LinearSlop);
+			Point.VelocityBias = SMath::Max(BounceBias, OverlapBias);
+
+			if (Cached != ImpulseCache.end())
+			{
+				for (Uint32 CachedIndex = 0; CachedIndex < Cached->second.PointCount; ++CachedIndex)
+				{
+					if (Cached->second.FeatureIds[CachedIndex] == Point.FeatureId)
+					{
+						Point.NormalImpulse = Cached->second.NormalImpulses[CachedIndex];
+						Point.TangentImpulse = Cached->second.TangentImpulses[CachedIndex];
+						break;
+					}
+				}
+			}
+		}
+
+		if (Contact.PointCount == 2)
+		{
+			const float Cross1A = Cross(Contact.Points[0].OffsetA, Contact.Normal);
+			const float Cross1B = Cross(Contact.Points[0].OffsetB, Contact.Normal);
+			const float Cross2A = Cross(Contact.Points[1].OffsetA, Contact.Normal);
+			const float Cross2B = Cross(Contact.Points[1].OffsetB, Contact.Normal);
+
+			Contact.K11 = InverseMassSum + InverseInertias[IndexA] * Cross1A * Cross1A + InverseInertias[IndexB] * Cross1B * Cross1B;
+			Contact.K22 = InverseMassSum + InverseInertias[IndexA] * Cross2A * Cross2A + InverseInertias[IndexB] * Cross2B * Cross2B;
+			Contact.K12 = InverseMassSum + InverseInertias[IndexA] * Cross1A * Cross2A + InverseInertias[IndexB] * Cross1B * Cross2B;
+
+			// Points so close together that the matrix is near singular act as one, so keep only the deeper.
+			constexpr float MAX_CONDITION_NUMBER = 1000.f;
+			const float Determinant = Contact.K11 * Contact.K22 - Contact.K12 * Contact.K12;
+			if (Contact.K11 * Contact.K11 < MAX_CONDITION_NUMBER * Determinant)
+			{
+				Contact.InverseK11 = Contact.K22 / Determinant;
+				Contact.InverseK12 = -Contact.K12 / Determinant;
+				Contact.InverseK22 = Contact.K11 / Determinant;
+			}
+			else
+			{
+				if (Manifold.Points[1].Separation < Manifold.Points[0].Separation)
+				{
+					Contact.Points[0] = Contact.Points[1];
+				}
+				Contact.PointCount = 1;
+			}
+		}
+	}
+}
+
+void FPhysicsScene::BuildIslands()
+{
+	const Uint32 BodyCount = GetBodyCount();
+	IslandParents.resize(BodyCount);
+	std::iota(IslandParents.begin(), IslandParents.end(), 0u);
+
+	const auto FindRoot = [this](Uint32 Index)
+	{
+		while (IslandParents[Index] != Index)
+		{
+			// Path halving keeps the trees flat.
+			IslandParents[Index] = IslandParents[IslandParents[Index]];
+			Index = IslandParents[Index];
+		}
+		return Index;
+	};
+
+	// Only dynamic bodies join islands. Static and kinematic bodies are never written by the solver, so any number of
+	// islands can share them.
+	for (const FContactConstraint& Contact : Contacts)
+	{
+		if (Types[Contact.IndexA] == EPhysicsBodyType::Dynamic && Types[Contact.IndexB] == EPhysicsBodyType::Dynamic)
+		{
+			IslandParents[FindRoot(Contact.IndexA)] = FindRoot(Contact.IndexB);
+		}
+	}
+
+	// Bucket the contacts by island, keeping their order within each island. The island's slot in IslandParents is
+	// reused to map its root to its island index once the roots are final.
+	std::vector<Uint32>& ContactRoots = IslandContacts;
+	ContactRoots.resize(Contacts.size());
+	for (size_t ContactIndex = 0; ContactIndex < Contacts.size(); ++ContactIndex)
+	{
+		const FContactConstraint& Contact = Contacts[ContactIndex];
+		ContactRoots[ContactIndex] = FindRoot(Types[Contact.IndexA] == EPhysicsBodyType::Dynamic ? Contact.IndexA : Contact.IndexB);
+	}
+
+	Islands.clear();
+	std::vector<Uint32> RootIslands(BodyCount, INVALID_ENTITY_INDEX);
+	std::vector<Uint32> ContactIslands(Contacts.size());
+	for (size_t ContactIndex = 0; ContactIndex < Contacts.size(); ++ContactIndex)
+	{
+		Uint32& IslandIndex = RootIslands[ContactRoots[ContactIndex]];
+		if (IslandIndex == INVALID_ENTITY_INDEX)
+		{
+			IslandIndex = static_cast<Uint32>(Islands.size());
+			Islands.push_back({0, 0});
+		}
+
+		ContactIslands[ContactIndex] = IslandIndex;
+		++Islands[IslandIndex].ContactCount;
+	}
+
+	Uint32 FirstContact = 0;
+	for (FIsland& Island : Islands)
+	{
+		Island.FirstContact = FirstContact;
+		FirstContact += Island.ContactCount;
+		Island.ContactCount = 0;
+	}
+
+	IslandContacts.resize(Contacts.size());
+	for (size_t ContactIndex = 0; ContactIndex < Contacts.size(); ++ContactIndex)
+	{
+		FIsland& Island = Islands[ContactIslands[ContactIndex]];
+		IslandContacts[Island.FirstContact + Island.ContactCount++] = static_cast<Uint32>(ContactIndex);
+	}
+}
+
+void FPhysicsScene::SolveIsland(const FIsland& Island)
+{
+	const Uint32* const ContactIndices = IslandContacts.data() + Island.FirstContact;
+
+	// Warm start from last step's impulses.
+	for (Uint32 Index = 0; Index < Island.ContactCount; ++Index)
+	{
+		const FContactConstraint& Contact = Contacts[ContactIndices[Index]];
+		const FVector2 Tangent(Contact.Normal.y, -Contact.Normal.x);
+		for (Uint32 PointIndex = 0; PointIndex < Contact.PointCount; ++PointIndex)
+		{
+			const FContactConstraintPoint& Point = Contact.Points[PointIndex];
+			ApplyContactImpulse(Contact, Point, Contact.Normal * Point.NormalImpulse + Tangent * Point.TangentImpulse);
+		}
+	}
+
+	for (Uint32 Iteration = 0; Iteration < Settings.VelocityIterations; ++Iteration)
+	{
+		for (Uint32 Index = 0; Index < Island.ContactCount; ++Index)
+		{
+			FContactConstraint& Contact = Contacts[ContactIndices[Index]];
+			const FVector2 Tangent(Contact.Normal.y, -Contact.Normal.x);
+
+			// Friction first, limited by the normal impulse from the previous iteration.
+			for (Uint32 PointIndex = 0; PointIndex < Contact.PointCount; ++PointIndex)
+			{
+				FContactConstraintPoint& Point = Contact.Points[PointIndex];
+				const float MaxFriction = Contact.Friction * Point.NormalImpulse;
+				const float OldTangentImpulse = Point.TangentImpulse;
+				Point.TangentImpulse = SMath::Clamp(OldTangentImpulse - Point.TangentMass * GetRelativeVelocity(Contact, Point).Dot(Tangent), -MaxFriction, MaxFriction);
+				ApplyContactImpulse(Contact, Point, Tangent * (Point.TangentImpulse - OldTangentImpulse));
+			}
+
+			if (Contact.PointCount == 2)
+			{
+				SolveNormalBlock(Contact);
+				continue;
+			}
+
+			// Accumulated impulses may only ever push apart, but individual iterations may take some back.
+			FContactConstraintPoint& Point = Contact.Points[0];
+			const float OldNormalImpulse = Point.NormalImpulse;
+			Point.NormalImpulse = SMath::Max(OldNormalImpulse - Point.NormalMass * (GetRelativeVelocity(Contact, Point).Dot(Contact.Normal) - Point.VelocityBias), 0.f);
+			ApplyContactImpulse(Contact, Point, Contact.Normal * (Point.NormalImpulse - OldNormalImpulse));
+		}
+	}
+}
+
+void FPhysicsScene::SolveNormalBlock(FContactConstraint& Contact)
+{
+	FContactConstraintPoint& Point1 = Contact.Points[0];
+	FContactConstraintPoint& Point2 = Contact.Points[1];
+
+	// Find the new accumulated impulses X >= 0 with closing speeds K * X + B >= 0, where either the impulse or the
+	// speed is zero at each point. Two points have only four cases, tried in turn.
+	const float Old1 = Point1.NormalImpulse;
+	const float Old2 = Point2.NormalImpulse;
+	const float B1 = GetRelativeVelocity(Contact, Point1).Dot(Contact.Normal) - Point1.VelocityBias - (Contact.K11 * Old1 + Contact.K12 * Old2);
+	const float B2 = GetRelativeVelocity(Contact, Point2).Dot(Contact.Normal) - Point2.VelocityBias - (Contact.K12 * Old1 + Contact.K22 * Old2);
+
+	float New1 = 0.f;
+	float New2 = 0.f;
+
+	// Both points pushing.
+	const float Both1 = -(Contact.InverseK11 * B1 + Contact.InverseK12 * B2);
+	const float Both2 = -(Contact.InverseK12 * B1 + Contact.InverseK22 * B2);
+	if (Both1 >= 0.f && Both2 >= 0.f)
+	{
+		New1 = Both1;
+		New2 = Both2;
+	}
+	// Only the first point pushing, the second separating.
+	else if (-Point1.NormalMass * B1 >= 0.f && Contact.K12 * -Point1.NormalMass * B1 + B2 >= 0.f)
+	{
+		New1 = -Point1.NormalMass * B1;
+	}
+	// Only the second point pushing.
+	else if (-Point2.NormalMass * B2 >= 0.f && Contact.K12 * -Point2.NormalMass * B2 + B1 >= 0.f)
+	{
+		New2 = -Point2.NormalMass * B2;
+	}
+	// Neither, as long as both are separating. Otherwise the solution is beyond float precision, so keep the old one.
+	else if (B1 < 0.f || B2 < 0.f)
+	{
+		return;
+	}
+
+	Point1.NormalImpulse = New1;
+	Point2.NormalImpulse = New2;
+	ApplyContactImpulse(Contact, Point1, Contact.Normal * (New1 - Old1));
+	ApplyContactImpulse(Contact, Point2, Contact.Normal * (New2 - Old2));
+}
+
+FVector2 FPhysicsScene::GetRelativeVelocity(const FContactConstraint& Contact, const FContactConstraintPoint& Point) const
+{
+	return LinearVelocities[Contact.IndexB] + Cross(AngularVelocities[Contact.IndexB], Point.OffsetB)
+		- LinearVelocities[Contact.IndexA] - Cross(AngularVelocities[Contact.IndexA], Point.OffsetA);
+}
+
+void FPhysicsScene::ApplyContactImpulse(const FContactConstraint& Contact, const FContactConstraintPoint& Point, const FVector2& Impulse)
+{
+	// Only dynamic bodies are written, since the others may be shared with islands solving on other threads.
+	if (Types[Contact.IndexA] == EPhysicsBodyType::Dynamic)
+	{
+		LinearVelocities[Contact.IndexA] -= Impulse * InverseMasses[Contact.IndexA];
+		AngularVelocities[Contact.IndexA] -= InverseInertias[Contact.IndexA] * Cross(Point.OffsetA, Impulse);
+	}
+
+	if (Types[Contact.IndexB] == EPhysicsBodyType::Dynamic)
+	{
+		LinearVelocities[Contact.IndexB] += Impulse * InverseMasses[Contact.IndexB];
+		AngularVelocities[Contact.IndexB] += InverseInertias[Contact.IndexB] * Cross(Point.OffsetB, Impulse);
+	}
+}
+
+void FPhysicsScene::IntegratePositions(const float TimeStep)
+{
+	for (size_t Index = 0; Index < BodyIds.size(); ++Index)
+	{
+		Positions[Index] += LinearVelocities[Index] * TimeStep;
+		Angles[Index] += AngularVelocities[Index] * TimeStep;
+	}
+}
+
+void FPhysicsScene::SolveContinuous()
+{
+	// Bullets moving less than half their thickness cannot skip past anything, and are left to the contact solver.
+	SweptBullets.clear();
+	float MaxBoundsWidth = 0.f;
+	for (Uint32 Index = 0; Index < GetBodyCount(); ++Index)
+	{
+		MaxBoundsWidth = SMath::Max(MaxBoundsWidth, Bounds[Index].Max.x - Bounds[Index].Min.x);
+
+		if (Bullets[Index] != 0 && Types[Index] != EPhysicsBodyType::Static)
+		{
+			float MinExtent;
+			float MaxExtent;
+			Shapes[Index].ComputeExtents(MinExtent, MaxExtent);
+
+			const float Motion = (Positions[Index] - PreviousPositions[Index]).Length() + SMath::Abs(Angles[Index] - PreviousAngles[Index]) * MaxExtent;
+			if (Motion > 0.5f * MinExtent)
+			{
+				SweptBullets.push_back(Index);
+			}
+		}
+	}
+
+	if (SweptBullets.empty())
+	{
+		return;
+	}
+
+	// Bullets move while they are swept, so they search a copy of the sorted positions.
+	SortBodies();
+	SortedMinX.resize(SortedBodies.size());
+	for (size_t SortedIndex = 0; SortedIndex < SortedBodies.size(); ++SortedIndex)
+	{
+		SortedMinX[SortedIndex] = Bounds[SortedBodies[SortedIndex]].Min.x;
+	}
+
+	const Uint32 BulletCount = static_cast<Uint32>(SweptBullets.size());
+	const Uint32 ChunkCount = BulletCount >= PARALLEL_BULLET_THRESHOLD ? FTaskSystem::GetWorkerCount() + 1 : 1;
+	ParallelForChunks(BulletCount, ChunkCount, [this, MaxBoundsWidth](const Uint32 Begin, const Uint32 End)
+	{
+		for (Uint32 BulletIndex = Begin; BulletIndex < End; ++BulletIndex)
+		{
+			SweepBullet(SweptBullets[BulletIndex], MaxBoundsWidth);
+		}
+	});
+}
+
+void FPhysicsScene::SweepBullet(const Uint32 Index, const float MaxBoundsWidth)
+{
+	const FPhysicsShape& Shape = Shapes[Index];
+	float MinExtent;
+	float MaxExtent;
+	Shape.ComputeExtents(MinExtent, MaxExtent);
+
+	const FPhysicsSweep Sweep = {PreviousPositions[Index], Positions[Index], PreviousAngles[Index], Angles[Index]};
+	const FVector2 Displacement = Sweep.EndPosition - Sweep.StartPosition;
+
+	// Large enough for the shape at any rotation, so the box sweep stays a safe first test while the bullet turns.
+	const FBox2D StartBox = FBox2D::FromCentreExtent(Sweep.StartPosition, FVector2(MaxExtent));
+	const FBox2D SweptBox = StartBox.Union(FBox2D::FromCentreExtent(Sweep.EndPosition, FVector2(MaxExtent)));
+
+	const FPhysicsTransform StartTransform = Sweep.GetTransform(0.f);
+	const float Tolerance = 0.25f * Settings.LinearSlop;
+
+	// Bodies are sorted by minimum x, so only those starting no further left than the widest body can reach the sweep.
+	const auto First = std::lower_bound(SortedMinX.begin(), SortedMinX.end(), SweptBox.Min.x - MaxBoundsWidth);
+	const auto Last = std::upper_bound(First, SortedMinX.end(), SweptBox.Max.x);
+
+	float MinTime = 1.f;
+	for (auto It = First; It != Last; ++It)
+	{
+		// Bullets are never hit by each other, since they move during this pass. This also skips the bullet itself.
+		const Uint32 TargetIndex = SortedBodies[It - SortedMinX.begin()];
+		if (Bullets[TargetIndex] != 0)
+		{
+			continue;
+		}
+
+		float Time;
+		if (SweepBox(StartBox, Displacement, Bounds[TargetIndex], Time) == false || Time >= MinTime)
+		{
+			continue;
+		}
+
+		// Stop just inside contact range, so the next step generates the contact that stops the bullet. Bodies already
+		// touching may sink in a little further before that contact pushes them out, which lets bullets slide along
+		// them, but no more, so a bullet bounced or spun off a wall this step still cannot leave through its far side.
+		const FPhysicsShape& TargetShape = Shapes[TargetIndex];
+		FVector2 Normal;
+		const float StartSeparation = ComputeSeparation(Shape, StartTransform, TargetShape, FPhysicsTransform(Positions[TargetIndex], Angles[TargetIndex]), Normal);
+		const float TargetSeparation = SMath::Min(-0.5f * Settings.LinearSlop, StartSeparation - Settings.LinearSlop);
+
+		const bool bHit = Shape.Type == EPhysicsShapeType::Circle && TargetShape.Type == EPhysicsShapeType::Circle
+			? SweepCircle(Sweep.StartPosition, Shape.Radius + TargetSeparation, Displacement, Positions[TargetIndex], TargetShape.Radius, Time)
+			: ComputeTimeOfImpact(Shape, Sweep, TargetShape, {Positions[TargetIndex], Positions[TargetIndex], Angles[TargetIndex], Angles[TargetIndex]}, TargetSeparation, Tolerance, Time);
+
+		if (bHit && Time < MinTime)
+		{
+			MinTime = Time;
+		}
+	}
+
+	if (MinTime < 1.f)
+	{
+		const FPhysicsTransform Transform = Sweep.GetTransform(MinTime);
+		Positions[Index] = Transform.Position;
+		Angles[Index] = SMath::Lerp(Sweep.StartAngle, Sweep.EndAngle, MinTime);
+		Bounds[Index] = Shape.ComputeBounds(Transform);
+	}
+}
+
+void FPhysicsScene::StoreImpulses()
+{
+	ImpulseCache.clear();
+	for (const FContactConstraint& Contact : Contacts)
+	{
+		FCachedImpulses& Cached = ImpulseCache[MakePairKey(BodyIds[Contact.IndexA], BodyIds[Contact.IndexB])];
+		Cached.PointCount = Contact.PointCount;
+		for (Uint32 PointIndex = 0; PointIndex < Contact.PointCount; ++PointIndex)
+		{
+			Cached.FeatureIds[PointIndex] = Contact.Points[PointIndex].FeatureId;
+			Cached.NormalImpulses[PointIndex] = Contact.Points[PointIndex].NormalImpulse;
+			Cached.TangentImpulses[PointIndex] = Contact.Points[PointIndex].TangentImpulse;
+		}
+	}
+}
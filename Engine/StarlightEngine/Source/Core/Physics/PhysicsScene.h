@@ -0,0 +1,230 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <unordered_map>
+#include <vector>
+
+// Starlight Engine
+#include "Collision.h"
+#include "PhysicsTypes.h"
+
+// Forward Declarations
+class SWorld;
+
+/**
+ * @brief 2D rigid body simulation: convex polygons and circles, with friction and restitution.
+ * Each fixed step integrates gravity and forces, finds touching pairs with a sweep and prune along x, generates contacts
+ * with separating axis tests, groups bodies that touch into islands, and solves each island's contacts with sequential
+ * impulses. Pair finding, contact generation and island solving are spread over the task system. Impulses are carried
+ * between steps for matching contact points (warm starting), so stacks settle quickly.
+ *
+ * Bodies flagged as bullets are swept from their start to their end pose after each step, and pulled back to their first
+ * time of impact with any other body, so they cannot tunnel through thin walls at any speed. The contact that stops
+ * them is then solved by the next step.
+ *
+ * Body data is kept in dense parallel arrays, one element per body, so every stage walks memory linearly.
+ */
+class FPhysicsScene
+{
+public:
+	// Scenes with fewer bodies than this are stepped on the calling thread.
+	static constexpr Uint32 PARALLEL_BODY_THRESHOLD = 512;
+
+	// Steps with fewer fast-moving bullets than this sweep them on the calling thread.
+	static constexpr Uint32 PARALLEL_BULLET_THRESHOLD = 32;
+
+	explicit FPhysicsScene(const FPhysicsSettings& InSettings = FPhysicsSettings());
+
+	const FPhysicsSettings& GetSettings() const { return Settings; }
+	void SetGravity(const FVector2& NewValue) { Settings.Gravity = NewValue; }
+
+	// =============================================
+	// BODIES
+	// =============================================
+
+	FPhysicsBodyId CreateBody(const FPhysicsBodyDesc& Desc);
+
+	/// @returns whether the body existed and was destroyed.
+	bool DestroyBody(FPhysicsBodyId BodyId);
+
+	void DestroyAllBodies();
+
+	bool IsBodyValid(FPhysicsBodyId BodyId) const { return GetBodyIndex(BodyId) != INVALID_ENTITY_INDEX; }
+	Uint32 GetBodyCount() const { return static_cast<Uint32>(BodyIds.size()); }
+
+	// The getters below return zero for invalid bodies, and the setters ignore them.
+
+	FVector2 GetPosition(FPhysicsBodyId BodyId) const;
+
+	// Degrees, like FTransform2D.
+	float GetRotation(FPhysicsBodyId BodyId) const;
+
+	// Teleports the body, without interpolating from where it was.
+	void SetTransform(FPhysicsBodyId BodyId, const FVector2& Position, float Rotation);
+
+	FVector2 GetLinearVelocity(FPhysicsBodyId BodyId) const;
+	void SetLinearVelocity(FPhysicsBodyId BodyId, const FVector2& Velocity);
+
+	// Pushes a dynamic body through its centre of mass during the next step.
+	void ApplyForce(FPhysicsBodyId BodyId, const FVector2& Force);
+
+	// Changes a dynamic body's velocity immediately, as if struck at WorldPoint.
+	void ApplyImpulse(FPhysicsBodyId BodyId, const FVector2& Impulse, const FVector2& WorldPoint);
+
+	// =============================================
+	// SIMULATION
+	// =============================================
+
+	/**
+	 * @brief Advances the simulation by DeltaTime in whole fixed steps, carrying the remainder over to the next call.
+	 * @returns the number of steps taken.
+	 */
+	Uint32 Advance(float DeltaTime);
+
+	// Runs exactly one fixed step.
+	void Step();
+
+	// How far the simulation time lies between the last two steps, for interpolating rendered transforms.
+	float GetInterpolationAlpha() const { return Accumulator / Settings.FixedTimeStep; }
+
+	// Moves the entity of every body to the body's transform, interpolated between the last two steps.
+	void WriteTransforms(SWorld& World) const;
+
+	// Stats from the last step.
+	Uint32 GetPairCount() const { return static_cast<Uint32>(Pairs.size()); }
+	Uint32 GetContactCount() const { return static_cast<Uint32>(Contacts.size()); }
+	Uint32 GetIslandCount() const { return static_cast<Uint32>(Islands.size()); }
+
+private:
+	struct FBodyPair
+	{
+		Uint32 IndexA;
+		Uint32 IndexB;
+	};
+
+	struct FContactConstraintPoint
+	{
+		// From each body's centre of mass to the contact.
+		FVector2 OffsetA;
+		FVector2 OffsetB;
+
+		float NormalMass = 0.f;
+		float TangentMass = 0.f;
+
+		// Target closing speed, from restitution and overlap correction.
+		float VelocityBias = 0.f;
+
+		float NormalImpulse = 0.f;
+		float TangentImpulse = 0.f;
+
+		Uint32 FeatureId = 0;
+	};
+
+	struct FContactConstraint
+	{
+		Uint32 IndexA;
+		Uint32 IndexB;
+		FVector2 Normal;
+		float Friction;
+		FContactConstraintPoint Points[2];
+		Uint32 PointCount;
+
+		// Two-point contacts solve their normal impulses together, which keeps resting boxes level. This is the
+		// effective mass matrix of the pair and its inverse.
+		float K11;
+		float K12;
+		float K22;
+		float InverseK11;
+		float InverseK12;
+		float InverseK22;
+	};
+
+	// A set of dynamic bodies connected by contacts, solved independently of every other island.
+	struct FIsland
+	{
+		// Range in IslandContacts.
+		Uint32 FirstContact;
+		Uint32 ContactCount;
+	};
+
+	struct FCachedImpulses
+	{
+		Uint32 FeatureIds[2];
+		float NormalImpulses[2];
+		float TangentImpulses[2];
+		Uint32 PointCount;
+	};
+
+	Uint32 GetBodyIndex(FPhysicsBodyId BodyId) const;
+	FPhysicsBodyId AllocateBodyId();
+
+	// Chunks to split BodyCount items of work into, one per thread or 1 for small scenes.
+	Uint32 GetChunkCount() const;
+
+	void IntegrateVelocities(float TimeStep);
+	void UpdateBounds();
+	void SortBodies();
+	void FindPairs();
+	void FindContacts(float TimeStep);
+	void BuildIslands();
+	void SolveIsland(const FIsland& Island);
+	void SolveNormalBlock(FContactConstraint& Contact);
+	FVector2 GetRelativeVelocity(const FContactConstraint& Contact, const FContactConstraintPoint& Point) const;
+	void ApplyContactImpulse(const FContactConstraint& Contact, const FContactConstraintPoint& Point, const FVector2& Impulse);
+	void IntegratePositions(float TimeStep);
+	void SolveContinuous();
+	void SweepBullet(Uint32 Index, float MaxBoundsWidth);
+	void StoreImpulses();
+
+	FPhysicsSettings Settings;
+	float Accumulator = 0.f;
+
+	// Dense index -> body ID.
+	std::vector<FPhysicsBodyId> BodyIds;
+
+	// Body ID -> dense index, INVALID_ENTITY_INDEX for free IDs.
+	std::vector<Uint32> BodyIndices;
+	std::vector<FPhysicsBodyId> FreeBodyIds;
+
+	// Dense body arrays, one element per body.
+	std::vector<EPhysicsBodyType> Types;
+	std::vector<FPhysicsShape> Shapes;
+	std::vector<FVector2> Positions;
+	std::vector<float> Angles;
+	std::vector<FVector2> PreviousPositions;
+	std::vector<float> PreviousAngles;
+	std::vector<FVector2> LinearVelocities;
+	std::vector<float> AngularVelocities;
+	std::vector<FVector2> Forces;
+	std::vector<float> InverseMasses;
+	std::vector<float> InverseInertias;
+	std::vector<float> Frictions;
+	std::vector<float> Restitutions;
+	std::vector<FBox2D> Bounds;
+	std::vector<FEntityId> EntityIds;
+
+	// Non-zero for bodies created with bBullet.
+	std::vector<Uint8> Bullets;
+
+	// Body indices ordered by their bounds' minimum x. Kept between steps, since it barely changes from one to the next.
+	std::vector<Uint32> SortedBodies;
+
+	// Bullets that moved far enough to need sweeping this step, and the minimum x of SortedBodies to search them with.
+	std::vector<Uint32> SweptBullets;
+	std::vector<float> SortedMinX;
+
+	std::vector<std::vector<FBodyPair>> PairChunks;
+	std::vector<FBodyPair> Pairs;
+	std::vector<FContactManifold> Manifolds;
+	std::vector<FContactConstraint> Contacts;
+
+	// Union-find over body indices, then the contacts of each island laid out back to back.
+	std::vector<Uint32> IslandParents;
+	std::vector<FIsland> Islands;
+	std::vector<Uint32> IslandContacts;
+
+	// Body ID pair -> impulses of the contact between them in the last step.
+	std::unordered_map<Uint64, FCachedImpulses> ImpulseCache;
+};
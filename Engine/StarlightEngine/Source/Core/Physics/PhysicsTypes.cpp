@@ -0,0 +1,160 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "PhysicsTypes.h"
+
+// Libraries
+#include <limits>
+
+// Starlight Engine
+#include "Debug/Logging.h"
+
+namespace
+{
+float Cross(const FVector2& A, const FVector2& B)
+{
+	return A.x * B.y - A.y * B.x;
+}
+}
+
+FPhysicsShape FPhysicsShape::MakeCircle(const float Radius)
+{
+	FPhysicsShape Shape;
+	Shape.Type = EPhysicsShapeType::Circle;
+	Shape.Radius = Radius;
+	return Shape;
+}
+
+FPhysicsShape FPhysicsShape::MakeBox(const FVector2& HalfExtents)
+{
+	FPhysicsShape Shape;
+	Shape.Type = EPhysicsShapeType::Polygon;
+	Shape.VertexCount = 4;
+	Shape.Vertices[0] = FVector2(-HalfExtents.x, -HalfExtents.y);
+	Shape.Vertices[1] = FVector2(HalfExtents.x, -HalfExtents.y);
+	Shape.Vertices[2] = FVector2(HalfExtents.x, HalfExtents.y);
+	Shape.Vertices[3] = FVector2(-HalfExtents.x, HalfExtents.y);
+
+	// Counter-clockwise in a y-up frame, so the outward normals turn right of each edge.
+	Shape.Normals[0] = FVector2(0.f, -1.f);
+	Shape.Normals[1] = FVector2(1.f, 0.f);
+	Shape.Normals[2] = FVector2(0.f, 1.f);
+	Shape.Normals[3] = FVector2(-1.f, 0.f);
+	return Shape;
+}
+
+bool FPhysicsShape::MakePolygon(const std::span<const FVector2> InVertices, FPhysicsShape& OutShape)
+{
+	const Uint32 VertexCount = static_cast<Uint32>(InVertices.size());
+	if (VertexCount < 3 || VertexCount > MAX_POLYGON_VERTICES)
+	{
+		SL_LOG_FUNC(LogPhysics, Error, "Polygons need 3 to " + FString(static_cast<int>(MAX_POLYGON_VERTICES)) + " vertices, got " + FString(static_cast<int>(VertexCount)) + ".");
+		return false;
+	}
+
+	// Area and centroid from a fan of triangles. The sign of the area gives the winding.
+	float DoubleArea = 0.f;
+	FVector2 Centroid(0.f);
+	for (Uint32 Index = 0; Index < VertexCount; ++Index)
+	{
+		const FVector2& Vertex = InVertices[Index];
+		const FVector2& Next = InVertices[(Index + 1) % VertexCount];
+		const float TriangleArea = Cross(Vertex, Next);
+		DoubleArea += TriangleArea;
+		Centroid += (Vertex + Next) * TriangleArea;
+	}
+
+	if (SMath::Abs(DoubleArea) <= SMath::EPSILON)
+	{
+		SL_LOG_FUNC(LogPhysics, Error, "Polygon has no area.");
+		return false;
+	}
+
+	Centroid /= 3.f * DoubleArea;
+	const bool bReverse = DoubleArea < 0.f;
+
+	FPhysicsShape Shape;
+	Shape.Type = EPhysicsShapeType::Polygon;
+	Shape.VertexCount = VertexCount;
+	for (Uint32 Index = 0; Index < VertexCount; ++Index)
+	{
+		Shape.Vertices[Index] = InVertices[bReverse ? VertexCount - 1 - Index : Index] - Centroid;
+	}
+
+	for (Uint32 Index = 0; Index < VertexCount; ++Index)
+	{
+		const FVector2 Edge = Shape.Vertices[(Index + 1) % VertexCount] - Shape.Vertices[Index];
+		const FVector2 Following = Shape.Vertices[(Index + 2) % VertexCount] - Shape.Vertices[(Index + 1) % VertexCount];
+		if (Cross(Edge, Following) <= 0.f)
+		{
+			SL_LOG_FUNC(LogPhysics, Error, "Polygon is not convex.");
+			return false;
+		}
+
+		Shape.Normals[Index] = FVector2(Edge.y, -Edge.x).Normalized();
+	}
+
+	OutShape = Shape;
+	return true;
+}
+
+FBox2D FPhysicsShape::ComputeBounds(const FPhysicsTransform& Transform) const
+{
+	if (Type == EPhysicsShapeType::Circle)
+	{
+		return FBox2D::FromCentreExtent(Transform.Position, FVector2(Radius));
+	}
+
+	FBox2D Bounds(Transform.TransformPoint(Vertices[0]), Transform.TransformPoint(Vertices[0]));
+	for (Uint32 Index = 1; Index < VertexCount; ++Index)
+	{
+		const FVector2 Vertex = Transform.TransformPoint(Vertices[Index]);
+		Bounds = Bounds.Union(FBox2D(Vertex, Vertex));
+	}
+
+	return Bounds;
+}
+
+void FPhysicsShape::ComputeMass(const float Density, float& OutMass, float& OutInertia) const
+{
+	if (Type == EPhysicsShapeType::Circle)
+	{
+		OutMass = Density * SMath::PI * Radius * Radius;
+		OutInertia = 0.5f * OutMass * Radius * Radius;
+		return;
+	}
+
+	// Sum over the triangles between the origin and each edge.
+	float Area = 0.f;
+	float Inertia = 0.f;
+	for (Uint32 Index = 0; Index < VertexCount; ++Index)
+	{
+		const FVector2& Edge1 = Vertices[Index];
+		const FVector2& Edge2 = Vertices[(Index + 1) % VertexCount];
+		const float TriangleArea = 0.5f * Cross(Edge1, Edge2);
+		Area += TriangleArea;
+		Inertia += TriangleArea * (Edge1.Dot(Edge1) + Edge1.Dot(Edge2) + Edge2.Dot(Edge2)) / 6.f;
+	}
+
+	OutMass = Density * Area;
+	OutInertia = Density * Inertia;
+}
+
+void FPhysicsShape::ComputeExtents(float& OutMinExtent, float& OutMaxExtent) const
+{
+	if (Type == EPhysicsShapeType::Circle)
+	{
+		OutMinExtent = Radius;
+		OutMaxExtent = Radius;
+		return;
+	}
+
+	OutMinExtent = std::numeric_limits<float>::max();
+	OutMaxExtent = 0.f;
+	for (Uint32 Index = 0; Index < VertexCount; ++Index)
+	{
+		// The origin is inside the polygon, so every edge lies on the far side of its normal.
+		OutMinExtent = SMath::Min(OutMinExtent, Normals[Index].Dot(Vertices[Index]));
+		OutMaxExtent = SMath::Max(OutMaxExtent, Vertices[Index].Length());
+	}
+}
@@ -0,0 +1,150 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <span>
+#include <type_traits>
+#include <SDL3/SDL_stdinc.h>
+
+// Starlight Engine
+#include "Math/Box2D.h"
+#include "Math/Vector2.h"
+#include "Object/Entity.h"
+
+// Stable handle to a body inside an FPhysicsScene.
+using FPhysicsBodyId = Uint32;
+
+constexpr FPhysicsBodyId INVALID_PHYSICS_BODY_ID = 0xFFFFFFFFu;
+
+enum class EPhysicsBodyType : Uint8
+{
+	// Never moves and has infinite mass.
+	Static = 0,
+	// Moves by its velocity only, pushing dynamic bodies without being pushed back.
+	Kinematic,
+	// Moved by gravity, forces and collisions.
+	Dynamic,
+};
+
+enum class EPhysicsShapeType : Uint8
+{
+	Circle = 0,
+	// Convex polygon, including boxes.
+	Polygon,
+};
+
+// Position and rotation of a body, with the rotation kept as a sine and cosine for transforming points.
+struct FPhysicsTransform
+{
+	FVector2 Position;
+	float Sin = 0.f;
+	float Cos = 1.f;
+
+	FPhysicsTransform() = default;
+	FPhysicsTransform(const FVector2& InPosition, const float Radians) : Position(InPosition), Sin(SMath::Sin(Radians)), Cos(SMath::Cos(Radians)) {}
+
+	FVector2 Rotate(const FVector2& Vector) const { return FVector2(Cos * Vector.x - Sin * Vector.y, Sin * Vector.x + Cos * Vector.y); }
+	FVector2 InverseRotate(const FVector2& Vector) const { return FVector2(Cos * Vector.x + Sin * Vector.y, -Sin * Vector.x + Cos * Vector.y); }
+
+	FVector2 TransformPoint(const FVector2& Point) const { return Position + Rotate(Point); }
+	FVector2 InverseTransformPoint(const FVector2& Point) const { return InverseRotate(Point - Position); }
+};
+
+/**
+ * @brief Collision shape of a body, in the body's local space with the origin at its centre of mass.
+ * Stored by value with a fixed vertex capacity so shapes are trivially copyable and need no allocation.
+ */
+struct FPhysicsShape
+{
+	static constexpr Uint32 MAX_POLYGON_VERTICES = 8;
+
+	EPhysicsShapeType Type = EPhysicsShapeType::Circle;
+
+	// Circle only.
+	float Radius = 0.f;
+
+	// Polygon only: counter-clockwise vertices, and the outward normal of the edge from each vertex to the next.
+	Uint32 VertexCount = 0;
+	FVector2 Vertices[MAX_POLYGON_VERTICES];
+	FVector2 Normals[MAX_POLYGON_VERTICES];
+
+	static FPhysicsShape MakeCircle(float Radius);
+	static FPhysicsShape MakeBox(const FVector2& HalfExtents);
+
+	/**
+	 * @brief Builds a polygon from 3 to MAX_POLYGON_VERTICES convex vertices in either winding.
+	 * The vertices are moved so their centroid is the origin, which becomes the body's position.
+	 * @returns false, leaving OutShape untouched, if the vertices are not a convex polygon with some area.
+	 */
+	static bool MakePolygon(std::span<const FVector2> InVertices, FPhysicsShape& OutShape);
+
+	// Bounds of the shape placed at Transform.
+	FBox2D ComputeBounds(const FPhysicsTransform& Transform) const;
+
+	// Mass and rotational inertia about the origin, for the given mass per unit area.
+	void ComputeMass(float Density, float& OutMass, float& OutInertia) const;
+
+	// Distance from the origin to the nearest edge and to the farthest point of the shape.
+	void ComputeExtents(float& OutMinExtent, float& OutMaxExtent) const;
+};
+
+// Everything needed to create a body.
+struct FPhysicsBodyDesc
+{
+	EPhysicsBodyType Type = EPhysicsBodyType::Dynamic;
+	FPhysicsShape Shape = FPhysicsShape::MakeBox(FVector2(16.f));
+
+	FVector2 Position = FVector2(0.f);
+
+	// Rotation in degrees, like FTransform2D.
+	float Rotation = 0.f;
+
+	FVector2 LinearVelocity = FVector2(0.f);
+
+	// Degrees per second.
+	float AngularVelocity = 0.f;
+
+	// Mass per square world unit.
+	float Density = 1.f;
+	float Friction = 0.4f;
+
+	// Bounciness, 0 stops dead and 1 bounces back at full speed.
+	float Restitution = 0.f;
+
+	// Keeps the body upright, e.g. for characters.
+	bool bFixedRotation = false;
+
+	// Sweeps the body's motion each step so it cannot pass through thin bodies however fast it moves, e.g. for
+	// projectiles. Costs a time of impact query against everything along the way, so only flag what needs it.
+	bool bBullet = false;
+
+	// Entity whose transform follows the body, see FPhysicsScene::WriteTransforms.
+	FEntityId EntityId = INVALID_ENTITY_ID;
+};
+
+struct FPhysicsSettings
+{
+	// World units per second squared. Positive y points down the screen.
+	FVector2 Gravity = FVector2(0.f, 980.f);
+
+	// The simulation always advances in steps of this length, whatever the frame rate.
+	float FixedTimeStep = 1.f / 60.f;
+
+	// Steps allowed per frame. Time beyond this is dropped so a slow frame cannot snowball into slower ones.
+	Uint32 MaxStepsPerFrame = 4;
+
+	// Solver passes over every contact per step. More are stiffer and slower.
+	Uint32 VelocityIterations = 8;
+
+	// Overlap allowed before pushing bodies apart, which keeps resting contacts stable.
+	float LinearSlop = 0.5f;
+
+	// Fraction of the remaining overlap corrected per step.
+	float Baumgarte = 0.2f;
+
+	// Closing speed below which contacts do not bounce, so resting bodies settle.
+	float RestitutionThreshold = 30.f;
+};
+
+static_assert(std::is_trivially_copyable_v<FPhysicsShape>, "FPhysicsShape must stay trivially copyable");
@@ -0,0 +1,312 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "TilemapCollision.h"
+
+// Libraries
+#include <bit>
+
+// Starlight Engine
+#include "PhysicsScene.h"
+#include "Object/Tilemap.h"
+
+// Each row of a chunk is merged as one 32-bit mask.
+static_assert(FTilemap::CHUNK_SIZE == 32, "Solid tiles are packed a chunk row to a Uint32");
+
+namespace
+{
+// Writes one bit per solid tile of the chunk, a row to a word, with consecutive rows Stride words apart.
+void GetSolidRows(const FTilemap& Tilemap, const Uint32 ChunkIndex, Uint32* OutRows, const Uint32 Stride)
+{
+	const FTileset& Tileset = Tilemap.GetTileset();
+	const FTileId* Tiles = Tilemap.GetChunkTiles(ChunkIndex);
+	const bool bEmpty = Tilemap.IsChunkEmpty(ChunkIndex);
+	for (Uint32 Y = 0; Y < FTilemap::CHUNK_SIZE; ++Y)
+	{
+		Uint32 Row = 0;
+		for (Uint32 X = 0; X < FTilemap::CHUNK_SIZE && bEmpty == false; ++X)
+		{
+			Row |= static_cast<Uint32>(Tileset.IsSolid(Tiles[Y * FTilemap::CHUNK_SIZE + X])) << X;
+		}
+		OutRows[Y * Stride] = Row;
+	}
+}
+
+// The bits of word Word, counting words from the left of the row, that fall within [Start, Start + Width).
+Uint32 GetRangeMask(const Uint32 Word, const Uint32 Start, const Uint32 Width)
+{
+	const Uint32 WordStart = Word * 32;
+	const Uint32 Begin = SDL_max(Start, WordStart) - WordStart;
+	const Uint32 End = SDL_min(Start + Width, WordStart + 32) - WordStart;
+	return (End - Begin == 32 ? ~0u : (1u << (End - Begin)) - 1) << Begin;
+}
+
+/**
+ * @brief Greedily merges the set bits of RowCount rows of WordCount words each into non-overlapping rectangles.
+ * Bit 0 of a row's first word is its leftmost tile, and a run of bits carries on from one word into the next. Rows are
+ * cleared as they are covered.
+ * @param OnRect Called with the X, Y, width and height of each rectangle in tiles, top to bottom.
+ */
+template <typename TOnRect>
+void MergeRows(Uint32* Rows, const Uint32 WordCount, const Uint32 RowCount, TOnRect OnRect)
+{
+	for (Uint32 Y = 0; Y < RowCount; ++Y)
+	{
+		Uint32* Row = Rows + Y * WordCount;
+		for (Uint32 Word = 0; Word < WordCount; ++Word)
+		{
+			while (Row[Word] != 0)
+			{
+				// Take the leftmost run of the row, then grow it down for as long as the rows below are solid under all of it.
+				const Uint32 X = Word * 32 + static_cast<Uint32>(std::countr_zero(Row[Word]));
+				Uint32 Width = static_cast<Uint32>(std::countr_one(Row[Word] >> (X % 32)));
+				for (Uint32 NextWord = Word + 1; (X + Width) % 32 == 0 && NextWord < WordCount; ++NextWord)
+				{
+					const Uint32 NextWidth = static_cast<Uint32>(std::countr_one(Row[NextWord]));
+					Width += NextWidth;
+					if (NextWidth < 32)
+					{
+						break;
+					}
+				}
+
+				const Uint32 FirstWord = X / 32;
+				const Uint32 LastWord = (X + Width - 1) / 32;
+
+				Uint32 Height = 1;
+				for (; Y + Height < RowCount; ++Height)
+				{
+					const Uint32* Below = Rows + (Y + Height) * WordCount;
+					bool bSolid = true;
+					for (Uint32 RunWord = FirstWord; RunWord <= LastWord && bSolid; ++RunWord)
+					{
+						const Uint32 RunMask = GetRangeMask(RunWord, X, Width);
+						bSolid = (Below[RunWord] & RunMask) == RunMask;
+					}
+
+					if (bSolid == false)
+					{
+						break;
+					}
+				}
+
+				for (Uint32 RowY = Y; RowY < Y + Height; ++RowY)
+				{
+					for (Uint32 RunWord = FirstWord; RunWord <= LastWord; ++RunWord)
+					{
+						Rows[RowY * WordCount + RunWord] &= ~GetRangeMask(RunWord, X, Width);
+					}
+				}
+
+				OnRect(X, Y, Width, Height);
+			}
+		}
+	}
+}
+}
+
+FTilemapCollision::FTilemapCollision(const FTilemap& InTilemap)
+	: Tilemap(InTilemap)
+	, Chunks(static_cast<size_t>(InTilemap.GetChunkCountX()) * InTilemap.GetChunkCountY())
+	, ChunkRows(InTilemap.GetChunkCountY())
+	, BodyOrigin(InTilemap.GetOrigin())
+{
+	//
+}
+
+void FTilemapCollision::Update(FPhysicsScene* Scene)
+{
+	// Moving the map invalidates every body, but none of the rectangles.
+	if (Scene != nullptr && BodyOrigin != Tilemap.GetOrigin())
+	{
+		DestroyBodies(*Scene);
+	}
+	BodyOrigin = Tilemap.GetOrigin();
+
+	for (Uint32 ChunkIndex = 0; ChunkIndex < static_cast<Uint32>(Chunks.size()); ++ChunkIndex)
+	{
+		FChunkCollision& Chunk = Chunks[ChunkIndex];
+
+		const Uint32 Revision = Tilemap.GetChunkRevision(ChunkIndex);
+		if (Chunk.Revision != Revision)
+		{
+			Chunk.Revision = Revision;
+			RectCount -= static_cast<Uint32>(Chunk.Rects.size());
+			MergeSolidTiles(Tilemap, ChunkIndex, Chunk.Rects);
+			RectCount += static_cast<Uint32>(Chunk.Rects.size());
+
+			ChunkRows[ChunkIndex / Tilemap.GetChunkCountX()].bDirty = true;
+		}
+	}
+
+	if (Scene == nullptr)
+	{
+		return;
+	}
+
+	for (Uint32 ChunkY = 0; ChunkY < static_cast<Uint32>(ChunkRows.size()); ++ChunkY)
+	{
+		if (ChunkRows[ChunkY].bDirty)
+		{
+			CreateBodies(*Scene, ChunkY, ChunkRows[ChunkY]);
+		}
+	}
+}
+
+void FTilemapCollision::DestroyBodies(FPhysicsScene& Scene)
+{
+	for (FChunkRowBodies& Row : ChunkRows)
+	{
+		for (const FPhysicsBodyId BodyId : Row.Bodies)
+		{
+			Scene.DestroyBody(BodyId);
+		}
+		Row.Bodies.clear();
+		Row.bDirty = true;
+	}
+}
+
+void FTilemapCollision::ForgetBodies()
+{
+	for (FChunkRowBodies& Row : ChunkRows)
+	{
+		Row.Bodies.clear();
+		Row.bDirty = true;
+	}
+}
+
+FBox2D FTilemapCollision::GetRectBounds(const Uint32 ChunkIndex, const FTileRect& Rect) const
+{
+	const Uint32 ChunkX = ChunkIndex % Tilemap.GetChunkCountX();
+	const Uint32 ChunkY = ChunkIndex / Tilemap.GetChunkCountX();
+	const FVector2 Min = Tilemap.GetChunkBounds(ChunkX, ChunkY).Min + FVector2(Rect.X, Rect.Y) * Tilemap.GetTileSize();
+	return FBox2D(Min, Min + FVector2(Rect.Width, Rect.Height) * Tilemap.GetTileSize());
+}
+
+Uint32 FTilemapCollision::QueryBox(const FBox2D& Box, FBox2D* OutRects, const Uint32 MaxResults) const
+{
+	Uint32 MinChunkX = 0;
+	Uint32 MinChunkY = 0;
+	Uint32 MaxChunkX = 0;
+	Uint32 MaxChunkY = 0;
+	if (Tilemap.GetChunkRange(Box, MinChunkX, MinChunkY, MaxChunkX, MaxChunkY) == false)
+	{
+		return 0;
+	}
+
+	Uint32 ResultCount = 0;
+	for (Uint32 ChunkY = MinChunkY; ChunkY <= MaxChunkY; ++ChunkY)
+	{
+		for (Uint32 ChunkX = MinChunkX; ChunkX <= MaxChunkX; ++ChunkX)
+		{
+			const Uint32 ChunkIndex = Tilemap.GetChunkIndex(ChunkX, ChunkY);
+			for (const FTileRect& Rect : Chunks[ChunkIndex].Rects)
+			{
+				const FBox2D RectBounds = GetRectBounds(ChunkIndex, Rect);
+				if (RectBounds.Intersects(Box))
+				{
+					if (ResultCount == MaxResults)
+					{
+						return ResultCount;
+					}
+
+					OutRects[ResultCount++] = RectBounds;
+				}
+			}
+		}
+	}
+
+	return ResultCount;
+}
+
+bool FTilemapCollision::Raycast(const FVector2& Origin, const FVector2& Direction, const float MaxDistance, float& OutDistance) const
+{
+	const FVector2 End = Origin + Direction * MaxDistance;
+	const FBox2D SegmentBounds(FVector2(SMath::Min(Origin.x, End.x), SMath::Min(Origin.y, End.y)), FVector2(SMath::Max(Origin.x, End.x), SMath::Max(Origin.y, End.y)));
+
+	Uint32 MinChunkX = 0;
+	Uint32 MinChunkY = 0;
+	Uint32 MaxChunkX = 0;
+	Uint32 MaxChunkY = 0;
+	if (Tilemap.GetChunkRange(SegmentBounds, MinChunkX, MinChunkY, MaxChunkX, MaxChunkY) == false)
+	{
+		return false;
+	}
+
+	// Every hit shortens the segment, so rectangles further away are rejected sooner.
+	const FVector2 InverseDirection = FBox2D::SafeInverse(Direction);
+	float NearestDistance = MaxDistance;
+	bool bHit = false;
+	for (Uint32 ChunkY = MinChunkY; ChunkY <= MaxChunkY; ++ChunkY)
+	{
+		for (Uint32 ChunkX = MinChunkX; ChunkX <= MaxChunkX; ++ChunkX)
+		{
+			const Uint32 ChunkIndex = Tilemap.GetChunkIndex(ChunkX, ChunkY);
+			for (const FTileRect& Rect : Chunks[ChunkIndex].Rects)
+			{
+				float Distance = 0.f;
+				if (GetRectBounds(ChunkIndex, Rect).RayIntersects(Origin, InverseDirection, NearestDistance, Distance))
+				{
+					NearestDistance = Distance;
+					bHit = true;
+				}
+			}
+		}
+	}
+
+	if (bHit)
+	{
+		OutDistance = NearestDistance;
+	}
+	return bHit;
+}
+
+void FTilemapCollision::MergeSolidTiles(const FTilemap& Tilemap, const Uint32 ChunkIndex, std::vector<FTileRect>& OutRects)
+{
+	OutRects.clear();
+	if (Tilemap.IsChunkEmpty(ChunkIndex))
+	{
+		return;
+	}
+
+	// One bit per solid tile not yet covered by a rectangle.
+	Uint32 Rows[FTilemap::CHUNK_SIZE];
+	GetSolidRows(Tilemap, ChunkIndex, Rows, 1);
+
+	MergeRows(Rows, 1, FTilemap::CHUNK_SIZE, [&OutRects](const Uint32 X, const Uint32 Y, const Uint32 Width, const Uint32 Height)
+	{
+		OutRects.push_back({static_cast<Uint8>(X), static_cast<Uint8>(Y), static_cast<Uint8>(Width), static_cast<Uint8>(Height)});
+	});
+}
+
+void FTilemapCollision::CreateBodies(FPhysicsScene& Scene, const Uint32 ChunkY, FChunkRowBodies& Row)
+{
+	for (const FPhysicsBodyId BodyId : Row.Bodies)
+	{
+		Scene.DestroyBody(BodyId);
+	}
+	Row.Bodies.clear();
+	Row.bDirty = false;
+
+	// The row's chunks side by side, so runs of solid tiles carry on across chunk borders.
+	const Uint32 ChunkCountX = Tilemap.GetChunkCountX();
+	SolidRows.resize(static_cast<size_t>(ChunkCountX) * FTilemap::CHUNK_SIZE);
+	for (Uint32 ChunkX = 0; ChunkX < ChunkCountX; ++ChunkX)
+	{
+		GetSolidRows(Tilemap, Tilemap.GetChunkIndex(ChunkX, ChunkY), SolidRows.data() + ChunkX, ChunkCountX);
+	}
+
+	const FVector2 RowOrigin = Tilemap.GetChunkBounds(0, ChunkY).Min;
+	const float TileSize = Tilemap.GetTileSize();
+
+	FPhysicsBodyDesc Desc;
+	Desc.Type = EPhysicsBodyType::Static;
+	MergeRows(SolidRows.data(), ChunkCountX, FTilemap::CHUNK_SIZE, [&](const Uint32 X, const Uint32 Y, const Uint32 Width, const Uint32 Height)
+	{
+		const FVector2 Min = RowOrigin + FVector2(static_cast<float>(X), static_cast<float>(Y)) * TileSize;
+		const FBox2D Bounds(Min, Min + FVector2(static_cast<float>(Width), static_cast<float>(Height)) * TileSize);
+		Desc.Shape = FPhysicsShape::MakeBox(Bounds.GetExtent());
+		Desc.Position = Bounds.GetCentre();
+		Row.Bodies.push_back(Scene.CreateBody(Desc));
+	});
+}
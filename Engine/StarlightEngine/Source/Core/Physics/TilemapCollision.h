@@ -0,0 +1,107 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <vector>
+
+// Starlight Engine
+#include "PhysicsTypes.h"
+#include "Math/Box2D.h"
+
+// Forward Declarations
+class FTilemap;
+class FPhysicsScene;
+
+// A block of solid tiles merged into one rectangle, in tiles relative to its chunk's top left.
+struct FTileRect
+{
+	Uint8 X;
+	Uint8 Y;
+	Uint8 Width;
+	Uint8 Height;
+};
+
+/**
+ * @brief The solid tiles of a tilemap, merged into as few rectangles as possible.
+ * Solid tiles are greedily grown into rectangles, widest first and then as far down as they stay solid, so a floor or a
+ * wall becomes one rectangle instead of hundreds of tiles. Queries use rectangles merged chunk by chunk. Static bodies
+ * are merged a whole row of chunks at a time instead, so a floor running across chunks is still one box rather than
+ * abutting boxes, whose side faces at the seam a body sliding along the floor could catch on. Rectangles and bodies
+ * are merged again only when a chunk's revision changes, so editing a tile costs one chunk and one row of chunks.
+ *
+ * Seams remain where boxes are stacked, i.e. along a wall that changes thickness or crosses a chunk row, where a body
+ * sliding down the wall can still catch on the top face of the box below.
+ */
+class FTilemapCollision
+{
+public:
+	explicit FTilemapCollision(const FTilemap& InTilemap);
+
+	const FTilemap& GetTilemap() const { return Tilemap; }
+
+	/**
+	 * @brief Merges the chunks that changed since the last update, and rebuilds the static bodies of their chunk rows.
+	 * @param Scene May be null, in which case only the rectangles are kept.
+	 */
+	void Update(FPhysicsScene* Scene);
+
+	// Destroys every body this created in Scene.
+	void DestroyBodies(FPhysicsScene& Scene);
+
+	// Drops the IDs of bodies that no longer exist because their scene was replaced. The next update creates them anew.
+	void ForgetBodies();
+
+	Uint32 GetRectCount() const { return RectCount; }
+
+	const std::vector<FTileRect>& GetChunkRects(const Uint32 ChunkIndex) const { return Chunks[ChunkIndex].Rects; }
+
+	// World-space bounds of a rectangle of the chunk.
+	FBox2D GetRectBounds(Uint32 ChunkIndex, const FTileRect& Rect) const;
+
+	// Finds the rectangles overlapping Box, writing their world-space bounds. Returns the number written.
+	Uint32 QueryBox(const FBox2D& Box, FBox2D* OutRects, Uint32 MaxResults) const;
+
+	/**
+	 * @brief Finds the first rectangle crossed by the segment Origin + Direction * [0, MaxDistance].
+	 * @param OutDistance Where the segment enters it, in units of Direction. Left untouched if nothing was hit.
+	 */
+	bool Raycast(const FVector2& Origin, const FVector2& Direction, float MaxDistance, float& OutDistance) const;
+
+	/**
+	 * @brief Greedily merges the solid tiles of one chunk into non-overlapping rectangles.
+	 * @param OutRects Replaced with the rectangles, top to bottom.
+	 */
+	static void MergeSolidTiles(const FTilemap& Tilemap, Uint32 ChunkIndex, std::vector<FTileRect>& OutRects);
+
+private:
+	struct FChunkCollision
+	{
+		// Revision of the chunk the rectangles were merged from, 0 before the first merge.
+		Uint32 Revision = 0;
+		std::vector<FTileRect> Rects;
+	};
+
+	struct FChunkRowBodies
+	{
+		// Set when a chunk of the row changed or the bodies were dropped, until the bodies are created again.
+		bool bDirty = true;
+
+		// One static body per rectangle merged across the row.
+		std::vector<FPhysicsBodyId> Bodies;
+	};
+
+	// Merges the solid tiles of a row of chunks as one, and creates a static body per rectangle in place of the old ones.
+	void CreateBodies(FPhysicsScene& Scene, Uint32 ChunkY, FChunkRowBodies& Row);
+
+	const FTilemap& Tilemap;
+	std::vector<FChunkCollision> Chunks;
+	std::vector<FChunkRowBodies> ChunkRows;
+	Uint32 RectCount = 0;
+
+	// One bit per solid tile of a row of chunks, kept to avoid reallocating.
+	std::vector<Uint32> SolidRows;
+
+	// Where the map was when its bodies were created, so moving it moves them.
+	FVector2 BodyOrigin;
+};
@@ -0,0 +1,293 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "WorldArchive.h"
+
+// Libraries
+#include <cstring>
+#include <vector>
+#include <SDL3/SDL_endian.h>
+#include <SDL3/SDL_iostream.h>
+
+// Starlight Engine
+#include "Debug/Logging.h"
+#include "Object/World.h"
+
+// Archives store component data in native layout, which is only portable between little-endian targets.
+static_assert(SDL_BYTEORDER == SDL_LIL_ENDIAN, "FWorldArchive assumes a little-endian platform");
+
+namespace
+{
+// A component array to be written into the archive.
+struct FPendingSection
+{
+	EWorldArchiveSection Type;
+	Uint32 ElementSize;
+	const void* Data;
+	Uint64 Count;
+};
+
+template <typename T>
+FPendingSection MakePendingSection(const EWorldArchiveSection Type, const std::vector<T>& Array)
+{
+	return {Type, static_cast<Uint32>(sizeof(T)), Array.data(), static_cast<Uint64>(Array.size())};
+}
+
+Uint64 AlignSectionOffset(const Uint64 Offset)
+{
+	return (Offset + FWorldArchive::SECTION_ALIGNMENT - 1) & ~(FWorldArchive::SECTION_ALIGNMENT - 1);
+}
+
+template <typename T>
+bool GetSectionData(const FWorldArchiveSection& Section, const Uint8* Data, const size_t DataSize, const T*& OutData, Uint64& OutCount)
+{
+	if (Section.ElementSize != sizeof(T) || Section.Offset > DataSize || Section.Offset % alignof(T) != 0)
+	{
+		return false;
+	}
+
+	if (Section.Count > (DataSize - Section.Offset) / sizeof(T))
+	{
+		return false;
+	}
+
+	OutData = reinterpret_cast<const T*>(Data + Section.Offset);
+	OutCount = Section.Count;
+	return true;
+}
+}
+
+bool FWorldArchive::Save(const SWorld& World, const FString& FilePath)
+{
+	// Compact the name table so names of destroyed entities are not written out.
+	std::vector<FEntityName> Names;
+	std::vector<char> NameTable;
+	Names.reserve(World.Names.size());
+	NameTable.push_back('\0');
+	for (const FEntityName& Name : World.Names)
+	{
+		FEntityName CompactName;
+		if (Name.Length > 0)
+		{
+			CompactName.Offset = static_cast<Uint32>(NameTable.size());
+			CompactName.Length = Name.Length;
+			const char* NameData = World.NameTable.data() + Name.Offset;
+			NameTable.insert(NameTable.end(), NameData, NameData + Name.Length + 1);
+		}
+		Names.push_back(CompactName);
+	}
+
+	const FPendingSection PendingSections[] = {
+		MakePendingSection(EWorldArchiveSection::EntityIds, World.EntityIds),
+		MakePendingSection(EWorldArchiveSection::EntityIndices, World.EntityIndices),
+		MakePendingSection(EWorldArchiveSection::Transforms, World.Transforms),
+		MakePendingSection(EWorldArchiveSection::Sprites, World.Sprites),
+		MakePendingSection(EWorldArchiveSection::Names, Names),
+		MakePendingSection(EWorldArchiveSection::NameTable, NameTable),
+	};
+	constexpr Uint16 SectionCount = static_cast<Uint16>(SDL_arraysize(PendingSections));
+
+	// Lay out the file.
+	FWorldArchiveSection Sections[SectionCount];
+	Uint64 Offset = sizeof(FWorldArchiveHeader) + sizeof(Sections);
+	for (Uint16 Index = 0; Index < SectionCount; ++Index)
+	{
+		const FPendingSection& Pending = PendingSections[Index];
+		Offset = AlignSectionOffset(Offset);
+		Sections[Index] = {Pending.Type, Pending.ElementSize, Offset, Pending.Count};
+		Offset += Pending.Count * Pending.ElementSize;
+	}
+
+	FWorldArchiveHeader Header;
+	Header.Magic = MAGIC;
+	Header.Version = VERSION;
+	Header.SectionCount = SectionCount;
+	Header.FileSize = Offset;
+
+	SDL_IOStream* File = SDL_IOFromFile(FilePath, "wb");
+	if (File == nullptr)
+	{
+		SL_LOG_FUNC(LogSWorld, Error, "Could not open \"" + FilePath + "\" for writing! SDL_Error: " + SDL_GetErrorFString());
+		return false;
+	}
+
+	bool bSuccess = SDL_WriteIO(File, &Header, sizeof(Header)) == sizeof(Header);
+	bSuccess &= SDL_WriteIO(File, Sections, sizeof(Sections)) == sizeof(Sections);
+
+	constexpr Uint8 Padding[SECTION_ALIGNMENT] = {};
+	Uint64 WrittenBytes = sizeof(Header) + sizeof(Sections);
+	for (Uint16 Index = 0; Index < SectionCount && bSuccess; ++Index)
+	{
+		const size_t PaddingSize = static_cast<size_t>(Sections[Index].Offset - WrittenBytes);
+		const size_t DataSize = static_cast<size_t>(Sections[Index].Count * Sections[Index].ElementSize);
+
+		bSuccess &= SDL_WriteIO(File, Padding, PaddingSize) == PaddingSize;
+		bSuccess &= SDL_WriteIO(File, PendingSections[Index].Data, DataSize) == DataSize;
+		WrittenBytes += PaddingSize + DataSize;
+	}
+
+	bSuccess &= SDL_CloseIO(File);
+	if (bSuccess == false)
+	{
+		SL_LOG_FUNC(LogSWorld, Error, "Failed writing \"" + FilePath + "\"! SDL_Error: " + SDL_GetErrorFString());
+	}
+
+	return bSuccess;
+}
+
+bool FWorldArchive::Load(SWorld& World, const FString& FilePath)
+{
+	size_t DataSize = 0;
+	void* Data = SDL_LoadFile(FilePath, &DataSize);
+	if (Data == nullptr)
+	{
+		SL_LOG_FUNC(LogSWorld, Error, "Could not read \"" + FilePath + "\"! SDL_Error: " + SDL_GetErrorFString());
+		World.DestroyAllEntities();
+		return false;
+	}
+
+	const bool bSuccess = LoadFromMemory(World, Data, DataSize);
+	SDL_free(Data);
+	return bSuccess;
+}
+
+bool FWorldArchive::LoadFromMemory(SWorld& World, const void* Data, const size_t DataSize)
+{
+	World.DestroyAllEntities();
+
+	FWorldArchiveView View;
+	if (Parse(Data, DataSize, View) == false)
+	{
+		return false;
+	}
+
+	const size_t EntityCount = static_cast<size_t>(View.EntityCount);
+	World.EntityIds.assign(View.EntityIds, View.EntityIds + EntityCount);
+	World.EntityIndices.assign(View.EntityIndices, View.EntityIndices + View.EntityIndexCount);
+	World.Transforms.assign(View.Transforms, View.Transforms + EntityCount);
+	World.Sprites.assign(View.Sprites, View.Sprites + EntityCount);
+	World.Names.assign(View.Names, View.Names + EntityCount);
+	World.NameTable.assign(View.NameTable, View.NameTable + View.NameTableSize);
+
+	// Validate ID references both ways so a corrupt file cannot produce out of range lookups later.
+	bool bSuccess = true;
+	for (size_t Index = 0; Index < EntityCount && bSuccess; ++Index)
+	{
+		const FEntityId EntityId = World.EntityIds[Index];
+		bSuccess = EntityId < World.EntityIndices.size() && World.EntityIndices[EntityId] == Index;
+	}
+
+	for (FEntityId EntityId = 0; EntityId < World.EntityIndices.size() && bSuccess; ++EntityId)
+	{
+		const Uint32 EntityIndex = World.EntityIndices[EntityId];
+		if (EntityIndex == INVALID_ENTITY_INDEX)
+		{
+			World.FreeEntityIds.push_back(EntityId);
+		}
+		else
+		{
+			bSuccess = EntityIndex < EntityCount && World.EntityIds[EntityIndex] == EntityId;
+		}
+	}
+
+	if (bSuccess == false)
+	{
+		SL_LOG_FUNC(LogSWorld, Error, "World archive has inconsistent entity IDs.");
+		World.DestroyAllEntities();
+		return false;
+	}
+
+	return true;
+}
+
+bool FWorldArchive::Parse(const void* Data, const size_t DataSize, FWorldArchiveView& OutView)
+{
+	OutView = FWorldArchiveView();
+
+	const auto Bytes = static_cast<const Uint8*>(Data);
+	if (Bytes == nullptr || DataSize < sizeof(FWorldArchiveHeader))
+	{
+		SL_LOG_FUNC(LogSWorld, Error, "World archive is too small.");
+		return false;
+	}
+
+	FWorldArchiveHeader Header;
+	memcpy(&Header, Bytes, sizeof(Header));
+	if (Header.Magic != MAGIC || Header.FileSize != DataSize)
+	{
+		SL_LOG_FUNC(LogSWorld, Error, "Data is not a world archive or is truncated.");
+		return false;
+	}
+
+	if (Header.Version != VERSION)
+	{
+		SL_LOG_FUNC(LogSWorld, Error, "Unsupported world archive version " + FString(static_cast<int>(Header.Version)) + ".");
+		return false;
+	}
+
+	if (Header.SectionCount > (DataSize - sizeof(Header)) / sizeof(FWorldArchiveSection))
+	{
+		SL_LOG_FUNC(LogSWorld, Error, "World archive section table is truncated.");
+		return false;
+	}
+
+	Uint64 TransformCount = 0;
+	Uint64 SpriteCount = 0;
+	Uint64 NameCount = 0;
+
+	bool bSuccess = true;
+	for (Uint16 Index = 0; Index < Header.SectionCount && bSuccess; ++Index)
+	{
+		FWorldArchiveSection Section;
+		memcpy(&Section, Bytes + sizeof(Header) + Index * sizeof(FWorldArchiveSection), sizeof(Section));
+
+		switch (Section.Type)
+		{
+		case EWorldArchiveSection::EntityIds:
+			bSuccess = GetSectionData(Section, Bytes, DataSize, OutView.EntityIds, OutView.EntityCount);
+			break;
+		case EWorldArchiveSection::EntityIndices:
+			bSuccess = GetSectionData(Section, Bytes, DataSize, OutView.EntityIndices, OutView.EntityIndexCount);
+			break;
+		case EWorldArchiveSection::Transforms:
+			bSuccess = GetSectionData(Section, Bytes, DataSize, OutView.Transforms, TransformCount);
+			break;
+		case EWorldArchiveSection::Sprites:
+			bSuccess = GetSectionData(Section, Bytes, DataSize, OutView.Sprites, SpriteCount);
+			break;
+		case EWorldArchiveSection::Names:
+			bSuccess = GetSectionData(Section, Bytes, DataSize, OutView.Names, NameCount);
+			break;
+		case EWorldArchiveSection::NameTable:
+			bSuccess = GetSectionData(Section, Bytes, DataSize, OutView.NameTable, OutView.NameTableSize);
+			break;
+		case EWorldArchiveSection::Unknown:
+		default:
+			// Sections from newer minor additions are skipped.
+			break;
+		}
+	}
+
+	// Every entity needs one of each component, and every name must land inside the null-terminated table.
+	bSuccess = bSuccess
+		&& TransformCount == OutView.EntityCount
+		&& SpriteCount == OutView.EntityCount
+		&& NameCount == OutView.EntityCount
+		&& OutView.NameTableSize > 0
+		&& OutView.NameTable[OutView.NameTableSize - 1] == '\0';
+
+	for (Uint64 Index = 0; Index < OutView.EntityCount && bSuccess; ++Index)
+	{
+		const FEntityName& Name = OutView.Names[Index];
+		bSuccess = Name.Offset < OutView.NameTableSize && Name.Length < OutView.NameTableSize - Name.Offset;
+	}
+
+	if (bSuccess == false)
+	{
+		SL_LOG_FUNC(LogSWorld, Error, "World archive is corrupt.");
+		OutView = FWorldArchiveView();
+		return false;
+	}
+
+	return true;
+}
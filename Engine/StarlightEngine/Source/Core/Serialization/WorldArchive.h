@@ -0,0 +1,91 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <SDL3/SDL_stdinc.h>
+
+// Starlight Engine
+#include "Framework/String.h"
+#include "Object/Entity.h"
+
+// Forward Declarations
+class SWorld;
+
+// Identifies each block of data inside a world archive.
+enum class EWorldArchiveSection : Uint32
+{
+	Unknown = 0,
+	EntityIds,
+	EntityIndices,
+	Transforms,
+	Sprites,
+	Names,
+	NameTable,
+};
+
+// Fixed header at the start of every world archive.
+struct FWorldArchiveHeader
+{
+	Uint32 Magic;
+	Uint16 Version;
+	Uint16 SectionCount;
+	Uint64 FileSize;
+};
+
+// Describes one component array. Data lives at Offset bytes from the start of the file.
+struct FWorldArchiveSection
+{
+	EWorldArchiveSection Type;
+	Uint32 ElementSize;
+	Uint64 Offset;
+	Uint64 Count;
+};
+
+// Read-only view of the entity data inside an archive buffer. Pointers point straight into the buffer.
+struct FWorldArchiveView
+{
+	Uint64 EntityCount = 0;
+	const FEntityId* EntityIds = nullptr;
+	const FTransform2D* Transforms = nullptr;
+	const FSpriteComponent* Sprites = nullptr;
+	const FEntityName* Names = nullptr;
+
+	Uint64 EntityIndexCount = 0;
+	const Uint32* EntityIndices = nullptr;
+
+	Uint64 NameTableSize = 0;
+	const char* NameTable = nullptr;
+};
+
+/**
+ * @brief Reads and writes SWorld entity data in a versioned binary format.
+ * The file is a header, a section table, then each of the world's dense component arrays stored byte for byte,
+ * so loading is one file read followed by one memcpy per array. References between arrays are stored as indices
+ * and offsets (never pointers), so no fix-up pass is needed after loading.
+ */
+class FWorldArchive
+{
+public:
+	// 'SLWD' as read from a little-endian file.
+	static constexpr Uint32 MAGIC = 0x44574C53;
+	static constexpr Uint16 VERSION = 1;
+
+	// Every section starts on this boundary so the data can be used in place from a mapped file.
+	static constexpr Uint64 SECTION_ALIGNMENT = 16;
+
+	/// @returns whether the world was written successfully.
+	static bool Save(const SWorld& World, const FString& FilePath);
+
+	// Replaces all entities in World with the contents of the file.
+	/// @returns whether the world was loaded successfully. World is left empty on failure.
+	static bool Load(SWorld& World, const FString& FilePath);
+
+	// Same as Load, but reads from an archive that is already in memory (e.g. a mapped file or streamed buffer).
+	static bool LoadFromMemory(SWorld& World, const void* Data, size_t DataSize);
+
+	// Validates an archive in memory and points OutView at its sections without copying anything.
+	// Data must be aligned to SECTION_ALIGNMENT and outlive the view.
+	/// @returns whether Data is a valid archive.
+	static bool Parse(const void* Data, size_t DataSize, FWorldArchiveView& OutView);
+};
@@ -0,0 +1,253 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "LooseQuadtree.h"
+
+FLooseQuadtree::FLooseQuadtree(const FBox2D& InWorldBounds, const Uint32 InMaxDepth)
+	: WorldBounds(InWorldBounds)
+	, MaxDepth(SMath::Min(InMaxDepth, MAX_DEPTH_LIMIT))
+{
+	Nodes.push_back(MakeNode(WorldBounds, 0));
+}
+
+template <typename TNodeFilter, typename TVisitor>
+void FLooseQuadtree::ForEachProxy(TNodeFilter&& NodeFilter, TVisitor&& Visitor) const
+{
+	// Depth first, so the stack never holds more than three siblings per level plus the node being expanded.
+	Uint32 Stack[3 * MAX_DEPTH_LIMIT + 4];
+	Uint32 StackSize = 0;
+	Stack[StackSize++] = 0;
+
+	while (StackSize > 0)
+	{
+		const FNode& Node = Nodes[Stack[--StackSize]];
+
+		// The root also holds entities outside the world bounds, so it is always searched.
+		if (Node.Depth > 0 && NodeFilter(Node) == false)
+		{
+			continue;
+		}
+
+		for (const FEntityId EntityId : Node.Entities)
+		{
+			if (Visitor(*Proxies.Find(EntityId)) == false)
+			{
+				return;
+			}
+		}
+
+		if (Node.FirstChild != 0)
+		{
+			for (Uint32 ChildIndex = 0; ChildIndex < 4; ++ChildIndex)
+			{
+				Stack[StackSize++] = Node.FirstChild + ChildIndex;
+			}
+		}
+	}
+}
+
+void FLooseQuadtree::Update(const FEntityId EntityId, const FBox2D& Bounds)
+{
+	const Uint32 NodeIndex = FindNode(Bounds);
+
+	FProxy* Proxy = Proxies.Find(EntityId);
+	if (Proxy == nullptr)
+	{
+		Proxy = &Proxies.Add(EntityId);
+		Proxy->Bounds = Bounds;
+		AddToNode(*Proxy, NodeIndex);
+		return;
+	}
+
+	Proxy->Bounds = Bounds;
+	if (Proxy->Node == NodeIndex)
+	{
+		return;
+	}
+
+	RemoveFromNode(*Proxy);
+	AddToNode(*Proxy, NodeIndex);
+}
+
+void FLooseQuadtree::Remove(const FEntityId EntityId)
+{
+	const FProxy* Proxy = Proxies.Find(EntityId);
+	if (Proxy == nullptr)
+	{
+		return;
+	}
+
+	RemoveFromNode(*Proxy);
+	Proxies.Remove(EntityId);
+}
+
+void FLooseQuadtree::Clear()
+{
+	Proxies.Clear();
+	Nodes.clear();
+	Nodes.push_back(MakeNode(WorldBounds, 0));
+}
+
+bool FLooseQuadtree::GetBounds(const FEntityId EntityId, FBox2D& OutBounds) const
+{
+	const FProxy* Proxy = Proxies.Find(EntityId);
+	if (Proxy == nullptr)
+	{
+		return false;
+	}
+
+	OutBounds = Proxy->Bounds;
+	return true;
+}
+
+Uint32 FLooseQuadtree::QueryBox(const FBox2D& Box, FEntityId* OutEntityIds, const Uint32 MaxResults) const
+{
+	Uint32 ResultCount = 0;
+	if (MaxResults == 0)
+	{
+		return ResultCount;
+	}
+
+	ForEachProxy(
+		[&](const FNode& Node) { return Node.LooseBounds.Intersects(Box); },
+		[&](const FProxy& Proxy)
+		{
+			if (Proxy.Bounds.Intersects(Box))
+			{
+				OutEntityIds[ResultCount++] = Proxy.EntityId;
+			}
+			return ResultCount < MaxResults;
+		});
+
+	return ResultCount;
+}
+
+Uint32 FLooseQuadtree::QueryRadius(const FVector2& Centre, const float Radius, FEntityId* OutEntityIds, const Uint32 MaxResults) const
+{
+	Uint32 ResultCount = 0;
+	if (MaxResults == 0)
+	{
+		return ResultCount;
+	}
+
+	ForEachProxy(
+		[&](const FNode& Node) { return Node.LooseBounds.IntersectsCircle(Centre, Radius); },
+		[&](const FProxy& Proxy)
+		{
+			if (Proxy.Bounds.IntersectsCircle(Centre, Radius))
+			{
+				OutEntityIds[ResultCount++] = Proxy.EntityId;
+			}
+			return ResultCount < MaxResults;
+		});
+
+	return ResultCount;
+}
+
+Uint32 FLooseQuadtree::Raycast(const FVector2& Origin, const FVector2& Direction, const float MaxDistance, FSpatialRayHit* OutHits, const Uint32 MaxHits) const
+{
+	if (MaxHits == 0)
+	{
+		return 0;
+	}
+
+	const FVector2 InverseDirection = FBox2D::SafeInverse(Direction);
+
+	Uint32 HitCount = 0;
+	ForEachProxy(
+		[&](const FNode& Node)
+		{
+			// Once the buffer is full, nodes entered beyond the furthest hit cannot improve it.
+			const float SearchDistance = HitCount == MaxHits ? OutHits[MaxHits - 1].Distance : MaxDistance;
+			float Distance;
+			return Node.LooseBounds.RayIntersects(Origin, InverseDirection, SearchDistance, Distance);
+		},
+		[&](const FProxy& Proxy)
+		{
+			float Distance;
+			if (Proxy.Bounds.RayIntersects(Origin, InverseDirection, MaxDistance, Distance))
+			{
+				InsertSortedHit({Proxy.EntityId, Distance}, OutHits, HitCount, MaxHits);
+			}
+			return true;
+		});
+
+	return HitCount;
+}
+
+FLooseQuadtree::FNode FLooseQuadtree::MakeNode(const FBox2D& Bounds, const Uint32 Depth)
+{
+	const FVector2 Extent = Bounds.GetExtent();
+
+	FNode Node;
+	Node.Bounds = Bounds;
+	Node.LooseBounds = FBox2D(Bounds.Min - Extent, Bounds.Max + Extent);
+	Node.Depth = Depth;
+	return Node;
+}
+
+Uint32 FLooseQuadtree::FindNode(const FBox2D& Bounds)
+{
+	const FVector2 Centre = Bounds.GetCentre();
+	const FVector2 Size = Bounds.GetSize();
+	if (WorldBounds.Contains(Centre) == false)
+	{
+		return 0;
+	}
+
+	// A node's loose bounds hold any box centred inside the node that is no larger than the node itself,
+	// so descend towards the centre for as long as the box still fits in the child.
+	Uint32 NodeIndex = 0;
+	while (Nodes[NodeIndex].Depth < MaxDepth)
+	{
+		const FBox2D NodeBounds = Nodes[NodeIndex].Bounds;
+		const FVector2 ChildSize = NodeBounds.GetExtent();
+		if (Size.x > ChildSize.x || Size.y > ChildSize.y)
+		{
+			break;
+		}
+
+		if (Nodes[NodeIndex].FirstChild == 0)
+		{
+			const Uint32 ChildDepth = Nodes[NodeIndex].Depth + 1;
+			const Uint32 FirstChild = static_cast<Uint32>(Nodes.size());
+			for (Uint32 ChildIndex = 0; ChildIndex < 4; ++ChildIndex)
+			{
+				const FVector2 ChildMin(
+					NodeBounds.Min.x + ((ChildIndex & 1) ? ChildSize.x : 0.f),
+					NodeBounds.Min.y + ((ChildIndex & 2) ? ChildSize.y : 0.f));
+				Nodes.push_back(MakeNode(FBox2D(ChildMin, ChildMin + ChildSize), ChildDepth));
+			}
+
+			// Nodes may have reallocated, so index again rather than holding a reference.
+			Nodes[NodeIndex].FirstChild = FirstChild;
+		}
+
+		const FVector2 NodeCentre = NodeBounds.GetCentre();
+		const Uint32 Quadrant = (Centre.x >= NodeCentre.x ? 1 : 0) | (Centre.y >= NodeCentre.y ? 2 : 0);
+		NodeIndex = Nodes[NodeIndex].FirstChild + Quadrant;
+	}
+
+	return NodeIndex;
+}
+
+void FLooseQuadtree::AddToNode(FProxy& Proxy, const Uint32 NodeIndex)
+{
+	std::vector<FEntityId>& Entities = Nodes[NodeIndex].Entities;
+	Proxy.Node = NodeIndex;
+	Proxy.Slot = static_cast<Uint32>(Entities.size());
+	Entities.push_back(Proxy.EntityId);
+}
+
+void FLooseQuadtree::RemoveFromNode(const FProxy& Proxy)
+{
+	std::vector<FEntityId>& Entities = Nodes[Proxy.Node].Entities;
+	const FEntityId MovedEntityId = Entities.back();
+	Entities[Proxy.Slot] = MovedEntityId;
+	Entities.pop_back();
+
+	if (MovedEntityId != Proxy.EntityId)
+	{
+		Proxies.Find(MovedEntityId)->Slot = Proxy.Slot;
+	}
+}
@@ -0,0 +1,82 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <vector>
+
+// Starlight Engine
+#include "SpatialIndex.h"
+
+/**
+ * @brief Quadtree whose nodes overlap their neighbours by half their size on every side.
+ * Best when entity sizes vary a lot. Each entity lives in exactly one node, picked from its centre and size alone,
+ * so moving an entity never splits or merges nodes and only re-files it when it changes node.
+ * Entities centred outside WorldBounds are kept in the root, which is always searched.
+ */
+class FLooseQuadtree : public ISpatialIndex
+{
+public:
+	static constexpr Uint32 MAX_DEPTH_LIMIT = 16;
+
+	FLooseQuadtree(const FBox2D& InWorldBounds, Uint32 InMaxDepth = 8);
+
+	void Update(FEntityId EntityId, const FBox2D& Bounds) override;
+	void Remove(FEntityId EntityId) override;
+	void Clear() override;
+
+	Uint32 GetCount() const override { return Proxies.GetCount(); }
+	bool GetBounds(FEntityId EntityId, FBox2D& OutBounds) const override;
+
+	Uint32 QueryBox(const FBox2D& Box, FEntityId* OutEntityIds, Uint32 MaxResults) const override;
+	Uint32 QueryRadius(const FVector2& Centre, float Radius, FEntityId* OutEntityIds, Uint32 MaxResults) const override;
+	Uint32 Raycast(const FVector2& Origin, const FVector2& Direction, float MaxDistance, FSpatialRayHit* OutHits, Uint32 MaxHits) const override;
+
+	const FBox2D& GetWorldBounds() const { return WorldBounds; }
+	Uint32 GetNodeCount() const { return static_cast<Uint32>(Nodes.size()); }
+
+private:
+	struct FNode
+	{
+		FBox2D Bounds;
+
+		// Bounds grown by half the node size on every side. Anything filed here lies inside them.
+		FBox2D LooseBounds;
+
+		// Index of the first of four consecutive children, 0 while the node is a leaf.
+		Uint32 FirstChild = 0;
+		Uint32 Depth = 0;
+
+		std::vector<FEntityId> Entities;
+	};
+
+	struct FProxy
+	{
+		FEntityId EntityId = INVALID_ENTITY_ID;
+		FBox2D Bounds;
+		Uint32 Node = 0;
+
+		// Index into the node's Entities.
+		Uint32 Slot = 0;
+	};
+
+	static FNode MakeNode(const FBox2D& Bounds, Uint32 Depth);
+
+	// Picks the deepest node whose loose bounds are guaranteed to hold Bounds, creating it if needed.
+	Uint32 FindNode(const FBox2D& Bounds);
+
+	void AddToNode(FProxy& Proxy, Uint32 NodeIndex);
+	void RemoveFromNode(const FProxy& Proxy);
+
+	// Calls Visitor(Proxy) for every entity in nodes whose loose bounds pass NodeFilter(Node).
+	template <typename TNodeFilter, typename TVisitor>
+	void ForEachProxy(TNodeFilter&& NodeFilter, TVisitor&& Visitor) const;
+
+	FBox2D WorldBounds;
+	Uint32 MaxDepth;
+
+	// Nodes[0] is the root. Children are created on first use and kept until Clear.
+	std::vector<FNode> Nodes;
+
+	TSpatialProxyTable<FProxy> Proxies;
+};
@@ -0,0 +1,333 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "SpatialHash.h"
+
+// Libraries
+#include <limits>
+
+FSpatialHash::FSpatialHash(const float InCellSize)
+	: CellSize(InCellSize)
+	, InverseCellSize(1.f / InCellSize)
+{
+	//
+}
+
+template <typename TVisitor>
+void FSpatialHash::ForEachInBox(const FBox2D& Box, TVisitor&& Visitor) const
+{
+	// Only cells inside the occupied range can hold anything, so huge or far away boxes cost no more than the world.
+	const FCellRange BoxRange = GetCellRange(Box);
+	const FCellRange QueryRange = {
+		SDL_max(BoxRange.MinX, OccupiedCells.MinX), SDL_max(BoxRange.MinY, OccupiedCells.MinY),
+		SDL_min(BoxRange.MaxX, OccupiedCells.MaxX), SDL_min(BoxRange.MaxY, OccupiedCells.MaxY)};
+	if (QueryRange.MinX > QueryRange.MaxX || QueryRange.MinY > QueryRange.MaxY)
+	{
+		return;
+	}
+
+	// An entity in several cells is only visited from the first of its cells inside the query, which reports it
+	// exactly once without any per-query scratch state.
+	const auto VisitCell = [&](const Sint32 CellX, const Sint32 CellY, const std::vector<FEntityId>& Cell)
+	{
+		for (const FEntityId EntityId : Cell)
+		{
+			const FProxy& Proxy = *Proxies.Find(EntityId);
+			const Sint32 HomeX = SDL_max(Proxy.Cells.MinX, QueryRange.MinX);
+			const Sint32 HomeY = SDL_max(Proxy.Cells.MinY, QueryRange.MinY);
+			if (CellX != HomeX || CellY != HomeY)
+			{
+				continue;
+			}
+
+			if (Visitor(Proxy) == false)
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	// When the query covers more cells than exist, walking the map is cheaper than looking each cell up.
+	const Uint64 QueryCellCount = static_cast<Uint64>(static_cast<Sint64>(QueryRange.MaxX) - QueryRange.MinX + 1) * static_cast<Uint64>(static_cast<Sint64>(QueryRange.MaxY) - QueryRange.MinY + 1);
+	if (QueryCellCount > Cells.size())
+	{
+		for (const auto& [CellKey, Cell] : Cells)
+		{
+			const Sint32 CellX = static_cast<Sint32>(static_cast<Uint32>(CellKey >> 32));
+			const Sint32 CellY = static_cast<Sint32>(static_cast<Uint32>(CellKey));
+			if (CellX < QueryRange.MinX || CellX > QueryRange.MaxX || CellY < QueryRange.MinY || CellY > QueryRange.MaxY)
+			{
+				continue;
+			}
+
+			if (VisitCell(CellX, CellY, Cell) == false)
+			{
+				return;
+			}
+		}
+		return;
+	}
+
+	for (Sint32 CellY = QueryRange.MinY; CellY <= QueryRange.MaxY; ++CellY)
+	{
+		for (Sint32 CellX = QueryRange.MinX; CellX <= QueryRange.MaxX; ++CellX)
+		{
+			const auto FoundCell = Cells.find(MakeCellKey(CellX, CellY));
+			if (FoundCell != Cells.end() && VisitCell(CellX, CellY, FoundCell->second) == false)
+			{
+				return;
+			}
+		}
+	}
+}
+
+void FSpatialHash::Update(const FEntityId EntityId, const FBox2D& Bounds)
+{
+	const FCellRange NewRange = GetCellRange(Bounds);
+
+	FProxy* Proxy = Proxies.Find(EntityId);
+	if (Proxy == nullptr)
+	{
+		Proxy = &Proxies.Add(EntityId);
+		Proxy->Bounds = Bounds;
+		Proxy->Cells = NewRange;
+		AddToCells(EntityId, NewRange);
+		return;
+	}
+
+	Proxy->Bounds = Bounds;
+
+	// Most moves stay inside the same cells, which needs no re-filing.
+	if (Proxy->Cells == NewRange)
+	{
+		return;
+	}
+
+	RemoveFromCells(EntityId, Proxy->Cells);
+	AddToCells(EntityId, NewRange);
+	Proxy->Cells = NewRange;
+}
+
+void FSpatialHash::Remove(const FEntityId EntityId)
+{
+	const FProxy* Proxy = Proxies.Find(EntityId);
+	if (Proxy == nullptr)
+	{
+		return;
+	}
+
+	RemoveFromCells(EntityId, Proxy->Cells);
+	Proxies.Remove(EntityId);
+}
+
+void FSpatialHash::Clear()
+{
+	Proxies.Clear();
+	Cells.clear();
+	OccupiedCells = EMPTY_CELL_RANGE;
+}
+
+bool FSpatialHash::GetBounds(const FEntityId EntityId, FBox2D& OutBounds) const
+{
+	const FProxy* Proxy = Proxies.Find(EntityId);
+	if (Proxy == nullptr)
+	{
+		return false;
+	}
+
+	OutBounds = Proxy->Bounds;
+	return true;
+}
+
+Uint32 FSpatialHash::QueryBox(const FBox2D& Box, FEntityId* OutEntityIds, const Uint32 MaxResults) const
+{
+	Uint32 ResultCount = 0;
+	if (MaxResults == 0)
+	{
+		return ResultCount;
+	}
+
+	ForEachInBox(Box, [&](const FProxy& Proxy)
+	{
+		if (Proxy.Bounds.Intersects(Box))
+		{
+			OutEntityIds[ResultCount++] = Proxy.EntityId;
+		}
+		return ResultCount < MaxResults;
+	});
+
+	return ResultCount;
+}
+
+Uint32 FSpatialHash::QueryRadius(const FVector2& Centre, const float Radius, FEntityId* OutEntityIds, const Uint32 MaxResults) const
+{
+	Uint32 ResultCount = 0;
+	if (MaxResults == 0)
+	{
+		return ResultCount;
+	}
+
+	ForEachInBox(FBox2D::FromCentreExtent(Centre, FVector2(Radius)), [&](const FProxy& Proxy)
+	{
+		if (Proxy.Bounds.IntersectsCircle(Centre, Radius))
+		{
+			OutEntityIds[ResultCount++] = Proxy.EntityId;
+		}
+		return ResultCount < MaxResults;
+	});
+
+	return ResultCount;
+}
+
+Uint32 FSpatialHash::Raycast(const FVector2& Origin, const FVector2& Direction, const float MaxDistance, FSpatialRayHit* OutHits, const Uint32 MaxHits) const
+{
+	if (MaxHits == 0)
+	{
+		return 0;
+	}
+
+	if (OccupiedCells.MinX > OccupiedCells.MaxX)
+	{
+		return 0;
+	}
+
+	const FVector2 InverseDirection = FBox2D::SafeInverse(Direction);
+	const bool bMovesX = SMath::Abs(Direction.x) > SMath::EPSILON;
+	const bool bMovesY = SMath::Abs(Direction.y) > SMath::EPSILON;
+
+	// Clip the segment to the occupied cells, so unbounded rays and rays starting far away only walk cells that can
+	// hold entities.
+	const FBox2D OccupiedBounds(
+		FVector2(static_cast<float>(OccupiedCells.MinX), static_cast<float>(OccupiedCells.MinY)) * CellSize,
+		FVector2(static_cast<float>(OccupiedCells.MaxX + 1), static_cast<float>(OccupiedCells.MaxY + 1)) * CellSize);
+
+	float EntryDistance = 0.f;
+	if (OccupiedBounds.RayIntersects(Origin, InverseDirection, MaxDistance, EntryDistance) == false)
+	{
+		return 0;
+	}
+
+	float ExitDistance = MaxDistance;
+	if (bMovesX)
+	{
+		ExitDistance = SMath::Min(ExitDistance, SMath::Max((OccupiedBounds.Min.x - Origin.x) * InverseDirection.x, (OccupiedBounds.Max.x - Origin.x) * InverseDirection.x));
+	}
+	if (bMovesY)
+	{
+		ExitDistance = SMath::Min(ExitDistance, SMath::Max((OccupiedBounds.Min.y - Origin.y) * InverseDirection.y, (OccupiedBounds.Max.y - Origin.y) * InverseDirection.y));
+	}
+
+	// Walk the cells along the ray in order (Amanatides & Woo), so the search can stop once the
+	// buffer is full and the next cell starts beyond the furthest hit. Clamped, since the entry point may round into the
+	// cell just outside.
+	const FVector2 Entry = Origin + Direction * EntryDistance;
+	Sint32 CellX = SDL_clamp(ToCell(Entry.x), OccupiedCells.MinX, OccupiedCells.MaxX);
+	Sint32 CellY = SDL_clamp(ToCell(Entry.y), OccupiedCells.MinY, OccupiedCells.MaxY);
+	const Sint32 StepX = Direction.x > 0.f ? 1 : -1;
+	const Sint32 StepY = Direction.y > 0.f ? 1 : -1;
+
+	// An axis the ray does not move along never crosses a cell boundary.
+	const float NextBoundaryX = static_cast<float>(StepX > 0 ? CellX + 1 : CellX) * CellSize;
+	const float NextBoundaryY = static_cast<float>(StepY > 0 ? CellY + 1 : CellY) * CellSize;
+	float TMaxX = bMovesX ? (NextBoundaryX - Origin.x) * InverseDirection.x : std::numeric_limits<float>::max();
+	float TMaxY = bMovesY ? (NextBoundaryY - Origin.y) * InverseDirection.y : std::numeric_limits<float>::max();
+	const float TDeltaX = CellSize * SMath::Abs(InverseDirection.x);
+	const float TDeltaY = CellSize * SMath::Abs(InverseDirection.y);
+
+	Uint32 HitCount = 0;
+	float CellEntryDistance = EntryDistance;
+	while (CellEntryDistance <= ExitDistance)
+	{
+		if (HitCount == MaxHits && CellEntryDistance > OutHits[MaxHits - 1].Distance)
+		{
+			break;
+		}
+
+		const auto FoundCell = Cells.find(MakeCellKey(CellX, CellY));
+		if (FoundCell != Cells.end())
+		{
+			for (const FEntityId EntityId : FoundCell->second)
+			{
+				// Entities spanning several cells are seen once per cell.
+				bool bAlreadyHit = false;
+				for (Uint32 HitIndex = 0; HitIndex < HitCount && bAlreadyHit == false; ++HitIndex)
+				{
+					bAlreadyHit = OutHits[HitIndex].EntityId == EntityId;
+				}
+
+				float Distance;
+				if (bAlreadyHit == false && Proxies.Find(EntityId)->Bounds.RayIntersects(Origin, InverseDirection, MaxDistance, Distance))
+				{
+					InsertSortedHit({EntityId, Distance}, OutHits, HitCount, MaxHits);
+				}
+			}
+		}
+
+		if (TMaxX < TMaxY)
+		{
+			CellEntryDistance = TMaxX;
+			TMaxX += TDeltaX;
+			CellX += StepX;
+		}
+		else
+		{
+			CellEntryDistance = TMaxY;
+			TMaxY += TDeltaY;
+			CellY += StepY;
+		}
+	}
+
+	return HitCount;
+}
+
+Uint64 FSpatialHash::MakeCellKey(const Sint32 CellX, const Sint32 CellY)
+{
+	return (static_cast<Uint64>(static_cast<Uint32>(CellX)) << 32) | static_cast<Uint32>(CellY);
+}
+
+Sint32 FSpatialHash::ToCell(const float Coordinate) const
+{
+	return static_cast<Sint32>(SMath::Floor(Coordinate * InverseCellSize));
+}
+
+FSpatialHash::FCellRange FSpatialHash::GetCellRange(const FBox2D& Bounds) const
+{
+	return {ToCell(Bounds.Min.x), ToCell(Bounds.Min.y), ToCell(Bounds.Max.x), ToCell(Bounds.Max.y)};
+}
+
+void FSpatialHash::AddToCells(const FEntityId EntityId, const FCellRange& Range)
+{
+	for (Sint32 CellY = Range.MinY; CellY <= Range.MaxY; ++CellY)
+	{
+		for (Sint32 CellX = Range.MinX; CellX <= Range.MaxX; ++CellX)
+		{
+			Cells[MakeCellKey(CellX, CellY)].push_back(EntityId);
+		}
+	}
+
+	OccupiedCells.MinX = SDL_min(OccupiedCells.MinX, Range.MinX);
+	OccupiedCells.MinY = SDL_min(OccupiedCells.MinY, Range.MinY);
+	OccupiedCells.MaxX = SDL_max(OccupiedCells.MaxX, Range.MaxX);
+	OccupiedCells.MaxY = SDL_max(OccupiedCells.MaxY, Range.MaxY);
+}
+
+void FSpatialHash::RemoveFromCells(const FEntityId EntityId, const FCellRange& Range)
+{
+	for (Sint32 CellY = Range.MinY; CellY <= Range.MaxY; ++CellY)
+	{
+		for (Sint32 CellX = Range.MinX; CellX <= Range.MaxX; ++CellX)
+		{
+			std::vector<FEntityId>& Cell = Cells[MakeCellKey(CellX, CellY)];
+			for (size_t Index = 0; Index < Cell.size(); ++Index)
+			{
+				if (Cell[Index] == EntityId)
+				{
+					Cell[Index] = Cell.back();
+					Cell.pop_back();
+					break;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,83 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <unordered_map>
+#include <vector>
+
+// Starlight Engine
+#include "SpatialIndex.h"
+
+/**
+ * @brief Uniform grid of square cells, stored sparsely in a hash map.
+ * Best when entities are of similar size and spread over an unbounded area. An entity is stored in every cell its
+ * bounds overlap, and only re-filed when it crosses into a different set of cells.
+ */
+class FSpatialHash : public ISpatialIndex
+{
+public:
+	// CellSize should be around the size of a typical entity, or a little larger.
+	explicit FSpatialHash(float InCellSize = 256.f);
+
+	void Update(FEntityId EntityId, const FBox2D& Bounds) override;
+	void Remove(FEntityId EntityId) override;
+	void Clear() override;
+
+	Uint32 GetCount() const override { return Proxies.GetCount(); }
+	bool GetBounds(FEntityId EntityId, FBox2D& OutBounds) const override;
+
+	Uint32 QueryBox(const FBox2D& Box, FEntityId* OutEntityIds, Uint32 MaxResults) const override;
+	Uint32 QueryRadius(const FVector2& Centre, float Radius, FEntityId* OutEntityIds, Uint32 MaxResults) const override;
+	Uint32 Raycast(const FVector2& Origin, const FVector2& Direction, float MaxDistance, FSpatialRayHit* OutHits, Uint32 MaxHits) const override;
+
+	float GetCellSize() const { return CellSize; }
+
+private:
+	// Inclusive range of cells covered by a box.
+	struct FCellRange
+	{
+		Sint32 MinX;
+		Sint32 MinY;
+		Sint32 MaxX;
+		Sint32 MaxY;
+
+		bool operator==(const FCellRange& Other) const
+		{
+			return MinX == Other.MinX && MinY == Other.MinY && MaxX == Other.MaxX && MaxY == Other.MaxY;
+		}
+	};
+
+	static constexpr FCellRange EMPTY_CELL_RANGE = {SDL_MAX_SINT32, SDL_MAX_SINT32, SDL_MIN_SINT32, SDL_MIN_SINT32};
+
+	struct FProxy
+	{
+		FEntityId EntityId = INVALID_ENTITY_ID;
+		FBox2D Bounds;
+		FCellRange Cells = {};
+	};
+
+	static Uint64 MakeCellKey(Sint32 CellX, Sint32 CellY);
+
+	Sint32 ToCell(float Coordinate) const;
+	FCellRange GetCellRange(const FBox2D& Bounds) const;
+
+	void AddToCells(FEntityId EntityId, const FCellRange& Range);
+	void RemoveFromCells(FEntityId EntityId, const FCellRange& Range);
+
+	// Calls Visitor(Proxy) once for every entity filed in the cells under Box.
+	template <typename TVisitor>
+	void ForEachInBox(const FBox2D& Box, TVisitor&& Visitor) const;
+
+	float CellSize;
+	float InverseCellSize;
+
+	TSpatialProxyTable<FProxy> Proxies;
+
+	// Cell key -> entities overlapping that cell. Emptied cells keep their storage for the next entity.
+	std::unordered_map<Uint64, std::vector<FEntityId>> Cells;
+
+	// Every cell an entity has been filed in since the last Clear, so rays only walk cells that can hold anything.
+	// Empty while MinX > MaxX.
+	FCellRange OccupiedCells = EMPTY_CELL_RANGE;
+};
@@ -0,0 +1,28 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "SpatialIndex.h"
+
+void ISpatialIndex::InsertSortedHit(const FSpatialRayHit& Hit, FSpatialRayHit* OutHits, Uint32& HitCount, const Uint32 MaxHits)
+{
+	if (HitCount == MaxHits)
+	{
+		if (Hit.Distance >= OutHits[MaxHits - 1].Distance)
+		{
+			return;
+		}
+
+		// Drop the furthest hit to make room.
+		--HitCount;
+	}
+
+	Uint32 InsertIndex = HitCount;
+	while (InsertIndex > 0 && OutHits[InsertIndex - 1].Distance > Hit.Distance)
+	{
+		OutHits[InsertIndex] = OutHits[InsertIndex - 1];
+		--InsertIndex;
+	}
+
+	OutHits[InsertIndex] = Hit;
+	++HitCount;
+}
@@ -0,0 +1,110 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <vector>
+
+// Starlight Engine
+#include "Math/Box2D.h"
+#include "Object/Entity.h"
+
+struct FSpatialRayHit
+{
+	FEntityId EntityId = INVALID_ENTITY_ID;
+
+	// Distance along the ray where it enters the entity's bounds, in units of the ray direction.
+	float Distance = 0.f;
+};
+
+/**
+ * @brief Acceleration structure answering "which entities are near here" without testing every entity.
+ * Entities are tracked by their axis-aligned bounds. Queries write into buffers owned by the caller so nothing is
+ * allocated per query, and return the number of results written (at most the buffer capacity).
+ * Queries are const and safe to run from several threads at once, as long as nothing is updating the index.
+ */
+class ISpatialIndex
+{
+public:
+	virtual ~ISpatialIndex() = default;
+
+	// Inserts the entity, or moves it if it is already in the index.
+	virtual void Update(FEntityId EntityId, const FBox2D& Bounds) = 0;
+	virtual void Remove(FEntityId EntityId) = 0;
+	virtual void Clear() = 0;
+
+	virtual Uint32 GetCount() const = 0;
+
+	/// @returns whether the entity is in the index.
+	virtual bool GetBounds(FEntityId EntityId, FBox2D& OutBounds) const = 0;
+
+	// Finds entities whose bounds overlap Box. Each entity is reported once.
+	virtual Uint32 QueryBox(const FBox2D& Box, FEntityId* OutEntityIds, Uint32 MaxResults) const = 0;
+
+	// Finds entities whose bounds overlap the circle. Each entity is reported once.
+	virtual Uint32 QueryRadius(const FVector2& Centre, float Radius, FEntityId* OutEntityIds, Uint32 MaxResults) const = 0;
+
+	// Finds entities whose bounds are crossed by the segment Origin + Direction * [0, MaxDistance], nearest first.
+	virtual Uint32 Raycast(const FVector2& Origin, const FVector2& Direction, float MaxDistance, FSpatialRayHit* OutHits, Uint32 MaxHits) const = 0;
+
+protected:
+	// Inserts Hit into a buffer sorted by distance, dropping the furthest hit when full.
+	static void InsertSortedHit(const FSpatialRayHit& Hit, FSpatialRayHit* OutHits, Uint32& HitCount, Uint32 MaxHits);
+};
+
+// Shared bookkeeping for ISpatialIndex implementations: maps entity IDs to a dense array of proxies.
+template <typename TProxy>
+class TSpatialProxyTable
+{
+public:
+	TProxy* Find(const FEntityId EntityId)
+	{
+		return EntityId < ProxyIndices.size() && ProxyIndices[EntityId] != INVALID_ENTITY_INDEX ? &Proxies[ProxyIndices[EntityId]] : nullptr;
+	}
+
+	const TProxy* Find(const FEntityId EntityId) const
+	{
+		return EntityId < ProxyIndices.size() && ProxyIndices[EntityId] != INVALID_ENTITY_INDEX ? &Proxies[ProxyIndices[EntityId]] : nullptr;
+	}
+
+	TProxy& Add(const FEntityId EntityId)
+	{
+		if (EntityId >= ProxyIndices.size())
+		{
+			ProxyIndices.resize(static_cast<size_t>(EntityId) + 1, INVALID_ENTITY_INDEX);
+		}
+
+		ProxyIndices[EntityId] = static_cast<Uint32>(Proxies.size());
+		Proxies.emplace_back();
+		Proxies.back().EntityId = EntityId;
+		return Proxies.back();
+	}
+
+	void Remove(const FEntityId EntityId)
+	{
+		const Uint32 Index = ProxyIndices[EntityId];
+		const Uint32 LastIndex = static_cast<Uint32>(Proxies.size()) - 1;
+		if (Index != LastIndex)
+		{
+			Proxies[Index] = Proxies[LastIndex];
+			ProxyIndices[Proxies[Index].EntityId] = Index;
+		}
+
+		Proxies.pop_back();
+		ProxyIndices[EntityId] = INVALID_ENTITY_INDEX;
+	}
+
+	void Clear()
+	{
+		Proxies.clear();
+		ProxyIndices.clear();
+	}
+
+	Uint32 GetCount() const { return static_cast<Uint32>(Proxies.size()); }
+
+private:
+	std::vector<TProxy> Proxies;
+
+	// Entity ID -> index into Proxies.
+	std::vector<Uint32> ProxyIndices;
+};
@@ -10,6 +10,7 @@
 // Starlight Engine
 #include "ResourceManager.h"
 #include "Debug/Logging.h"
+#include "Framework/TaskSystem.h"
 #include "Input/InputManager.h"
 #include "Renderer/Renderer.h"
 
@@ -35,6 +36,8 @@ bool Engine::Initialise()
 {
 	SL_LOG_FUNC_SCOPE(LogEngine, Debug);
 
+	FTaskSystem::Initialise();
+
 	if (InitialiseMainWindow() == false)
 	{
 		return false;
@@ -45,6 +48,11 @@ bool Engine::Initialise()
 		return false;
 	}
 
+	// Added first, so the UI sees pointer input before the game does.
+	m_inputManager.AddProcessor(&m_uiInputRouter);
+
+	m_appInstance = NewObject<SAppInstance>(nullptr);
+
 	return true;
 }
 
@@ -52,7 +60,12 @@ void Engine::Shutdown()
 {
 	SL_LOG_FUNC_SCOPE(LogEngine, Debug);
 
+	m_inputManager.RemoveProcessor(&m_uiInputRouter);
+	SetRootWidget(nullptr);
+	m_uiDrawList.Clear();
+	m_appInstance.reset();
 	ShutdownMainWindow();
+	FTaskSystem::Shutdown();
 }
 
 bool Engine::InitialiseMainWindow()
@@ -119,20 +132,54 @@ void Engine::ShutdownMainWindow()
 
 void Engine::Tick(bool& IsRunning, float DeltaTime)
 {
-	m_inputManager.ProcessEvents(IsRunning);
+	m_inputManager.ProcessEvents(IsRunning, DeltaTime);
 	if (IsRunning == false)
 	{
 		return;
 	}
 
+	m_appInstance->Tick(DeltaTime);
+
 	Render();
 }
 
+void Engine::SetRootWidget(const TObjectPtr<SWidget>& InRootWidget)
+{
+	m_rootWidget = InRootWidget;
+	m_uiInputRouter.SetRootWidget(InRootWidget);
+}
+
 void Engine::Render()
 {
 	m_mainRenderer.BeginFrame();
 
-	// TODO: Render everything. Probably make the game pass separate from the UI pass.
+	// The UI's retained draw list points at glyph pages a render reset destroyed.
+	if (m_mainRenderer.WereTexturesLost() && m_rootWidget)
+	{
+		m_rootWidget->InvalidatePaint();
+	}
+
+	// Game pass
+	if (m_appInstance)
+	{
+		if (const TObjectPtr<SWorld> World = m_appInstance->GetWorld().lock())
+		{
+			m_mainRenderer.DrawWorld(*World);
+		}
+	}
+
+	// UI pass
+	if (m_rootWidget)
+	{
+		// Both steps only do work for widgets that changed, so an unchanged UI redraws its previous draw list.
+		if (m_rootWidget->UpdateLayout(m_mainRenderer.GetCamera().ViewportSize))
+		{
+			m_uiInputRouter.InvalidateHitTestGrid();
+		}
+
+		m_rootWidget->UpdateDrawList(m_uiDrawList);
+		m_mainRenderer.DrawLattice(m_uiDrawList);
+	}
 
 	m_mainRenderer.EndFrame();
 }
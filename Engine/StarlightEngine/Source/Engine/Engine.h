@@ -6,6 +6,10 @@
 #include "Framework/String.h"
 #include "Input/InputManager.h"
 #include "Renderer/Renderer.h"
+#include "Object/AppInstance.h"
+#include "Lattice/DrawList.h"
+#include "Lattice/InputRouter.h"
+#include "Lattice/Widget.h"
 
 // Forward Declarations
 struct SDL_Window;
@@ -26,11 +30,22 @@ class Engine
 	SDL_Window* m_mainWindow = nullptr;
 	Renderer m_mainRenderer;
 	InputManager m_inputManager;
+	TObjectPtr<SAppInstance> m_appInstance;
+
+	// Screen-space UI, laid out and drawn over the game every frame.
+	TObjectPtr<SWidget> m_rootWidget;
+	FLatticeDrawList m_uiDrawList;
+	FLatticeInputRouter m_uiInputRouter;
 
 	void Tick(bool& IsRunning, float DeltaTime);
 	void Render();
 
 public:
+	const InputManager& GetInputManager() const { return m_inputManager; }
+
+	void SetRootWidget(const TObjectPtr<SWidget>& InRootWidget);
+	const TObjectPtr<SWidget>& GetRootWidget() const { return m_rootWidget; }
+
 	class Version
 	{
 	public:
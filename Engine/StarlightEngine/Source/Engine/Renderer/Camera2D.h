@@ -0,0 +1,35 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Starlight Engine
+#include "Math/Box2D.h"
+#include "Math/Vector2.h"
+
+// Orthographic 2D camera. Maps world units to screen pixels, with Position at the centre of the viewport.
+struct FCamera2D
+{
+	FVector2 Position = FVector2(0.f);
+
+	// Screen pixels per world unit.
+	float Zoom = 1.f;
+
+	// Size of the render target in pixels, kept up to date by the renderer.
+	FVector2 ViewportSize = FVector2(0.f);
+
+	// The area of the world currently on screen.
+	FBox2D GetViewBounds() const
+	{
+		return FBox2D::FromCentreExtent(Position, ViewportSize * (0.5f / Zoom));
+	}
+
+	FVector2 WorldToScreen(const FVector2& WorldPosition) const
+	{
+		return (WorldPosition - Position) * Zoom + ViewportSize * 0.5f;
+	}
+
+	FVector2 ScreenToWorld(const FVector2& ScreenPosition) const
+	{
+		return (ScreenPosition - ViewportSize * 0.5f) / Zoom + Position;
+	}
+};
@@ -0,0 +1,238 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "Font.h"
+
+// Starlight Engine
+#include "Debug/Logging.h"
+#include "Lattice/DrawList.h"
+
+namespace
+{
+constexpr int ATLAS_PAGE_SIZE = 512;
+
+// Empty pixels kept around each glyph so filtering never samples its neighbours.
+constexpr int ATLAS_PADDING = 1;
+
+// Once this many distinct strings are cached, the cache starts over rather than growing without bound, e.g. for a
+// label showing a value that changes every frame.
+constexpr size_t MAX_SHAPED_RUNS = 1024;
+}
+
+FFont::FFont(SDL_Renderer* InRenderer, TUniquePtr<IGlyphRasterizer> InRasterizer, const float InPixelSize)
+	: Renderer(InRenderer)
+	, Rasterizer(std::move(InRasterizer))
+	, PixelSize(InPixelSize)
+{
+	LineHeight = Rasterizer ? Rasterizer->GetLineHeight(PixelSize) : 0.f;
+}
+
+FFont::~FFont()
+{
+	ReleaseAtlas();
+}
+
+void FFont::ReleaseAtlas()
+{
+	for (SDL_Texture* Page : AtlasPages)
+	{
+		SDL_DestroyTexture(Page);
+	}
+
+	AtlasPages.clear();
+	ShelfX = 0;
+	ShelfY = 0;
+	ShelfHeight = 0;
+	Glyphs.clear();
+	ShapedRuns.clear();
+}
+
+const FShapedText& FFont::Shape(const FString& Text)
+{
+	const Uint64 Hash = HashText(Text);
+
+	const auto Found = ShapedRuns.find(Hash);
+	if (Found != ShapedRuns.end() && Found->second.Text == Text)
+	{
+		return Found->second;
+	}
+
+	if (Found == ShapedRuns.end() && ShapedRuns.size() >= MAX_SHAPED_RUNS)
+	{
+		ShapedRuns.clear();
+	}
+
+	// A hash collision simply replaces the other string's run.
+	FShapedText& ShapedText = ShapedRuns[Hash];
+	BuildShapedText(Text, ShapedText);
+	return ShapedText;
+}
+
+void FFont::DrawText(FLatticeDrawList& DrawList, const FString& Text, const FVector2& Position, const FRenderColor& Color)
+{
+	const FShapedText& ShapedText = Shape(Text);
+	const FVector2 Origin(SDL_roundf(Position.x), SDL_roundf(Position.y));
+
+	for (const FShapedGlyph& Glyph : ShapedText.Glyphs)
+	{
+		DrawList.AddTexturedRect(FBox2D(Glyph.Rect.Min + Origin, Glyph.Rect.Max + Origin), Glyph.Texture, Glyph.UVMin, Glyph.UVMax, Color);
+	}
+}
+
+const FFont::FGlyph* FFont::FindOrAddGlyph(const Uint32 Codepoint)
+{
+	const auto Found = Glyphs.find(Codepoint);
+	if (Found != Glyphs.end())
+	{
+		return &Found->second;
+	}
+
+	if (Rasterizer == nullptr)
+	{
+		return nullptr;
+	}
+
+	FGlyph Glyph;
+	if (Rasterizer->GetGlyphMetrics(Codepoint, PixelSize, Glyph.Metrics) == false)
+	{
+		// Remember the fallback under this codepoint too, so it is only looked up once.
+		const FGlyph* Fallback = Codepoint != '?' ? FindOrAddGlyph('?') : nullptr;
+		return Fallback != nullptr ? &Glyphs.emplace(Codepoint, *Fallback).first->second : nullptr;
+	}
+
+	SDL_Rect AtlasRect;
+	if (Glyph.Metrics.BitmapWidth > 0 && Glyph.Metrics.BitmapHeight > 0 && AllocateAtlasRect(Glyph.Metrics.BitmapWidth, Glyph.Metrics.BitmapHeight, Glyph.Texture, AtlasRect))
+	{
+		SDL_Texture* PreviousTarget = SDL_GetRenderTarget(Renderer);
+		SDL_FColor PreviousDrawColor;
+		SDL_GetRenderDrawColorFloat(Renderer, &PreviousDrawColor.r, &PreviousDrawColor.g, &PreviousDrawColor.b, &PreviousDrawColor.a);
+
+		SDL_SetRenderTarget(Renderer, Glyph.Texture);
+		if (Rasterizer->RasterizeGlyph(Renderer, Codepoint, PixelSize, AtlasRect.x, AtlasRect.y) == false)
+		{
+			SL_LOG_FUNC(LogRenderer, Warning, "Could not rasterize glyph " + FString(static_cast<int>(Codepoint)) + "! SDL_Error: " + SDL_GetErrorFString());
+		}
+
+		SDL_SetRenderTarget(Renderer, PreviousTarget);
+		SDL_SetRenderDrawColorFloat(Renderer, PreviousDrawColor.r, PreviousDrawColor.g, PreviousDrawColor.b, PreviousDrawColor.a);
+
+		constexpr float INVERSE_PAGE_SIZE = 1.f / static_cast<float>(ATLAS_PAGE_SIZE);
+		Glyph.UVMin = FVector2(static_cast<float>(AtlasRect.x), static_cast<float>(AtlasRect.y)) * INVERSE_PAGE_SIZE;
+		Glyph.UVMax = FVector2(static_cast<float>(AtlasRect.x + AtlasRect.w), static_cast<float>(AtlasRect.y + AtlasRect.h)) * INVERSE_PAGE_SIZE;
+	}
+	else
+	{
+		Glyph.Texture = nullptr;
+	}
+
+	return &Glyphs.emplace(Codepoint, Glyph).first->second;
+}
+
+bool FFont::AllocateAtlasRect(const int Width, const int Height, SDL_Texture*& OutPage, SDL_Rect& OutRect)
+{
+	if (Width > ATLAS_PAGE_SIZE - ATLAS_PADDING * 2 || Height > ATLAS_PAGE_SIZE - ATLAS_PADDING * 2)
+	{
+		SL_LOG_FUNC(LogRenderer, Warning, "Glyph of " + FString(Width) + "x" + FString(Height) + " does not fit in an atlas page!");
+		return false;
+	}
+
+	// Next shelf when this one is out of width, next page when out of shelves.
+	if (AtlasPages.empty() == false && ShelfX + Width + ATLAS_PADDING > ATLAS_PAGE_SIZE)
+	{
+		ShelfX = ATLAS_PADDING;
+		ShelfY += ShelfHeight + ATLAS_PADDING;
+		ShelfHeight = 0;
+	}
+
+	if (AtlasPages.empty() || ShelfY + Height + ATLAS_PADDING > ATLAS_PAGE_SIZE)
+	{
+		SDL_Texture* Page = SDL_CreateTexture(Renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+		if (Page == nullptr)
+		{
+			SL_LOG_FUNC(LogRenderer, Error, "Could not create a glyph atlas page! SDL_Error: " + SDL_GetErrorFString());
+			return false;
+		}
+
+		SDL_SetTextureBlendMode(Page, SDL_BLENDMODE_BLEND);
+		SDL_SetTextureScaleMode(Page, Rasterizer->GetScaleMode());
+
+		// Render targets start with undefined contents.
+		SDL_Texture* PreviousTarget = SDL_GetRenderTarget(Renderer);
+		SDL_SetRenderTarget(Renderer, Page);
+		SDL_SetRenderDrawColor(Renderer, 0, 0, 0, SDL_ALPHA_TRANSPARENT);
+		SDL_RenderClear(Renderer);
+		SDL_SetRenderTarget(Renderer, PreviousTarget);
+
+		AtlasPages.push_back(Page);
+		ShelfX = ATLAS_PADDING;
+		ShelfY = ATLAS_PADDING;
+		ShelfHeight = 0;
+	}
+
+	OutPage = AtlasPages.back();
+	OutRect = {ShelfX, ShelfY, Width, Height};
+
+	ShelfX += Width + ATLAS_PADDING;
+	ShelfHeight = SDL_max(ShelfHeight, Height);
+	return true;
+}
+
+void FFont::BuildShapedText(const FString& Text, FShapedText& OutShapedText)
+{
+	OutShapedText.Text = Text;
+	OutShapedText.Glyphs.clear();
+	OutShapedText.Size = FVector2(0.f);
+
+	if (Text.IsEmpty())
+	{
+		return;
+	}
+
+	const char* Cursor = Text.CStr();
+	size_t Remaining = static_cast<size_t>(Text.GetLength());
+
+	FVector2 Pen(0.f);
+	float Width = 0.f;
+	while (Remaining > 0)
+	{
+		const Uint32 Codepoint = SDL_StepUTF8(&Cursor, &Remaining);
+		if (Codepoint == '\n')
+		{
+			Width = SMath::Max(Width, Pen.x);
+			Pen = FVector2(0.f, Pen.y + LineHeight);
+			continue;
+		}
+
+		const FGlyph* Glyph = Codepoint != '\r' ? FindOrAddGlyph(Codepoint) : nullptr;
+		if (Glyph == nullptr)
+		{
+			continue;
+		}
+
+		if (Glyph->Texture != nullptr)
+		{
+			FShapedGlyph& ShapedGlyph = OutShapedText.Glyphs.emplace_back();
+			ShapedGlyph.Rect = FBox2D(Glyph->Metrics.Bounds.Min + Pen, Glyph->Metrics.Bounds.Max + Pen);
+			ShapedGlyph.Texture = Glyph->Texture;
+			ShapedGlyph.UVMin = Glyph->UVMin;
+			ShapedGlyph.UVMax = Glyph->UVMax;
+		}
+
+		Pen.x += Glyph->Metrics.Advance;
+	}
+
+	OutShapedText.Size = FVector2(SMath::Max(Width, Pen.x), Pen.y + LineHeight);
+}
+
+Uint64 FFont::HashText(const FString& Text)
+{
+	// FNV-1a.
+	Uint64 Hash = 14695981039346656037ull;
+	for (int Index = 0; Index < Text.GetLength(); ++Index)
+	{
+		Hash ^= static_cast<Uint8>(Text[Index]);
+		Hash *= 1099511628211ull;
+	}
+
+	return Hash;
+}
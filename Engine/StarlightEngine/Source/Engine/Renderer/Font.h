@@ -0,0 +1,113 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <unordered_map>
+#include <vector>
+
+// SDL
+#include <SDL3/SDL_render.h>
+
+// Starlight Engine
+#include "GlyphRasterizer.h"
+#include "Pointers.h"
+#include "Framework/Color.h"
+#include "Framework/String.h"
+
+// Forward Declarations
+class FLatticeDrawList;
+
+// A glyph placed in a shaped run, relative to the run's top left.
+struct FShapedGlyph
+{
+	FBox2D Rect;
+
+	// Atlas page the glyph lives in.
+	SDL_Texture* Texture = nullptr;
+	FVector2 UVMin;
+	FVector2 UVMax;
+};
+
+// A string laid out into glyph quads, ready to be drawn at any position.
+struct FShapedText
+{
+	FString Text;
+	std::vector<FShapedGlyph> Glyphs;
+	FVector2 Size;
+};
+
+/**
+ * @brief A typeface at one pixel size, with its glyphs rasterized on demand into a dynamic atlas.
+ * Each glyph is rasterized once, the first time it is used, into a shelf-packed atlas page. A full page is never
+ * repacked; a new one is started instead, so glyphs already handed out stay valid until ReleaseAtlas.
+ * Shaped runs are cached by the hash of their string, so drawing the same labels every frame neither rasterizes nor
+ * lays out anything again, and costs one quad per glyph in the draw list.
+ */
+class FFont
+{
+public:
+	FFont(SDL_Renderer* InRenderer, TUniquePtr<IGlyphRasterizer> InRasterizer, float InPixelSize);
+	~FFont();
+
+	FFont(const FFont&) = delete;
+	FFont& operator=(const FFont&) = delete;
+
+	float GetPixelSize() const { return PixelSize; }
+	float GetLineHeight() const { return LineHeight; }
+
+	/**
+	 * @brief Lays out Text, or returns its cached layout. '\n' starts a new line.
+	 * The reference is only valid until the next call, since a full cache is emptied before adding to it.
+	 */
+	const FShapedText& Shape(const FString& Text);
+
+	FVector2 MeasureText(const FString& Text) { return Shape(Text).Size; }
+
+	// Emits Text into DrawList with its top left at Position, snapped to whole pixels.
+	void DrawText(FLatticeDrawList& DrawList, const FString& Text, const FVector2& Position, const FRenderColor& Color);
+
+	/**
+	 * @brief Destroys the atlas pages and forgets every glyph and shaped run, so they are rasterized again on next use.
+	 * The pages are render targets, so this must be called when the renderer loses them, as the renderer does for its
+	 * default font. Draw lists holding the old pages must be rebuilt.
+	 */
+	void ReleaseAtlas();
+
+	Uint32 GetGlyphCount() const { return static_cast<Uint32>(Glyphs.size()); }
+	Uint32 GetAtlasPageCount() const { return static_cast<Uint32>(AtlasPages.size()); }
+
+private:
+	struct FGlyph
+	{
+		FGlyphMetrics Metrics;
+		SDL_Texture* Texture = nullptr;
+		FVector2 UVMin;
+		FVector2 UVMax;
+	};
+
+	// Returns the glyph for Codepoint, rasterizing it on first use. Null if neither it nor '?' has a glyph.
+	const FGlyph* FindOrAddGlyph(Uint32 Codepoint);
+
+	// Reserves space for a Width x Height bitmap, starting a new atlas page if the current one is full.
+	bool AllocateAtlasRect(int Width, int Height, SDL_Texture*& OutPage, SDL_Rect& OutRect);
+
+	void BuildShapedText(const FString& Text, FShapedText& OutShapedText);
+
+	static Uint64 HashText(const FString& Text);
+
+	SDL_Renderer* Renderer = nullptr;
+	TUniquePtr<IGlyphRasterizer> Rasterizer;
+	float PixelSize = 0.f;
+	float LineHeight = 0.f;
+
+	std::vector<SDL_Texture*> AtlasPages;
+
+	// Shelf packing cursor in the last atlas page.
+	int ShelfX = 0;
+	int ShelfY = 0;
+	int ShelfHeight = 0;
+
+	std::unordered_map<Uint32, FGlyph> Glyphs;
+	std::unordered_map<Uint64, FShapedText> ShapedRuns;
+};
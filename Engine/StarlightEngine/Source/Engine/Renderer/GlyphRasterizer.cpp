@@ -0,0 +1,69 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "GlyphRasterizer.h"
+
+// Starlight Engine
+#include "Math/Math.h"
+
+namespace
+{
+constexpr int DEBUG_GLYPH_SIZE = SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE;
+
+// Blank rows kept between lines, in glyph pixels.
+constexpr int DEBUG_LINE_GAP = 2;
+}
+
+float FDebugGlyphRasterizer::GetScale(const float PixelSize)
+{
+	return SMath::Max(1.f, SDL_roundf(PixelSize / static_cast<float>(DEBUG_GLYPH_SIZE)));
+}
+
+float FDebugGlyphRasterizer::GetLineHeight(const float PixelSize) const
+{
+	return static_cast<float>(DEBUG_GLYPH_SIZE + DEBUG_LINE_GAP) * GetScale(PixelSize);
+}
+
+bool FDebugGlyphRasterizer::GetGlyphMetrics(const Uint32 Codepoint, const float PixelSize, FGlyphMetrics& OutMetrics) const
+{
+	// The debug font only has printable ASCII.
+	if (Codepoint < ' ' || Codepoint > '~')
+	{
+		return false;
+	}
+
+	const float Scale = GetScale(PixelSize);
+	const float GlyphSize = static_cast<float>(DEBUG_GLYPH_SIZE) * Scale;
+	const float Top = static_cast<float>(DEBUG_LINE_GAP / 2) * Scale;
+
+	OutMetrics = FGlyphMetrics();
+	OutMetrics.Advance = GlyphSize;
+	if (Codepoint != ' ')
+	{
+		OutMetrics.BitmapWidth = static_cast<int>(GlyphSize);
+		OutMetrics.BitmapHeight = static_cast<int>(GlyphSize);
+		OutMetrics.Bounds = FBox2D(FVector2(0.f, Top), FVector2(GlyphSize, Top + GlyphSize));
+	}
+
+	return true;
+}
+
+bool FDebugGlyphRasterizer::RasterizeGlyph(SDL_Renderer* Renderer, const Uint32 Codepoint, const float PixelSize, const int X, const int Y) const
+{
+	char Utf8[5] = {};
+	SDL_UCS4ToUTF8(Codepoint, Utf8);
+
+	// The debug font only draws at 8x8, so it is drawn under a render scale to bake the glyph at the size its metrics
+	// report.
+	float PreviousScaleX = 1.f;
+	float PreviousScaleY = 1.f;
+	SDL_GetRenderScale(Renderer, &PreviousScaleX, &PreviousScaleY);
+
+	const float Scale = GetScale(PixelSize);
+	SDL_SetRenderScale(Renderer, Scale, Scale);
+	SDL_SetRenderDrawColor(Renderer, 255, 255, 255, SDL_ALPHA_OPAQUE);
+	const bool bSuccess = SDL_RenderDebugText(Renderer, static_cast<float>(X) / Scale, static_cast<float>(Y) / Scale, Utf8);
+
+	SDL_SetRenderScale(Renderer, PreviousScaleX, PreviousScaleY);
+	return bSuccess;
+}
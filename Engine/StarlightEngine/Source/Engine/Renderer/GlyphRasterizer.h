@@ -0,0 +1,63 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// SDL
+#include <SDL3/SDL_render.h>
+
+// Starlight Engine
+#include "Math/Box2D.h"
+
+struct FGlyphMetrics
+{
+	// Size of the glyph's bitmap in the atlas. Zero for glyphs with nothing to draw, e.g. spaces.
+	int BitmapWidth = 0;
+	int BitmapHeight = 0;
+
+	// Where the bitmap is drawn, relative to the pen at the top of the line. May differ in size from the bitmap when
+	// the rasterizer bakes glyphs at a different size than they are drawn.
+	FBox2D Bounds;
+
+	// How far the pen moves on after this glyph.
+	float Advance = 0.f;
+};
+
+/**
+ * @brief Turns codepoints into glyph bitmaps for FFont.
+ * Glyphs are drawn in white straight into the font's atlas, which is the current render target while RasterizeGlyph
+ * runs, so the font can tint them with any color when drawing.
+ */
+class IGlyphRasterizer
+{
+public:
+	virtual ~IGlyphRasterizer() = default;
+
+	// Distance between the tops of two lines of text.
+	virtual float GetLineHeight(float PixelSize) const = 0;
+
+	/// @returns false if the codepoint has no glyph, in which case the font falls back to '?'.
+	virtual bool GetGlyphMetrics(Uint32 Codepoint, float PixelSize, FGlyphMetrics& OutMetrics) const = 0;
+
+	// Draws the glyph's bitmap with its top left at (X, Y) of the current render target.
+	virtual bool RasterizeGlyph(SDL_Renderer* Renderer, Uint32 Codepoint, float PixelSize, int X, int Y) const = 0;
+
+	// How the atlas should be sampled when drawing glyphs from this rasterizer.
+	virtual SDL_ScaleMode GetScaleMode() const { return SDL_SCALEMODE_LINEAR; }
+};
+
+/**
+ * @brief SDL's built-in 8x8 ASCII bitmap font.
+ * Always available, as it needs no font file. Pixel sizes are rounded to the nearest whole multiple of 8, at which
+ * glyphs are baked and reported by the metrics, so they stay crisp.
+ */
+class FDebugGlyphRasterizer : public IGlyphRasterizer
+{
+public:
+	float GetLineHeight(float PixelSize) const override;
+	bool GetGlyphMetrics(Uint32 Codepoint, float PixelSize, FGlyphMetrics& OutMetrics) const override;
+	bool RasterizeGlyph(SDL_Renderer* Renderer, Uint32 Codepoint, float PixelSize, int X, int Y) const override;
+	SDL_ScaleMode GetScaleMode() const override { return SDL_SCALEMODE_NEAREST; }
+
+private:
+	static float GetScale(float PixelSize);
+};
@@ -0,0 +1,42 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// SDL
+#include <SDL3/SDL_rect.h>
+
+// Starlight Engine
+#include "Framework/Color.h"
+
+// A sprite that survived culling, already transformed into screen space.
+struct FRenderSprite
+{
+	// Screen-space corners: top left, top right, bottom right, bottom left.
+	SDL_FPoint Corners[4];
+
+	// Packed once at cull time, keeping the sorted sprite stream small.
+	FPackedColor Tint;
+	Uint32 TextureId = 0;
+	Sint32 SortOrder = 0;
+};
+
+// Counters for the last rendered frame, reset by BeginFrame.
+struct FRenderStats
+{
+	// Sprites sent to the GPU.
+	Uint32 SpritesDrawn = 0;
+
+	// Entities in the world that were skipped because they were off screen or had no sprite.
+	Uint32 SpritesCulled = 0;
+
+	Uint32 ParticlesDrawn = 0;
+
+	// Tilemap chunks drawn from their baked textures, and chunks that had to be baked first.
+	Uint32 TileChunksDrawn = 0;
+	Uint32 TileChunksBaked = 0;
+
+	Uint32 DrawCalls = 0;
+
+	// Time spent culling the world, in nanoseconds.
+	Uint64 CullTimeNS = 0;
+};
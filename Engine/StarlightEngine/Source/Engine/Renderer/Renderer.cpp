@@ -11,6 +11,10 @@
 
 #include "Debug/Logging.h"
 #include "Engine/ResourceManager.h"
+#include "Lattice/DrawList.h"
+#include "Framework/TaskSystem.h"
+#include "Object/World.h"
+#include "Particles/ParticleEmitter.h"
 
 Renderer::Renderer() :
 	m_renderer(nullptr)
@@ -37,11 +41,22 @@ bool Renderer::Initialise(SDL_Window* Window)
 		// BHH TODO: Throw an exception
 	}
 
+	SDL_AddEventWatch(OnRenderEvent, this);
+
+	constexpr float DEFAULT_FONT_SIZE = 16.f;
+	m_defaultFont = TMakeShared<FFont>(m_renderer, TUniquePtr<IGlyphRasterizer>(new FDebugGlyphRasterizer()), DEFAULT_FONT_SIZE);
+
 	return true;
 }
 
 void Renderer::Shutdown()
 {
+	SDL_RemoveEventWatch(OnRenderEvent, this);
+
+	// Their textures belong to the renderer.
+	m_defaultFont.reset();
+	m_tilemapRenderer.Release();
+
 	if (m_renderer != nullptr)
 	{
 		SDL_DestroyRenderer(m_renderer);
@@ -49,16 +64,68 @@ void Renderer::Shutdown()
 	}
 }
 
-void Renderer::BeginFrame() const
+void Renderer::BeginFrame()
 {
+	m_frameStats = FRenderStats();
+	HandleRenderResets();
+	m_tilemapRenderer.BeginFrame();
+
 	if (m_renderer == nullptr)
 	{
 		return;
 	}
 
+	int OutputWidth = 0;
+	int OutputHeight = 0;
+	if (SDL_GetCurrentRenderOutputSize(m_renderer, &OutputWidth, &OutputHeight))
+	{
+		m_camera.ViewportSize = FVector2(static_cast<float>(OutputWidth), static_cast<float>(OutputHeight));
+	}
+
 	Clear();
 }
 
+bool SDLCALL Renderer::OnRenderEvent(void* UserData, SDL_Event* Event)
+{
+	Renderer* Self = static_cast<Renderer*>(UserData);
+	if (Event->type == SDL_EVENT_RENDER_TARGETS_RESET)
+	{
+		Self->m_renderTargetsReset = true;
+	}
+	else if (Event->type == SDL_EVENT_RENDER_DEVICE_RESET)
+	{
+		Self->m_renderDeviceReset = true;
+	}
+
+	return true;
+}
+
+void Renderer::HandleRenderResets()
+{
+	m_texturesLost = false;
+
+	// The device going takes every texture with it, so chunks are recreated rather than rebaked.
+	if (m_renderDeviceReset.exchange(false))
+	{
+		SL_LOG_FUNC(LogRenderer, Warning, "Render device was reset, recreating tilemap chunks and glyphs.");
+		m_renderTargetsReset = false;
+		m_tilemapRenderer.Release();
+		m_texturesLost = true;
+	}
+	else if (m_renderTargetsReset.exchange(false))
+	{
+		SL_LOG_FUNC(LogRenderer, Display, "Render targets were reset, rebaking tilemap chunks and glyphs.");
+		m_tilemapRenderer.Invalidate();
+		m_texturesLost = true;
+	}
+
+	// Glyphs are packed into pages as they are first used, so they are rasterized again from scratch either way.
+	if (m_texturesLost && m_defaultFont)
+	{
+		m_defaultFont->ReleaseAtlas();
+	}
+}
+
 void Renderer::EndFrame() const
 {
 	if (m_renderer == nullptr)
@@ -118,3 +185,174 @@ void Renderer::DrawRectangle(const SDL_FRect* Rect) const
 {
 	SDL_RenderFillRect(m_renderer, Rect);
 }
+
+void Renderer::DrawWorld(const SWorld& World)
+{
+	if (m_renderer != nullptr)
+	{
+		m_tilemapRenderer.Draw(m_renderer, World, m_camera, m_frameStats);
+	}
+
+	const Uint64 CullStartNS = SDL_GetTicksNS();
+	m_frameStats.SpritesCulled += m_spriteCuller.Cull(World, m_camera, m_visibleSprites);
+	m_frameStats.CullTimeNS += SDL_GetTicksNS() - CullStartNS;
+
+	DrawSprites(m_visibleSprites);
+	DrawParticles(World);
+}
+
+void Renderer::DrawSprites(const std::vector<FRenderSprite>& Sprites)
+{
+	if (m_renderer == nullptr || Sprites.empty())
+	{
+		return;
+	}
+
+	// TextureId is not read: nothing owns textures to resolve it against yet, so every sprite is a quad of its tint.
+	m_spriteVertices.resize(Sprites.size() * 4);
+	m_spriteIndices.resize(Sprites.size() * 6);
+
+	for (size_t SpriteIndex = 0; SpriteIndex < Sprites.size(); ++SpriteIndex)
+	{
+		const FRenderSprite& Sprite = Sprites[SpriteIndex];
+		const SDL_FColor Color = Sprite.Tint.ToFColor();
+
+		SDL_Vertex* Vertices = &m_spriteVertices[SpriteIndex * 4];
+		for (int Corner = 0; Corner < 4; ++Corner)
+		{
+			Vertices[Corner] = {Sprite.Corners[Corner], Color, {0.f, 0.f}};
+		}
+
+		const int FirstVertex = static_cast<int>(SpriteIndex * 4);
+		int* Indices = &m_spriteIndices[SpriteIndex * 6];
+		Indices[0] = FirstVertex;
+		Indices[1] = FirstVertex + 1;
+		Indices[2] = FirstVertex + 2;
+		Indices[3] = FirstVertex;
+		Indices[4] = FirstVertex + 2;
+		Indices[5] = FirstVertex + 3;
+	}
+
+	SDL_RenderGeometry(m_renderer, nullptr, m_spriteVertices.data(), static_cast<int>(m_spriteVertices.size()), m_spriteIndices.data(), static_cast<int>(m_spriteIndices.size()));
+	m_frameStats.SpritesDrawn += static_cast<Uint32>(Sprites.size());
+	++m_frameStats.DrawCalls;
+}
+
+void Renderer::DrawParticles(const SWorld& World)
+{
+	if (m_renderer == nullptr)
+	{
+		return;
+	}
+
+	const FBox2D ViewBounds = m_camera.GetViewBounds();
+	Uint32 ParticleCount = 0;
+	for (const TUniquePtr<FParticleEmitter>& Emitter : World.GetParticleEmitters())
+	{
+		if (Emitter->GetParticleCount() > 0 && Emitter->GetBounds().Intersects(ViewBounds))
+		{
+			ParticleCount += Emitter->GetParticleCount();
+		}
+	}
+
+	if (ParticleCount == 0)
+	{
+		return;
+	}
+
+	m_particleVertices.resize(static_cast<size_t>(ParticleCount) * 4);
+	if (m_particleIndices.size() < static_cast<size_t>(ParticleCount) * 6)
+	{
+		const Uint32 FirstQuad = static_cast<Uint32>(m_particleIndices.size() / 6);
+		m_particleIndices.resize(static_cast<size_t>(ParticleCount) * 6);
+		for (Uint32 Quad = FirstQuad; Quad < ParticleCount; ++Quad)
+		{
+			const int FirstVertex = static_cast<int>(Quad * 4);
+			int* Indices = &m_particleIndices[static_cast<size_t>(Quad) * 6];
+			Indices[0] = FirstVertex;
+			Indices[1] = FirstVertex + 1;
+			Indices[2] = FirstVertex + 2;
+			Indices[3] = FirstVertex;
+			Indices[4] = FirstVertex + 2;
+			Indices[5] = FirstVertex + 3;
+		}
+	}
+
+	// Emitter TextureIds are ignored, as for sprites, and particles draw as untextured quads. That is also what lets all
+	// emitters share one draw call; textured particles will need a draw per texture.
+	const FVector2 ScreenOffset = m_camera.ViewportSize * 0.5f - m_camera.Position * m_camera.Zoom;
+	const float Zoom = m_camera.Zoom;
+	Uint32 FirstParticle = 0;
+	for (const TUniquePtr<FParticleEmitter>& Emitter : World.GetParticleEmitters())
+	{
+		const Uint32 EmitterCount = Emitter->GetParticleCount();
+		if (EmitterCount == 0 || Emitter->GetBounds().Intersects(ViewBounds) == false)
+		{
+			continue;
+		}
+
+		// Quads are built in parallel chunks, each writing only its own range of the vertex buffer.
+		const Uint32 ChunkCount = (EmitterCount + FParticleEmitter::PARALLEL_CHUNK_SIZE - 1) / FParticleEmitter::PARALLEL_CHUNK_SIZE;
+		SDL_Vertex* EmitterVertices = &m_particleVertices[static_cast<size_t>(FirstParticle) * 4];
+		const FParticleEmitter& EmitterRef = *Emitter;
+		FTaskSystem::ParallelFor(ChunkCount, [&EmitterRef, EmitterVertices, EmitterCount, ScreenOffset, Zoom](const Uint32 ChunkIndex)
+		{
+			const float* PositionsX = EmitterRef.GetPositionsX();
+			const float* PositionsY = EmitterRef.GetPositionsY();
+			const float* Ages = EmitterRef.GetAges();
+			const FPackedColor* Colors = EmitterRef.GetColors();
+
+			const Uint32 Begin = ChunkIndex * FParticleEmitter::PARALLEL_CHUNK_SIZE;
+			const Uint32 End = SMath::Min(Begin + FParticleEmitter::PARALLEL_CHUNK_SIZE, EmitterCount);
+			for (Uint32 Index = Begin; Index < End; ++Index)
+			{
+				const float CentreX = PositionsX[Index] * Zoom + ScreenOffset.x;
+				const float CentreY = PositionsY[Index] * Zoom + ScreenOffset.y;
+				const float HalfSize = EmitterRef.GetSize(Ages[Index]) * 0.5f * Zoom;
+				const SDL_FColor Color = Colors[Index].ToFColor();
+
+				SDL_Vertex* Vertices = EmitterVertices + static_cast<size_t>(Index) * 4;
+				Vertices[0] = {{CentreX - HalfSize, CentreY - HalfSize}, Color, {0.f, 0.f}};
+				Vertices[1] = {{CentreX + HalfSize, CentreY - HalfSize}, Color, {0.f, 0.f}};
+				Vertices[2] = {{CentreX + HalfSize, CentreY + HalfSize}, Color, {0.f, 0.f}};
+				Vertices[3] = {{CentreX - HalfSize, CentreY + HalfSize}, Color, {0.f, 0.f}};
+			}
+		});
+
+		FirstParticle += EmitterCount;
+	}
+
+	SDL_RenderGeometry(m_renderer, nullptr, m_particleVertices.data(), static_cast<int>(m_particleVertices.size()), m_particleIndices.data(), static_cast<int>(static_cast<size_t>(ParticleCount) * 6));
+	m_frameStats.ParticlesDrawn += ParticleCount;
+	++m_frameStats.DrawCalls;
+}
+
+void Renderer::DrawLattice(const FLatticeDrawList& DrawList)
+{
+	if (m_renderer == nullptr || DrawList.IsEmpty())
+	{
+		return;
+	}
+
+	const std::vector<SDL_Vertex>& Vertices = DrawList.GetVertices();
+	const std::vector<int>& Indices = DrawList.GetIndices();
+
+	// Only touch the clip rect when it actually changes between commands.
+	const FLatticeDrawCommand* PreviousCommand = nullptr;
+	for (const FLatticeDrawCommand& Command : DrawList.GetCommands())
+	{
+		const bool bClipChanged = PreviousCommand == nullptr
+			|| PreviousCommand->bClipped != Command.bClipped
+			|| (Command.bClipped && SDL_RectsEqual(&PreviousCommand->ClipRect, &Command.ClipRect) == false);
+		if (bClipChanged)
+		{
+			SDL_SetRenderClipRect(m_renderer, Command.bClipped ? &Command.ClipRect : nullptr);
+		}
+
+		SDL_RenderGeometry(m_renderer, Command.Texture, Vertices.data(), static_cast<int>(Vertices.size()), Indices.data() + Command.IndexOffset, static_cast<int>(Command.IndexCount));
+		++m_frameStats.DrawCalls;
+		PreviousCommand = &Command;
+	}
+
+	SDL_SetRenderClipRect(m_renderer, nullptr);
+}
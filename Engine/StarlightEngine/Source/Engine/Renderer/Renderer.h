@@ -2,15 +2,26 @@
 
 #pragma once
 
+// Libraries
+#include <atomic>
+#include <vector>
+
 // SDL
 #include <SDL3/SDL.h>
 
 // Starlight Engine
+#include "Camera2D.h"
+#include "Font.h"
+#include "RenderTypes.h"
+#include "SpriteCuller.h"
+#include "TilemapRenderer.h"
 #include "Pointers.h"
 #include "Framework/Color.h"
 
 // Forward Declarations
 class Engine;
+class SWorld;
+class FLatticeDrawList;
 
 class Renderer
 {
@@ -30,9 +41,25 @@ protected:
 	bool Initialise(SDL_Window* Window);
 	void Shutdown();
 
-	void BeginFrame() const;
+	void BeginFrame();
 	void EndFrame() const;
 
+private:
+	// Event watch that notes render target and device resets, so BeginFrame can restore what they lost. Watches run
+	// on whichever thread pushes the event, which need not be the one rendering.
+	static bool SDLCALL OnRenderEvent(void* UserData, SDL_Event* Event);
+
+	// Rebakes or recreates the textures the last reset lost, if any.
+	void HandleRenderResets();
+
+	// Whether this frame's BeginFrame found textures lost to a reset. Anything outside the renderer that holds on to
+	// them, e.g. a retained UI draw list, must be rebuilt before it is drawn.
+	bool WereTexturesLost() const { return m_texturesLost; }
+
+	std::atomic<bool> m_renderTargetsReset = false;
+	std::atomic<bool> m_renderDeviceReset = false;
+	bool m_texturesLost = false;
+
 	// =============================================
 	// RENDERING
 	// =============================================
@@ -54,9 +81,57 @@ public:
 	void DrawRectangle(float X, float Y, float W, float H) const;
 	void DrawRectangle(const SDL_FRect* Rect) const;
 
+	// Culls the world against the camera and draws its visible tilemaps, then its sprites, then its particles on top.
+	void DrawWorld(const SWorld& World);
+
+	// Draws screen-space sprites in order, batched into a single draw call.
+	void DrawSprites(const std::vector<FRenderSprite>& Sprites);
+
+	// Draws the particles of every emitter in the world whose bounds are on screen, batched into a single draw call.
+	void DrawParticles(const SWorld& World);
+
+	// Draws a Lattice UI draw list in screen space, one draw call per batched command.
+	void DrawLattice(const FLatticeDrawList& DrawList);
+
 protected:
 	FRenderColor m_clearColor = ERenderColors::Black;
 
+	// =============================================
+	// CAMERA & STATISTICS
+	// =============================================
+public:
+	FCamera2D& GetCamera() { return m_camera; }
+	const FCamera2D& GetCamera() const { return m_camera; }
+
+	// Statistics of the frame currently being rendered, or the last one once EndFrame has run.
+	const FRenderStats& GetFrameStats() const { return m_frameStats; }
+
+protected:
+	FCamera2D m_camera;
+	FRenderStats m_frameStats;
+
+	FSpriteCuller m_spriteCuller;
+	FTilemapRenderer m_tilemapRenderer;
+
+	// Per-frame scratch buffers, kept to avoid reallocating every frame.
+	std::vector<FRenderSprite> m_visibleSprites;
+	std::vector<SDL_Vertex> m_spriteVertices;
+	std::vector<int> m_spriteIndices;
+	std::vector<SDL_Vertex> m_particleVertices;
+
+	// The same six indices per quad every frame, so only ever grown.
+	std::vector<int> m_particleIndices;
+
+	// =============================================
+	// TEXT
+	// =============================================
+public:
+	// Built-in font that needs no font file, available once the renderer is initialised.
+	const TSharedPtr<FFont>& GetDefaultFont() const { return m_defaultFont; }
+
+protected:
+	TSharedPtr<FFont> m_defaultFont;
+
 	// =============================================
 	// SDL
 	// =============================================
@@ -0,0 +1,117 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "SpriteCuller.h"
+
+// Libraries
+#include <algorithm>
+
+// Starlight Engine
+#include "Framework/TaskSystem.h"
+#include "Object/World.h"
+#include "Spatial/SpatialIndex.h"
+
+Uint32 FSpriteCuller::Cull(const SWorld& World, const FCamera2D& Camera, std::vector<FRenderSprite>& OutSprites)
+{
+	OutSprites.clear();
+
+	const Uint32 EntityCount = World.GetEntityCount();
+	const FBox2D ViewBounds = Camera.GetViewBounds();
+	if (EntityCount == 0 || ViewBounds.GetSize().x <= 0.f || ViewBounds.GetSize().y <= 0.f)
+	{
+		return EntityCount;
+	}
+
+	const Uint32 StripCount = EntityCount >= PARALLEL_ENTITY_THRESHOLD ? FTaskSystem::GetWorkerCount() + 1 : 1;
+	if (Strips.size() < StripCount)
+	{
+		Strips.resize(StripCount);
+	}
+
+	FTaskSystem::ParallelFor(StripCount, [&](const Uint32 StripIndex)
+	{
+		CullStrip(World, Camera, ViewBounds, StripIndex, StripCount, Strips[StripIndex]);
+	});
+
+	for (Uint32 StripIndex = 0; StripIndex < StripCount; ++StripIndex)
+	{
+		const std::vector<FRenderSprite>& StripSprites = Strips[StripIndex].Sprites;
+		OutSprites.insert(OutSprites.end(), StripSprites.begin(), StripSprites.end());
+	}
+
+	std::stable_sort(OutSprites.begin(), OutSprites.end(), [](const FRenderSprite& A, const FRenderSprite& B)
+	{
+		return A.SortOrder < B.SortOrder;
+	});
+
+	return EntityCount - static_cast<Uint32>(OutSprites.size());
+}
+
+void FSpriteCuller::CullStrip(const SWorld& World, const FCamera2D& Camera, const FBox2D& ViewBounds, const Uint32 StripIndex, const Uint32 StripCount, FStrip& Strip)
+{
+	Strip.Sprites.clear();
+
+	// Strips are padded slightly so nothing on a boundary is lost to rounding. The home strip test below
+	// still reports every entity from exactly one strip.
+	constexpr float STRIP_PADDING = 1.f;
+	const float StripHeight = ViewBounds.GetSize().y / static_cast<float>(StripCount);
+	const float StripMinY = ViewBounds.Min.y + StripHeight * static_cast<float>(StripIndex);
+	const FBox2D StripBounds(
+		FVector2(ViewBounds.Min.x, StripMinY - STRIP_PADDING),
+		FVector2(ViewBounds.Max.x, StripMinY + StripHeight + STRIP_PADDING));
+
+	Strip.Candidates.resize(World.GetEntityCount());
+	const Uint32 CandidateCount = World.QueryBox(StripBounds, Strip.Candidates.data(), static_cast<Uint32>(Strip.Candidates.size()));
+
+	const ISpatialIndex& SpatialIndex = World.GetSpatialIndex();
+	const std::vector<FTransform2D>& Transforms = World.GetTransforms();
+	const std::vector<FSpriteComponent>& Sprites = World.GetSprites();
+
+	for (Uint32 CandidateIndex = 0; CandidateIndex < CandidateCount; ++CandidateIndex)
+	{
+		const FEntityId EntityId = Strip.Candidates[CandidateIndex];
+
+		FBox2D Bounds;
+		if (SpatialIndex.GetBounds(EntityId, Bounds) == false || Bounds.Intersects(ViewBounds) == false)
+		{
+			continue;
+		}
+
+		// An entity belongs to the strip holding the top of its visible part.
+		const float HomeY = SMath::Max(Bounds.Min.y, ViewBounds.Min.y);
+		const Sint32 HomeStrip = static_cast<Sint32>(SMath::Floor((HomeY - ViewBounds.Min.y) / StripHeight));
+		if (SMath::Clamp(HomeStrip, 0, static_cast<Sint32>(StripCount) - 1) != static_cast<Sint32>(StripIndex))
+		{
+			continue;
+		}
+
+		const Uint32 EntityIndex = World.GetEntityIndex(EntityId);
+		const FTransform2D& Transform = Transforms[EntityIndex];
+		const FSpriteComponent& Sprite = Sprites[EntityIndex];
+		if (Sprite.Size.x == 0.f || Sprite.Size.y == 0.f)
+		{
+			continue;
+		}
+
+		const FVector2 ScaledSize(Sprite.Size.x * Transform.Scale.x, Sprite.Size.y * Transform.Scale.y);
+		const float Radians = SMath::DegreesToRadians(Transform.Rotation);
+		const float Sin = SMath::Sin(Radians);
+		const float Cos = SMath::Cos(Radians);
+
+		FRenderSprite& RenderSprite = Strip.Sprites.emplace_back();
+		RenderSprite.Tint = FPackedColor(Sprite.Tint);
+		RenderSprite.TextureId = Sprite.TextureId;
+		RenderSprite.SortOrder = Sprite.SortOrder;
+
+		constexpr float CORNER_X[4] = {0.f, 1.f, 1.f, 0.f};
+		constexpr float CORNER_Y[4] = {0.f, 0.f, 1.f, 1.f};
+		for (Uint32 Corner = 0; Corner < 4; ++Corner)
+		{
+			const float LocalX = (CORNER_X[Corner] - Sprite.Pivot.x) * ScaledSize.x;
+			const float LocalY = (CORNER_Y[Corner] - Sprite.Pivot.y) * ScaledSize.y;
+			const FVector2 WorldCorner = Transform.Position + FVector2(LocalX * Cos - LocalY * Sin, LocalX * Sin + LocalY * Cos);
+			const FVector2 ScreenCorner = Camera.WorldToScreen(WorldCorner);
+			RenderSprite.Corners[Corner] = {ScreenCorner.x, ScreenCorner.y};
+		}
+	}
+}
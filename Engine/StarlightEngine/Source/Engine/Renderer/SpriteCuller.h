@@ -0,0 +1,43 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <vector>
+
+// Starlight Engine
+#include "Camera2D.h"
+#include "RenderTypes.h"
+#include "Object/Entity.h"
+
+// Forward Declarations
+class SWorld;
+
+/**
+ * @brief Finds the sprites inside a camera's view and transforms them to screen space.
+ * The view is split into horizontal strips that query the world's spatial index in parallel, so entities off screen
+ * are never visited. Buffers are kept between frames to avoid per-frame allocations.
+ */
+class FSpriteCuller
+{
+public:
+	// Worlds with fewer entities than this are culled on the calling thread.
+	static constexpr Uint32 PARALLEL_ENTITY_THRESHOLD = 2048;
+
+	/**
+	 * @brief Fills OutSprites with the visible sprites of World, ordered by SortOrder.
+	 * @return The number of entities that were not emitted.
+	 */
+	Uint32 Cull(const SWorld& World, const FCamera2D& Camera, std::vector<FRenderSprite>& OutSprites);
+
+private:
+	struct FStrip
+	{
+		std::vector<FEntityId> Candidates;
+		std::vector<FRenderSprite> Sprites;
+	};
+
+	static void CullStrip(const SWorld& World, const FCamera2D& Camera, const FBox2D& ViewBounds, Uint32 StripIndex, Uint32 StripCount, FStrip& Strip);
+
+	std::vector<FStrip> Strips;
+};
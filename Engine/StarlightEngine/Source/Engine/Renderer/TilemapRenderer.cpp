@@ -0,0 +1,188 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "TilemapRenderer.h"
+
+// Starlight Engine
+#include "Debug/Logging.h"
+#include "Object/Tilemap.h"
+#include "Object/World.h"
+
+FTilemapRenderer::~FTilemapRenderer()
+{
+	Release();
+}
+
+void FTilemapRenderer::BeginFrame()
+{
+	++Frame;
+
+	for (auto It = BakedChunks.begin(); It != BakedChunks.end();)
+	{
+		if (Frame - It->second.LastDrawnFrame > EVICT_AFTER_FRAMES)
+		{
+			SDL_DestroyTexture(It->second.Texture);
+			It = BakedChunks.erase(It);
+		}
+		else
+		{
+			++It;
+		}
+	}
+}
+
+void FTilemapRenderer::Draw(SDL_Renderer* Renderer, const SWorld& World, const FCamera2D& Camera, FRenderStats& Stats)
+{
+	for (const TUniquePtr<FTilemap>& Tilemap : World.GetTilemaps())
+	{
+		DrawTilemap(Renderer, *Tilemap, Camera, Stats);
+	}
+}
+
+void FTilemapRenderer::Release()
+{
+	for (const auto& [Key, Chunk] : BakedChunks)
+	{
+		SDL_DestroyTexture(Chunk.Texture);
+	}
+
+	BakedChunks.clear();
+}
+
+void FTilemapRenderer::Invalidate()
+{
+	// Tilemap revisions start at 1, so 0 never matches and every chunk is rebaked.
+	for (auto& [Key, Chunk] : BakedChunks)
+	{
+		Chunk.Revision = 0;
+	}
+}
+
+void FTilemapRenderer::DrawTilemap(SDL_Renderer* Renderer, const FTilemap& Tilemap, const FCamera2D& Camera, FRenderStats& Stats)
+{
+	// Only the chunks overlapping the view are looked at, however large the map.
+	Uint32 MinChunkX = 0;
+	Uint32 MinChunkY = 0;
+	Uint32 MaxChunkX = 0;
+	Uint32 MaxChunkY = 0;
+	if (Tilemap.GetChunkRange(Camera.GetViewBounds(), MinChunkX, MinChunkY, MaxChunkX, MaxChunkY) == false)
+	{
+		return;
+	}
+
+	for (Uint32 ChunkY = MinChunkY; ChunkY <= MaxChunkY; ++ChunkY)
+	{
+		for (Uint32 ChunkX = MinChunkX; ChunkX <= MaxChunkX; ++ChunkX)
+		{
+			const Uint32 ChunkIndex = Tilemap.GetChunkIndex(ChunkX, ChunkY);
+			if (Tilemap.IsChunkEmpty(ChunkIndex))
+			{
+				continue;
+			}
+
+			FBakedChunk& Chunk = BakedChunks[static_cast<Uint64>(Tilemap.GetId()) << 32 | ChunkIndex];
+			Chunk.LastDrawnFrame = Frame;
+
+			const Uint32 Revision = Tilemap.GetChunkRevision(ChunkIndex);
+			if (Chunk.Revision != Revision)
+			{
+				Chunk.Revision = Revision;
+				if (BakeChunk(Renderer, Tilemap, ChunkX, ChunkY, Chunk))
+				{
+					++Stats.TileChunksBaked;
+					++Stats.DrawCalls;
+				}
+			}
+
+			if (Chunk.Texture == nullptr)
+			{
+				continue;
+			}
+
+			// Rounding both edges to whole pixels makes neighbouring chunks meet exactly, leaving no seams.
+			const FBox2D Bounds = Tilemap.GetChunkBounds(ChunkX, ChunkY);
+			const FVector2 ScreenMin = Camera.WorldToScreen(Bounds.Min);
+			const FVector2 ScreenMax = Camera.WorldToScreen(Bounds.Max);
+			const float Left = SDL_roundf(ScreenMin.x);
+			const float Top = SDL_roundf(ScreenMin.y);
+			const SDL_FRect Destination = {Left, Top, SDL_roundf(ScreenMax.x) - Left, SDL_roundf(ScreenMax.y) - Top};
+
+			SDL_RenderTexture(Renderer, Chunk.Texture, nullptr, &Destination);
+			++Stats.TileChunksDrawn;
+			++Stats.DrawCalls;
+		}
+	}
+}
+
+bool FTilemapRenderer::BakeChunk(SDL_Renderer* Renderer, const FTilemap& Tilemap, const Uint32 ChunkX, const Uint32 ChunkY, FBakedChunk& Chunk)
+{
+	const FTileset& Tileset = Tilemap.GetTileset();
+	const Uint32 ChunkWidth = Tilemap.GetChunkWidth(ChunkX);
+	const Uint32 ChunkHeight = Tilemap.GetChunkHeight(ChunkY);
+	const int TextureWidth = static_cast<int>(ChunkWidth * Tileset.CellSize);
+	const int TextureHeight = static_cast<int>(ChunkHeight * Tileset.CellSize);
+
+	// The texture is reused when the chunk is rebaked, unless the tileset's cell size changed.
+	if (Chunk.Texture != nullptr && (Chunk.Texture->w != TextureWidth || Chunk.Texture->h != TextureHeight))
+	{
+		SDL_DestroyTexture(Chunk.Texture);
+		Chunk.Texture = nullptr;
+	}
+
+	if (Chunk.Texture == nullptr)
+	{
+		Chunk.Texture = SDL_CreateTexture(Renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, TextureWidth, TextureHeight);
+		if (Chunk.Texture == nullptr)
+		{
+			SL_LOG_FUNC(LogRenderer, Error, "Could not create a tilemap chunk texture! SDL_Error: " + SDL_GetErrorFString());
+			return false;
+		}
+
+		SDL_SetTextureBlendMode(Chunk.Texture, SDL_BLENDMODE_BLEND);
+		SDL_SetTextureScaleMode(Chunk.Texture, SDL_SCALEMODE_NEAREST);
+	}
+
+	// Tileset.TextureId is not resolved yet, so every tile bakes as the solid rectangle FTileset documents for 0.
+	Vertices.clear();
+	Indices.clear();
+
+	const FTileId* Tiles = Tilemap.GetChunkTiles(Tilemap.GetChunkIndex(ChunkX, ChunkY));
+	const float CellSize = static_cast<float>(Tileset.CellSize);
+	for (Uint32 TileY = 0; TileY < ChunkHeight; ++TileY)
+	{
+		for (Uint32 TileX = 0; TileX < ChunkWidth; ++TileX)
+		{
+			const FTileId Tile = Tiles[TileY * FTilemap::CHUNK_SIZE + TileX];
+			if (Tile == EMPTY_TILE)
+			{
+				continue;
+			}
+
+			const FRenderColor Tint = Tileset.GetTint(Tile);
+			const SDL_FColor Color = {Tint.R, Tint.G, Tint.B, Tint.A};
+			const float Left = static_cast<float>(TileX) * CellSize;
+			const float Top = static_cast<float>(TileY) * CellSize;
+
+			const int FirstVertex = static_cast<int>(Vertices.size());
+			Vertices.push_back({{Left, Top}, Color, {0.f, 0.f}});
+			Vertices.push_back({{Left + CellSize, Top}, Color, {0.f, 0.f}});
+			Vertices.push_back({{Left + CellSize, Top + CellSize}, Color, {0.f, 0.f}});
+			Vertices.push_back({{Left, Top + CellSize}, Color, {0.f, 0.f}});
+			Indices.insert(Indices.end(), {FirstVertex, FirstVertex + 1, FirstVertex + 2, FirstVertex, FirstVertex + 2, FirstVertex + 3});
+		}
+	}
+
+	SDL_Texture* PreviousTarget = SDL_GetRenderTarget(Renderer);
+	FRenderColor PreviousColor;
+	SDL_GetRenderDrawColorFloat(Renderer, &PreviousColor.R, &PreviousColor.G, &PreviousColor.B, &PreviousColor.A);
+
+	// Render targets start with undefined contents, and a rebaked chunk may have lost tiles.
+	SDL_SetRenderTarget(Renderer, Chunk.Texture);
+	SDL_SetRenderDrawColor(Renderer, 0, 0, 0, SDL_ALPHA_TRANSPARENT);
+	SDL_RenderClear(Renderer);
+	SDL_RenderGeometry(Renderer, nullptr, Vertices.data(), static_cast<int>(Vertices.size()), Indices.data(), static_cast<int>(Indices.size()));
+
+	SDL_SetRenderTarget(Renderer, PreviousTarget);
+	SDL_SetRenderDrawColorFloat(Renderer, PreviousColor.R, PreviousColor.G, PreviousColor.B, PreviousColor.A);
+	return true;
+}
@@ -0,0 +1,77 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <unordered_map>
+#include <vector>
+
+// SDL
+#include <SDL3/SDL_render.h>
+
+// Starlight Engine
+#include "Camera2D.h"
+#include "RenderTypes.h"
+
+// Forward Declarations
+class FTilemap;
+class SWorld;
+
+/**
+ * @brief Draws tilemaps one chunk at a time from textures baked once per chunk.
+ * A chunk's tiles are rendered into a texture of its own the first time it comes on screen, and again only when its
+ * revision changes, so a screen full of tiles costs one draw call per visible chunk instead of a quad per tile.
+ * Textures rather than cached vertices are kept because SDL geometry is submitted in screen space, which would need
+ * rewriting every time the camera moved. Chunks that stay off screen for a while are released.
+ * The textures are render targets, so the renderer must call Invalidate when SDL resets its render targets and Release
+ * when it resets the device.
+ */
+class FTilemapRenderer
+{
+public:
+	// Frames a baked chunk may go undrawn before its texture is released.
+	static constexpr Uint64 EVICT_AFTER_FRAMES = 300;
+
+	FTilemapRenderer() = default;
+	~FTilemapRenderer();
+
+	FTilemapRenderer(const FTilemapRenderer&) = delete;
+	FTilemapRenderer& operator=(const FTilemapRenderer&) = delete;
+
+	// Starts a new frame, releasing chunks that have not been drawn for EVICT_AFTER_FRAMES.
+	void BeginFrame();
+
+	// Draws the visible chunks of every tilemap in World, in the order the tilemaps were added.
+	void Draw(SDL_Renderer* Renderer, const SWorld& World, const FCamera2D& Camera, FRenderStats& Stats);
+
+	// Releases every baked chunk. Must be called before the SDL renderer that owns them is destroyed.
+	void Release();
+
+	// Rebakes every chunk into its existing texture the next time it is drawn, for when SDL has lost the contents of
+	// its render targets.
+	void Invalidate();
+
+	Uint32 GetBakedChunkCount() const { return static_cast<Uint32>(BakedChunks.size()); }
+
+private:
+	struct FBakedChunk
+	{
+		// Null if baking failed, in which case the chunk is skipped until its revision changes.
+		SDL_Texture* Texture = nullptr;
+		Uint32 Revision = 0;
+		Uint64 LastDrawnFrame = 0;
+	};
+
+	void DrawTilemap(SDL_Renderer* Renderer, const FTilemap& Tilemap, const FCamera2D& Camera, FRenderStats& Stats);
+
+	/// @returns whether the chunk was baked into Chunk.Texture.
+	bool BakeChunk(SDL_Renderer* Renderer, const FTilemap& Tilemap, Uint32 ChunkX, Uint32 ChunkY, FBakedChunk& Chunk);
+
+	// Keyed by tilemap ID in the high bits and chunk index in the low bits.
+	std::unordered_map<Uint64, FBakedChunk> BakedChunks;
+	Uint64 Frame = 0;
+
+	// Scratch buffers for baking, kept to avoid reallocating.
+	std::vector<SDL_Vertex> Vertices;
+	std::vector<int> Indices;
+};
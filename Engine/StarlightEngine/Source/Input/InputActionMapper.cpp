@@ -0,0 +1,274 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "InputActionMapper.h"
+
+// Starlight Engine
+#include "Debug/Logging.h"
+
+Uint32 InputActionMapper::AddAction(const FString& ActionName)
+{
+	const Uint32 ExistingAction = FindAction(ActionName);
+	if (ExistingAction != INVALID_INPUT_ACTION)
+	{
+		return ExistingAction;
+	}
+
+	Actions.emplace_back().Name = ActionName;
+	return static_cast<Uint32>(Actions.size() - 1);
+}
+
+Uint32 InputActionMapper::FindAction(const FString& ActionName) const
+{
+	for (size_t Index = 0; Index < Actions.size(); ++Index)
+	{
+		if (Actions[Index].Name == ActionName)
+		{
+			return static_cast<Uint32>(Index);
+		}
+	}
+
+	return INVALID_INPUT_ACTION;
+}
+
+bool InputActionMapper::BindKey(const Uint32 Action, const FInputKey& Key, const float Scale)
+{
+	const Uint32 Slot = Key.Index;
+	if (Action >= Actions.size() || Slot >= FInputKey::INDEX_COUNT)
+	{
+		SL_LOG_FUNC(LogInputManager, Warning, "Cannot bind " + Key.ToString() + " to action " + FString(static_cast<int>(Action)) + ".");
+		return false;
+	}
+
+	// Binding the same key again only changes its scale.
+	UnbindKey(Action, Key);
+
+	Bindings.push_back({Action, Key, Scale});
+	AddSlotEntry(Slot, Action, Scale);
+	return true;
+}
+
+bool InputActionMapper::UnbindKey(const Uint32 Action, const FInputKey& Key)
+{
+	for (size_t Index = 0; Index < Bindings.size(); ++Index)
+	{
+		if (Bindings[Index].Action == Action && Bindings[Index].Key == Key)
+		{
+			Bindings.erase(Bindings.begin() + static_cast<std::ptrdiff_t>(Index));
+			RemoveSlotEntry(Key.Index, Action);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool InputActionMapper::RebindKey(const Uint32 Action, const FInputKey& OldKey, const FInputKey& NewKey)
+{
+	for (const FInputActionBinding& Binding : Bindings)
+	{
+		if (Binding.Action == Action && Binding.Key == OldKey)
+		{
+			const float Scale = Binding.Scale;
+			return UnbindKey(Action, OldKey) && BindKey(Action, NewKey, Scale);
+		}
+	}
+
+	return false;
+}
+
+void InputActionMapper::SetBindings(const std::vector<FInputActionBinding>& NewBindings)
+{
+	Bindings.clear();
+	Bindings.reserve(NewBindings.size());
+	for (const FInputActionBinding& Binding : NewBindings)
+	{
+		if (Binding.Action < Actions.size() && Binding.Key.Index < FInputKey::INDEX_COUNT)
+		{
+			Bindings.push_back(Binding);
+		}
+		else
+		{
+			SL_LOG_FUNC(LogInputManager, Warning, "Skipping binding of " + Binding.Key.ToString() + ".");
+		}
+	}
+
+	CompileBindings();
+}
+
+bool InputActionMapper::IsActionDown(const Uint32 Action) const
+{
+	return Action < Actions.size() && Actions[Action].bDown;
+}
+
+bool InputActionMapper::WasActionPressed(const Uint32 Action) const
+{
+	return Action < Actions.size() && Actions[Action].bPressed;
+}
+
+bool InputActionMapper::WasActionReleased(const Uint32 Action) const
+{
+	return Action < Actions.size() && Actions[Action].bReleased;
+}
+
+float InputActionMapper::GetActionValue(const Uint32 Action) const
+{
+	return Action < Actions.size() ? Actions[Action].Value : 0.f;
+}
+
+void InputActionMapper::HandleFrameStart()
+{
+	for (const Uint32 Action : EdgeActions)
+	{
+		Actions[Action].bPressed = false;
+		Actions[Action].bReleased = false;
+	}
+	EdgeActions.clear();
+
+	// Mouse movement only counts for the frame it happened in.
+	SetKeyValue(FInputKey::MOUSE_AXIS_INDEX, 0.f);
+	SetKeyValue(FInputKey::MOUSE_AXIS_INDEX + 1, 0.f);
+}
+
+void InputActionMapper::HandleKeyDown(const FInputKey& InputKey)
+{
+	const Uint32 Slot = InputKey.Index;
+	if (Slot < FInputKey::INDEX_COUNT)
+	{
+		SetKeyValue(Slot, 1.f);
+	}
+}
+
+void InputActionMapper::HandleKeyUp(const FInputKey& InputKey)
+{
+	const Uint32 Slot = InputKey.Index;
+	if (Slot < FInputKey::INDEX_COUNT)
+	{
+		SetKeyValue(Slot, 0.f);
+	}
+}
+
+void InputActionMapper::HandleAxis(const FInputKey& InputKey, const float Value)
+{
+	const Uint32 Slot = InputKey.Index;
+	if (Slot >= FInputKey::INDEX_COUNT || SlotRanges[Slot].Count == 0)
+	{
+		return;
+	}
+
+	// Mouse events carry relative movement, which adds up over the frame.
+	const bool bRelative = Slot == FInputKey::MOUSE_AXIS_INDEX || Slot == FInputKey::MOUSE_AXIS_INDEX + 1;
+	SetKeyValue(Slot, bRelative ? SlotEntries[SlotRanges[Slot].First].KeyValue + Value : Value);
+}
+
+void InputActionMapper::HandleFocusLost()
+{
+	for (Uint32 Slot = 0; Slot < FInputKey::INDEX_COUNT; ++Slot)
+	{
+		SetKeyValue(Slot, 0.f);
+	}
+}
+
+void InputActionMapper::CompileBindings()
+{
+	for (FActionState& ActionState : Actions)
+	{
+		ActionState.Value = 0.f;
+		ActionState.bDown = false;
+		ActionState.bPressed = false;
+		ActionState.bReleased = false;
+	}
+	EdgeActions.clear();
+
+	for (FSlotRange& Range : SlotRanges)
+	{
+		Range = FSlotRange();
+	}
+
+	for (const FInputActionBinding& Binding : Bindings)
+	{
+		++SlotRanges[Binding.Key.Index].Capacity;
+	}
+
+	Uint32 NextFirst = 0;
+	for (FSlotRange& Range : SlotRanges)
+	{
+		Range.First = NextFirst;
+		NextFirst += Range.Capacity;
+	}
+
+	SlotEntries.resize(NextFirst);
+	for (const FInputActionBinding& Binding : Bindings)
+	{
+		FSlotRange& Range = SlotRanges[Binding.Key.Index];
+		SlotEntries[Range.First + Range.Count++] = {Binding.Action, Binding.Scale, 0.f};
+	}
+}
+
+void InputActionMapper::AddSlotEntry(const Uint32 Slot, const Uint32 Action, const float Scale)
+{
+	FSlotRange& Range = SlotRanges[Slot];
+	if (Range.Count == Range.Capacity)
+	{
+		// Move the slot to the end of the table with room to grow. The old window stays unused until the next compile.
+		const Uint32 NewFirst = static_cast<Uint32>(SlotEntries.size());
+		const Uint32 NewCapacity = SDL_max(Range.Capacity * 2, 2u);
+		SlotEntries.resize(SlotEntries.size() + NewCapacity);
+		for (Uint32 Index = 0; Index < Range.Count; ++Index)
+		{
+			SlotEntries[NewFirst + Index] = SlotEntries[Range.First + Index];
+		}
+		Range.First = NewFirst;
+		Range.Capacity = NewCapacity;
+	}
+
+	// A key that is already held starts contributing straight away.
+	const float KeyValue = Range.Count > 0 ? SlotEntries[Range.First].KeyValue : 0.f;
+	SlotEntries[Range.First + Range.Count++] = {Action, Scale, KeyValue};
+	ApplyActionDelta(Action, KeyValue * Scale);
+}
+
+void InputActionMapper::RemoveSlotEntry(const Uint32 Slot, const Uint32 Action)
+{
+	FSlotRange& Range = SlotRanges[Slot];
+	for (Uint32 Index = Range.First; Index < Range.First + Range.Count; ++Index)
+	{
+		if (SlotEntries[Index].Action == Action)
+		{
+			ApplyActionDelta(Action, -SlotEntries[Index].KeyValue * SlotEntries[Index].Scale);
+			SlotEntries[Index] = SlotEntries[Range.First + Range.Count - 1];
+			--Range.Count;
+			return;
+		}
+	}
+}
+
+void InputActionMapper::SetKeyValue(const Uint32 Slot, const float KeyValue)
+{
+	const FSlotRange& Range = SlotRanges[Slot];
+	for (Uint32 Index = Range.First; Index < Range.First + Range.Count; ++Index)
+	{
+		FSlotEntry& Entry = SlotEntries[Index];
+		if (Entry.KeyValue != KeyValue)
+		{
+			ApplyActionDelta(Entry.Action, (KeyValue - Entry.KeyValue) * Entry.Scale);
+			Entry.KeyValue = KeyValue;
+		}
+	}
+}
+
+void InputActionMapper::ApplyActionDelta(const Uint32 Action, const float Delta)
+{
+	FActionState& ActionState = Actions[Action];
+	ActionState.Value += Delta;
+
+	const bool bDown = SMath::Abs(ActionState.Value) >= ACTUATION_THRESHOLD;
+	if (bDown == ActionState.bDown)
+	{
+		return;
+	}
+
+	ActionState.bDown = bDown;
+	(bDown ? ActionState.bPressed : ActionState.bReleased) = true;
+	EdgeActions.push_back(Action);
+}
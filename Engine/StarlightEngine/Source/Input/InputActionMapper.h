@@ -0,0 +1,122 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <vector>
+
+// Starlight Engine
+#include "InputProcessor.h"
+#include "InputState.h"
+
+constexpr Uint32 INVALID_INPUT_ACTION = 0xFFFFFFFFu;
+
+// A key contributing to an action. The action's value is the sum of Scale * key value over its bound keys,
+// so W and S can drive the same "MoveY" action with scales of 1 and -1.
+struct FInputActionBinding
+{
+	Uint32 Action = INVALID_INPUT_ACTION;
+	FInputKey Key;
+	float Scale = 1.f;
+};
+
+/**
+ * @brief Maps keys, buttons and axes to named gameplay actions.
+ * Bindings are compiled into a table indexed by FInputKey::Index, so dispatching an event is one lookup followed by
+ * the handful of actions bound to that key. Binding or unbinding at runtime only touches the slot of the key involved.
+ * Only 1D keys can be bound; bind the two halves of a 2D stick separately.
+ */
+class InputActionMapper : public InputProcessor
+{
+public:
+	// An action is down while the absolute value of its summed bindings reaches this.
+	static constexpr float ACTUATION_THRESHOLD = 0.5f;
+
+	// =============================================
+	// ACTIONS & BINDINGS
+	// =============================================
+
+	// Returns the existing action if one with this name was already added.
+	Uint32 AddAction(const FString& ActionName);
+
+	// Returns INVALID_INPUT_ACTION if no action has this name.
+	Uint32 FindAction(const FString& ActionName) const;
+
+	/// @returns false if the action does not exist or the key cannot be bound.
+	bool BindKey(Uint32 Action, const FInputKey& Key, float Scale = 1.f);
+
+	/// @returns whether the binding existed.
+	bool UnbindKey(Uint32 Action, const FInputKey& Key);
+
+	// Moves an existing binding to a different key, keeping its scale.
+	bool RebindKey(Uint32 Action, const FInputKey& OldKey, const FInputKey& NewKey);
+
+	const std::vector<FInputActionBinding>& GetBindings() const { return Bindings; }
+
+	// Replaces every binding and rebuilds the lookup table in one pass. Use this when loading a key map.
+	void SetBindings(const std::vector<FInputActionBinding>& NewBindings);
+
+	// =============================================
+	// QUERIES
+	// =============================================
+
+	bool IsActionDown(Uint32 Action) const;
+	bool WasActionPressed(Uint32 Action) const;
+	bool WasActionReleased(Uint32 Action) const;
+	float GetActionValue(Uint32 Action) const;
+
+	// =============================================
+	// INPUT PROCESSOR
+	// =============================================
+
+	void HandleFrameStart() override;
+	void HandleKeyDown(const FInputKey& InputKey) override;
+	void HandleKeyUp(const FInputKey& InputKey) override;
+	void HandleAxis(const FInputKey& InputKey, float Value) override;
+	void HandleFocusLost() override;
+
+private:
+	struct FActionState
+	{
+		FString Name;
+		float Value = 0.f;
+		bool bDown = false;
+		bool bPressed = false;
+		bool bReleased = false;
+	};
+
+	// A compiled binding, with the value its key currently contributes.
+	struct FSlotEntry
+	{
+		Uint32 Action;
+		float Scale;
+		float KeyValue;
+	};
+
+	// Entries of one key index, a window into SlotEntries with room to grow.
+	struct FSlotRange
+	{
+		Uint32 First = 0;
+		Uint32 Count = 0;
+		Uint32 Capacity = 0;
+	};
+
+	// Rebuilds the whole table from Bindings, packing every slot tightly.
+	void CompileBindings();
+
+	void AddSlotEntry(Uint32 Slot, Uint32 Action, float Scale);
+	void RemoveSlotEntry(Uint32 Slot, Uint32 Action);
+
+	// Sets the value a slot's key contributes to each of its actions.
+	void SetKeyValue(Uint32 Slot, float KeyValue);
+	void ApplyActionDelta(Uint32 Action, float Delta);
+
+	std::vector<FActionState> Actions;
+	std::vector<FInputActionBinding> Bindings;
+
+	std::vector<FSlotRange> SlotRanges = std::vector<FSlotRange>(FInputKey::INDEX_COUNT);
+	std::vector<FSlotEntry> SlotEntries;
+
+	// Actions with an edge this frame, so clearing edges does not scan every action.
+	std::vector<Uint32> EdgeActions;
+};
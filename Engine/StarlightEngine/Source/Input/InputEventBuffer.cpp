@@ -0,0 +1,90 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "InputEventBuffer.h"
+
+// Starlight Engine
+#include "InputState.h"
+
+bool FInputEventBuffer::TranslateEvent(const SDL_Event& Event, FInputEvent& OutInputEvent)
+{
+	OutInputEvent.TimestampNS = Event.common.timestamp;
+
+	switch (Event.type)
+	{
+	case SDL_EVENT_KEY_DOWN:
+	case SDL_EVENT_KEY_UP:
+		if (Event.key.repeat)
+		{
+			return false;
+		}
+
+		OutInputEvent.Key = FInputKey(Event.key.key);
+		OutInputEvent.Type = Event.key.down ? EInputEventType::Pressed : EInputEventType::Released;
+		OutInputEvent.Value = FVector2(Event.key.down ? 1.f : 0.f, 0.f);
+		return true;
+
+	case SDL_EVENT_MOUSE_BUTTON_DOWN:
+	case SDL_EVENT_MOUSE_BUTTON_UP:
+		OutInputEvent.Key = FInputKey(Event.button.button, EInputKeyType::MouseButton);
+		OutInputEvent.Type = Event.button.down ? EInputEventType::Pressed : EInputEventType::Released;
+		OutInputEvent.Value = FVector2(Event.button.down ? 1.f : 0.f, 0.f);
+		return true;
+
+	case SDL_EVENT_MOUSE_MOTION:
+		OutInputEvent.Key = EInputKeys::MouseXY;
+		OutInputEvent.Type = EInputEventType::Axis;
+		OutInputEvent.Value = FVector2(Event.motion.xrel, Event.motion.yrel);
+		return true;
+
+	case SDL_EVENT_MOUSE_WHEEL:
+		{
+			const float Direction = Event.wheel.direction == SDL_MOUSEWHEEL_FLIPPED ? -1.f : 1.f;
+			OutInputEvent.Key = FInputKey();
+			OutInputEvent.Type = EInputEventType::Wheel;
+			OutInputEvent.Value = FVector2(Event.wheel.x, Event.wheel.y) * Direction;
+			return true;
+		}
+
+	case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+	case SDL_EVENT_GAMEPAD_BUTTON_UP:
+		OutInputEvent.Key = FInputKey(static_cast<SDL_GamepadButton>(Event.gbutton.button));
+		OutInputEvent.Type = Event.gbutton.down ? EInputEventType::Pressed : EInputEventType::Released;
+		OutInputEvent.Value = FVector2(Event.gbutton.down ? 1.f : 0.f, 0.f);
+		return true;
+
+	case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+		{
+			const SDL_GamepadAxis Axis = static_cast<SDL_GamepadAxis>(Event.gaxis.axis);
+			const bool bTrigger = Axis == SDL_GAMEPAD_AXIS_LEFT_TRIGGER || Axis == SDL_GAMEPAD_AXIS_RIGHT_TRIGGER;
+			OutInputEvent.Key = FInputKey(Axis, bTrigger ? EInputKeyType::GamepadTriggerAxis : EInputKeyType::GamepadJoystickAxis1D);
+			OutInputEvent.Type = EInputEventType::Axis;
+			OutInputEvent.Value = FVector2(FInputState::NormaliseGamepadAxis(Event.gaxis.value), 0.f);
+			return true;
+		}
+
+	default:
+		return false;
+	}
+}
+
+Uint64 FInputEventBuffer::LowerBound(const Uint64 TimestampNS) const
+{
+	Uint64 First = Events.GetFirstSequence();
+	Uint64 Count = Events.GetEndSequence() - First;
+	while (Count > 0)
+	{
+		const Uint64 Step = Count / 2;
+		if (Events.At(First + Step).TimestampNS < TimestampNS)
+		{
+			First += Step + 1;
+			Count -= Step + 1;
+		}
+		else
+		{
+			Count = Step;
+		}
+	}
+
+	return First;
+}
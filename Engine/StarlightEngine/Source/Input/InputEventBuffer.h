@@ -0,0 +1,103 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// SDL
+#include <SDL3/SDL_events.h>
+
+// Starlight Engine
+#include "InputKeys.h"
+#include "Framework/RingBuffer.h"
+#include "Math/Vector2.h"
+
+enum class EInputEventType : Uint8
+{
+	Pressed,
+	Released,
+
+	// A 1D axis moved to Value.x, or the mouse moved by Value (Key is EInputKeys::MouseXY).
+	Axis,
+
+	// The mouse wheel scrolled by Value. Key is unused.
+	Wheel,
+};
+
+struct FInputEvent
+{
+	// When SDL received the event, on the SDL_GetTicksNS clock.
+	Uint64 TimestampNS = 0;
+
+	FInputKey Key;
+	FVector2 Value;
+	EInputEventType Type = EInputEventType::Pressed;
+};
+
+/**
+ * @brief The input events of the last few frames, in arrival order, with their timestamps.
+ * Lets fixed-step simulation consume exactly the input that arrived during each step, including taps that were pressed
+ * and released within a single frame.
+ */
+class FInputEventBuffer
+{
+public:
+	// At 8000 Hz polling this still holds more than 100 ms of events.
+	static constexpr Uint32 CAPACITY = 1024;
+
+	// Converts an SDL event into an input event.
+	/// @returns false if the event is not input, or is a key repeat.
+	static bool TranslateEvent(const SDL_Event& Event, FInputEvent& OutInputEvent);
+
+	void Push(const FInputEvent& InputEvent) { Events.Push(InputEvent); }
+	void Clear() { Events.Clear(); }
+
+	const TRingBuffer<FInputEvent, CAPACITY>& GetEvents() const { return Events; }
+
+	/**
+	 * @brief Calls Visitor(const FInputEvent&) for each held event with StartNS <= TimestampNS < EndNS, oldest first.
+	 * Consecutive windows therefore see every event exactly once.
+	 */
+	template <typename TVisitor>
+	void ForEachEventInWindow(Uint64 StartNS, Uint64 EndNS, TVisitor&& Visitor) const;
+
+	// Calls Visitor for every event pushed since Cursor and advances Cursor past them. Start with a cursor of 0.
+	/// @returns how many events were lost to overwriting or clearing before they could be read.
+	template <typename TVisitor>
+	Uint64 ReadSince(Uint64& Cursor, TVisitor&& Visitor) const;
+
+private:
+	// First sequence whose event is at or after TimestampNS. Events arrive in time order, so this is a binary search.
+	Uint64 LowerBound(Uint64 TimestampNS) const;
+
+	TRingBuffer<FInputEvent, CAPACITY> Events;
+};
+
+template <typename TVisitor>
+void FInputEventBuffer::ForEachEventInWindow(const Uint64 StartNS, const Uint64 EndNS, TVisitor&& Visitor) const
+{
+	const Uint64 EndSequence = Events.GetEndSequence();
+	for (Uint64 Sequence = LowerBound(StartNS); Sequence < EndSequence; ++Sequence)
+	{
+		const FInputEvent& InputEvent = Events.At(Sequence);
+		if (InputEvent.TimestampNS >= EndNS)
+		{
+			break;
+		}
+
+		Visitor(InputEvent);
+	}
+}
+
+template <typename TVisitor>
+Uint64 FInputEventBuffer::ReadSince(Uint64& Cursor, TVisitor&& Visitor) const
+{
+	const Uint64 OverwrittenCount = Events.GetOverwrittenCount(Cursor);
+	Cursor = SDL_max(Cursor, Events.GetFirstSequence());
+
+	const Uint64 EndSequence = Events.GetEndSequence();
+	for (; Cursor < EndSequence; ++Cursor)
+	{
+		Visitor(Events.At(Cursor));
+	}
+
+	return OverwrittenCount;
+}
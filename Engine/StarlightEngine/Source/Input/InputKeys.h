@@ -9,6 +9,7 @@
 #include <SDL3/SDL_mouse.h>
 
 #include "Hash.h"
+#include "Framework/String.h"
 
 enum class EInputKeyType : Uint8
 {
@@ -50,6 +51,51 @@ struct FInputGamepadAxisPair
 
 struct FInputKey
 {
+	// =============================================
+	// DENSE INDEX LAYOUT
+	// =============================================
+
+	// Keyboard slots: [0, 256) plain keycodes, [256, 768) scancode keycodes, [768, 800) extended keycodes.
+	static constexpr Uint32 KEYBOARD_KEY_COUNT = 800;
+	static constexpr Uint32 MOUSE_BUTTON_COUNT = 32;
+	static constexpr Uint32 GAMEPAD_BUTTON_COUNT = SDL_GAMEPAD_BUTTON_COUNT;
+	static constexpr Uint32 GAMEPAD_AXIS_COUNT = SDL_GAMEPAD_AXIS_COUNT;
+
+	// Every button comes first, so one bitset of BUTTON_INDEX_COUNT covers all of them.
+	static constexpr Uint32 MOUSE_BUTTON_INDEX = KEYBOARD_KEY_COUNT;
+	static constexpr Uint32 GAMEPAD_BUTTON_INDEX = MOUSE_BUTTON_INDEX + MOUSE_BUTTON_COUNT;
+	static constexpr Uint32 BUTTON_INDEX_COUNT = GAMEPAD_BUTTON_INDEX + GAMEPAD_BUTTON_COUNT;
+
+	// Then the 1D axes: mouse X and Y, then every gamepad axis.
+	static constexpr Uint32 MOUSE_AXIS_INDEX = BUTTON_INDEX_COUNT;
+	static constexpr Uint32 GAMEPAD_AXIS_INDEX = MOUSE_AXIS_INDEX + 2;
+	static constexpr Uint32 INDEX_COUNT = GAMEPAD_AXIS_INDEX + GAMEPAD_AXIS_COUNT;
+
+	// For 2D axes, and for keys outside the tables (e.g. non-Latin keycodes).
+	static constexpr Uint16 INVALID_INDEX = 0xFFFF;
+
+	// Maps a keycode to its keyboard slot, or INVALID_INDEX.
+	static constexpr Uint16 GetKeyboardIndex(const SDL_Keycode Keycode)
+	{
+		if (Keycode & SDLK_EXTENDED_MASK)
+		{
+			const Uint32 ExtendedIndex = Keycode & ~SDLK_EXTENDED_MASK;
+			return ExtendedIndex < 32 ? static_cast<Uint16>(768 + ExtendedIndex) : INVALID_INDEX;
+		}
+
+		if (Keycode & SDLK_SCANCODE_MASK)
+		{
+			const Uint32 Scancode = Keycode & ~SDLK_SCANCODE_MASK;
+			return Scancode < SDL_SCANCODE_COUNT ? static_cast<Uint16>(256 + Scancode) : INVALID_INDEX;
+		}
+
+		return Keycode < 256 ? static_cast<Uint16>(Keycode) : INVALID_INDEX;
+	}
+
+	// =============================================
+	// KEY
+	// =============================================
+
 	EInputKeyType Type;
 
 	// Identifier from type
@@ -63,62 +109,77 @@ struct FInputKey
 		int RawValue;
 	};
 
+	// Canonical packed identifier, the type in the top 4 bits and its code below. Equal keys have equal ids.
+	Uint32 Id;
+
+	// Slot in tables of INDEX_COUNT entries, or INVALID_INDEX. Lets state and binding lookups index directly.
+	Uint16 Index;
+
 	// Default Constructor
-	FInputKey() : Type(EInputKeyType::Unknown), RawValue(0) {}
+	FInputKey() : Type(EInputKeyType::Unknown), RawValue(0), Id(MakeId(Type, 0)), Index(INVALID_INDEX) {}
 
 	// General
-	explicit FInputKey(const EInputKeyType Type) : Type(Type), RawValue(0) {}
+	explicit FInputKey(const EInputKeyType Type) : Type(Type), RawValue(0), Id(MakeId(Type, 0)), Index(INVALID_INDEX) {}
 
 	// Keyboard / Mouse Button
-	explicit FInputKey(const Uint32 ButtonCode, const EInputKeyType Type = EInputKeyType::KeyboardButton) : Type(Type), ButtonCode(ButtonCode) {}
-	explicit FInputKey(const EInputAxisOrientation AxisOrientation) : Type(EInputKeyType::MouseAxis1D), AxisOrientation(AxisOrientation) {}
+	explicit FInputKey(const Uint32 ButtonCode, const EInputKeyType Type = EInputKeyType::KeyboardButton)
+		: Type(Type), ButtonCode(ButtonCode), Id(MakeId(Type, ButtonCode)), Index(MakeIndex(Type, ButtonCode)) {}
+	explicit FInputKey(const EInputAxisOrientation AxisOrientation)
+		: Type(EInputKeyType::MouseAxis1D), AxisOrientation(AxisOrientation), Id(MakeId(Type, static_cast<Uint32>(AxisOrientation))), Index(MakeIndex(Type, static_cast<Uint32>(AxisOrientation))) {}
 
 	// Gamepad Button
-	explicit FInputKey(const SDL_GamepadButton GamepadButton) : Type(EInputKeyType::GamepadButton), GamepadButton(GamepadButton) {}
+	explicit FInputKey(const SDL_GamepadButton GamepadButton)
+		: Type(EInputKeyType::GamepadButton), GamepadButton(GamepadButton), Id(MakeId(Type, static_cast<Uint32>(GamepadButton))), Index(MakeIndex(Type, static_cast<Uint32>(GamepadButton))) {}
 
 	// Gamepad Axis
-	explicit FInputKey(const SDL_GamepadAxis GamepadAxis, const EInputKeyType Type) : Type(Type), GamepadAxis(GamepadAxis) {}
-	explicit FInputKey(const FInputGamepadAxisPair GamepadAxisPair, const EInputKeyType Type) : Type(Type), GamepadAxisPair(GamepadAxisPair) {}
+	explicit FInputKey(const SDL_GamepadAxis GamepadAxis, const EInputKeyType Type)
+		: Type(Type), GamepadAxis(GamepadAxis), Id(MakeId(Type, static_cast<Uint32>(GamepadAxis))), Index(MakeIndex(Type, static_cast<Uint32>(GamepadAxis))) {}
+	explicit FInputKey(const FInputGamepadAxisPair GamepadAxisPair, const EInputKeyType Type)
+		: Type(Type), GamepadAxisPair(GamepadAxisPair), Id(MakeId(Type, (GamepadAxisPair.Horizontal & 0xFF) | ((GamepadAxisPair.Vertical & 0xFF) << 8))), Index(INVALID_INDEX) {}
 
-	bool IsValid() const { return Type == EInputKeyType::Unknown; }
-
-	bool operator==(const FInputKey& Other) const
+	// Rebuilds a key from its Id, e.g. when reading it back from a file.
+	static FInputKey FromId(const Uint32 Id)
 	{
-		if (Type != Other.Type)
-		{
-			return false;
-		}
-
+		const EInputKeyType Type = static_cast<EInputKeyType>(Id >> ID_TYPE_SHIFT);
+		const Uint32 Code = Id & ID_CODE_MASK;
 		switch (Type)
 		{
 		case EInputKeyType::KeyboardButton:
+			{
+				SDL_Keycode Keycode = Code & ~(ID_SCANCODE_BIT | ID_EXTENDED_BIT);
+				Keycode |= Code & ID_SCANCODE_BIT ? SDLK_SCANCODE_MASK : 0;
+				Keycode |= Code & ID_EXTENDED_BIT ? SDLK_EXTENDED_MASK : 0;
+				return FInputKey(Keycode);
+			}
+
 		case EInputKeyType::MouseButton:
-			return ButtonCode == Other.ButtonCode;
+			return FInputKey(Code, Type);
 
 		case EInputKeyType::MouseAxis1D:
-			return AxisOrientation == Other.AxisOrientation;
-
-		case EInputKeyType::MouseAxis2D:
-			return true;
+			return FInputKey(static_cast<EInputAxisOrientation>(Code));
 
 		case EInputKeyType::GamepadButton:
-			return GamepadButton == Other.GamepadButton;
+			return FInputKey(static_cast<SDL_GamepadButton>(Code));
 
 		case EInputKeyType::GamepadTriggerAxis:
 		case EInputKeyType::GamepadJoystickAxis1D:
-			return GamepadAxis == Other.GamepadAxis;
+			return FInputKey(static_cast<SDL_GamepadAxis>(Code), Type);
 
 		case EInputKeyType::GamepadJoystickAxis2D:
-			return GamepadAxisPair == Other.GamepadAxisPair;
-
-		case EInputKeyType::Unknown:
-			return true;
+			return FInputKey(FInputGamepadAxisPair(static_cast<SDL_GamepadAxis>(Code & 0xFF), static_cast<SDL_GamepadAxis>((Code >> 8) & 0xFF)), Type);
 
 		default:
-			return false;
+			return FInputKey(Type);
 		}
 	}
 
+	bool IsValid() const { return Type == EInputKeyType::Unknown; }
+
+	bool operator==(const FInputKey& Other) const
+	{
+		return Id == Other.Id;
+	}
+
 	bool operator!=(const FInputKey& Other) const
 	{
 		return !(*this == Other);
@@ -191,6 +252,51 @@ struct FInputKey
 			return "Unknown";
 		}
 	}
+
+private:
+	static constexpr Uint32 ID_TYPE_SHIFT = 28;
+	static constexpr Uint32 ID_CODE_MASK = (1u << ID_TYPE_SHIFT) - 1;
+
+	// Keycodes are Unicode values below 0x110000, or carry one of these flags, so they fit in the code bits.
+	static constexpr Uint32 ID_SCANCODE_BIT = 1u << 27;
+	static constexpr Uint32 ID_EXTENDED_BIT = 1u << 26;
+
+	static constexpr Uint32 MakeId(const EInputKeyType Type, Uint32 Code)
+	{
+		if (Type == EInputKeyType::KeyboardButton)
+		{
+			const Uint32 Flags = (Code & SDLK_SCANCODE_MASK ? ID_SCANCODE_BIT : 0) | (Code & SDLK_EXTENDED_MASK ? ID_EXTENDED_BIT : 0);
+			Code = (Code & ~(SDLK_SCANCODE_MASK | SDLK_EXTENDED_MASK)) | Flags;
+		}
+
+		return (static_cast<Uint32>(Type) << ID_TYPE_SHIFT) | (Code & ID_CODE_MASK);
+	}
+
+	static constexpr Uint16 MakeIndex(const EInputKeyType Type, const Uint32 Code)
+	{
+		switch (Type)
+		{
+		case EInputKeyType::KeyboardButton:
+			return GetKeyboardIndex(Code);
+
+		case EInputKeyType::MouseButton:
+			return Code < MOUSE_BUTTON_COUNT ? static_cast<Uint16>(MOUSE_BUTTON_INDEX + Code) : INVALID_INDEX;
+
+		case EInputKeyType::MouseAxis1D:
+			return Code == static_cast<Uint32>(EInputAxisOrientation::X) ? static_cast<Uint16>(MOUSE_AXIS_INDEX)
+				: Code == static_cast<Uint32>(EInputAxisOrientation::Y) ? static_cast<Uint16>(MOUSE_AXIS_INDEX + 1) : INVALID_INDEX;
+
+		case EInputKeyType::GamepadButton:
+			return Code < GAMEPAD_BUTTON_COUNT ? static_cast<Uint16>(GAMEPAD_BUTTON_INDEX + Code) : INVALID_INDEX;
+
+		case EInputKeyType::GamepadTriggerAxis:
+		case EInputKeyType::GamepadJoystickAxis1D:
+			return Code < GAMEPAD_AXIS_COUNT ? static_cast<Uint16>(GAMEPAD_AXIS_INDEX + Code) : INVALID_INDEX;
+
+		default:
+			return INVALID_INDEX;
+		}
+	}
 };
 
 namespace std
@@ -212,42 +318,8 @@ struct hash<FInputKey>
 {
 	size_t operator()(const FInputKey& InputKey) const noexcept
 	{
-		size_t seed = std::hash<Uint8>{}(static_cast<Uint8>(InputKey.Type));
-
-		// Come the hash with the specific active member of the union based on type
-		switch (InputKey.Type)
-		{
-		case EInputKeyType::KeyboardButton:
-		case EInputKeyType::MouseButton:
-			HashCombine(seed, static_cast<int>(InputKey.ButtonCode));
-			break;
-
-		case EInputKeyType::MouseAxis1D:
-			HashCombine(seed, static_cast<int>(InputKey.AxisOrientation));
-			break;
-
-		case EInputKeyType::MouseAxis2D:
-			break; // type only - no union data
-
-		case EInputKeyType::GamepadButton:
-			HashCombine(seed, InputKey.GamepadButton);
-			break;
-
-		case EInputKeyType::GamepadTriggerAxis:
-		case EInputKeyType::GamepadJoystickAxis1D:
-			HashCombine(seed, InputKey.GamepadAxis);
-			break;
-
-		case EInputKeyType::GamepadJoystickAxis2D:
-			HashCombine(seed, InputKey.GamepadAxisPair);
-			break;
-
-		case EInputKeyType::Unknown:
-			HashCombine(seed, InputKey.RawValue); // Hash the raw value for unknown
-			break;
-		}
-
-		return seed;
+		// Ids are already unique per key.
+		return InputKey.Id;
 	}
 };
 }
@@ -4,12 +4,81 @@
 #include "InputManager.h"
 
 // Libraries
+#include <algorithm>
+#include <array>
 #include <iostream>
+#include <span>
 #include <string>
+#include <vector>
 
 // Starlight Engine
+#include "InputProcessor.h"
 #include "Debug/Logging.h"
 
+namespace
+{
+struct FEventRange
+{
+	Uint32 First;
+	Uint32 Last;
+};
+
+// Events the input thread takes off the queue, in ascending order.
+constexpr FEventRange INPUT_THREAD_EVENTS[] =
+{
+	{SDL_EVENT_QUIT, SDL_EVENT_QUIT},
+	{SDL_EVENT_WINDOW_FOCUS_LOST, SDL_EVENT_WINDOW_FOCUS_LOST},
+	{SDL_EVENT_KEY_DOWN, SDL_EVENT_KEY_UP},
+	{SDL_EVENT_MOUSE_MOTION, SDL_EVENT_MOUSE_WHEEL},
+	{SDL_EVENT_GAMEPAD_AXIS_MOTION, SDL_EVENT_GAMEPAD_BUTTON_UP},
+};
+
+// The gaps around INPUT_THREAD_EVENTS, which the main thread takes while the input thread runs.
+constexpr std::array<FEventRange, std::size(INPUT_THREAD_EVENTS) + 1> MAIN_THREAD_EVENTS = []
+{
+	std::array<FEventRange, std::size(INPUT_THREAD_EVENTS) + 1> Gaps{};
+	Uint32 First = SDL_EVENT_FIRST;
+	for (size_t Index = 0; Index < std::size(INPUT_THREAD_EVENTS); ++Index)
+	{
+		Gaps[Index] = {First, INPUT_THREAD_EVENTS[Index].First - 1};
+		First = INPUT_THREAD_EVENTS[Index].Last + 1;
+	}
+	Gaps.back() = {First, SDL_EVENT_LAST};
+	return Gaps;
+}();
+
+bool IsInputEvent(const Uint32 Type)
+{
+	return std::any_of(std::begin(INPUT_THREAD_EVENTS), std::end(INPUT_THREAD_EVENTS), [Type](const FEventRange& Range)
+	{
+		return Type >= Range.First && Type <= Range.Last;
+	});
+}
+
+// Takes every queued event in Ranges off the queue into OutEvents, oldest first.
+void TakeEvents(const std::span<const FEventRange> Ranges, std::vector<SDL_Event>& OutEvents)
+{
+	constexpr int EVENT_BATCH_SIZE = 64;
+	SDL_Event Events[EVENT_BATCH_SIZE];
+
+	OutEvents.clear();
+	for (const FEventRange& Range : Ranges)
+	{
+		int EventCount;
+		while ((EventCount = SDL_PeepEvents(Events, EVENT_BATCH_SIZE, SDL_GETEVENT, Range.First, Range.Last)) > 0)
+		{
+			OutEvents.insert(OutEvents.end(), Events, Events + EventCount);
+		}
+	}
+
+	// Each range comes off the queue in order, but the ranges are interleaved in time.
+	std::stable_sort(OutEvents.begin(), OutEvents.end(), [](const SDL_Event& A, const SDL_Event& B)
+	{
+		return A.common.timestamp < B.common.timestamp;
+	});
+}
+}
+
 InputManager::InputManager()
 {
 	// Construction goes here
@@ -27,10 +96,56 @@ bool InputManager::Initialize()
 
 void InputManager::Shutdown()
 {
-	// Shutdown
+	StopInputThread();
+	StopRecording();
+	StopReplay();
+
+	for (SDL_Gamepad* Gamepad : m_gamepads)
+	{
+		SDL_CloseGamepad(Gamepad);
+	}
+	m_gamepads.clear();
+
+	m_inputState.Reset();
+}
+
+void InputManager::ProcessEvents(bool& IsRunning, float& DeltaTime)
+{
+	m_inputState.BeginFrame();
+	for (InputProcessor* Processor : m_processors)
+	{
+		Processor->HandleFrameStart();
+	}
+
+	// Set by the input thread, including by its last pass before it was stopped.
+	if (m_quitRequested.exchange(false))
+	{
+		IsRunning = false;
+		SL_LOG_FUNC(LogInputManager, Debug, "SDL_EVENT_QUIT received. Shutting down engine.");
+	}
+
+	if (IsReplaying())
+	{
+		ReplayFrame(IsRunning, DeltaTime);
+		return;
+	}
+
+	if (IsInputThreadRunning())
+	{
+		// OS events can only be pumped from the main thread. The input thread drains the input events from the queue.
+		SDL_PumpEvents();
+		PollMainThreadEvents();
+		ConsumeInputSnapshot();
+	}
+	else
+	{
+		PollEvents(IsRunning);
+	}
+
+	m_inputRecorder.EndFrame(DeltaTime);
 }
 
-void InputManager::ProcessEvents(bool& IsRunning)
+void InputManager::PollEvents(bool& IsRunning)
 {
 	SDL_Event ActiveEvent;
 	while (SDL_PollEvent(&ActiveEvent))
@@ -41,216 +156,350 @@ void InputManager::ProcessEvents(bool& IsRunning)
 			IsRunning = false;
 			SL_LOG_FUNC(LogInputManager, Debug, "SDL_EVENT_QUIT received. Shutting down engine.");
 			break;
-		case SDL_EVENT_TERMINATING:
-			break;
-		case SDL_EVENT_LOW_MEMORY:
-			break;
-		case SDL_EVENT_WILL_ENTER_BACKGROUND:
-			break;
-		case SDL_EVENT_DID_ENTER_BACKGROUND:
-			break;
-		case SDL_EVENT_WILL_ENTER_FOREGROUND:
-			break;
-		case SDL_EVENT_DID_ENTER_FOREGROUND:
-			break;
-		case SDL_EVENT_LOCALE_CHANGED:
-			break;
-		case SDL_EVENT_SYSTEM_THEME_CHANGED:
-			break;
-		case SDL_EVENT_DISPLAY_ORIENTATION:
-			break;
-		case SDL_EVENT_DISPLAY_ADDED:
-			break;
-		case SDL_EVENT_DISPLAY_REMOVED:
-			break;
-		case SDL_EVENT_DISPLAY_MOVED:
-			break;
-		case SDL_EVENT_DISPLAY_DESKTOP_MODE_CHANGED:
-			break;
-		case SDL_EVENT_DISPLAY_CURRENT_MODE_CHANGED:
-			break;
-		case SDL_EVENT_DISPLAY_CONTENT_SCALE_CHANGED:
-			break;
-		case SDL_EVENT_WINDOW_SHOWN:
-			break;
-		case SDL_EVENT_WINDOW_HIDDEN:
-			break;
-		case SDL_EVENT_WINDOW_EXPOSED:
-			break;
-		case SDL_EVENT_WINDOW_MOVED:
-			break;
-		case SDL_EVENT_WINDOW_RESIZED:
-			break;
-		case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
-			break;
-		case SDL_EVENT_WINDOW_METAL_VIEW_RESIZED:
-			break;
-		case SDL_EVENT_WINDOW_MINIMIZED:
-			break;
-		case SDL_EVENT_WINDOW_MAXIMIZED:
-			break;
-		case SDL_EVENT_WINDOW_RESTORED:
-			break;
-		case SDL_EVENT_WINDOW_MOUSE_ENTER:
-			break;
-		case SDL_EVENT_WINDOW_MOUSE_LEAVE:
-			break;
-		case SDL_EVENT_WINDOW_FOCUS_GAINED:
-			break;
-		case SDL_EVENT_WINDOW_FOCUS_LOST:
-			break;
-		case SDL_EVENT_WINDOW_CLOSE_REQUESTED:
-			break;
-		case SDL_EVENT_WINDOW_HIT_TEST:
-			break;
-		case SDL_EVENT_WINDOW_ICCPROF_CHANGED:
-			break;
-		case SDL_EVENT_WINDOW_DISPLAY_CHANGED:
-			break;
-		case SDL_EVENT_WINDOW_DISPLAY_SCALE_CHANGED:
-			break;
-		case SDL_EVENT_WINDOW_SAFE_AREA_CHANGED:
-			break;
-		case SDL_EVENT_WINDOW_OCCLUDED:
-			break;
-		case SDL_EVENT_WINDOW_ENTER_FULLSCREEN:
-			break;
-		case SDL_EVENT_WINDOW_LEAVE_FULLSCREEN:
-			break;
-		case SDL_EVENT_WINDOW_DESTROYED:
-			break;
-		case SDL_EVENT_WINDOW_HDR_STATE_CHANGED:
-			break;
-		case SDL_EVENT_KEY_DOWN:
-			break;
-		case SDL_EVENT_KEY_UP:
-			break;
-		case SDL_EVENT_TEXT_EDITING:
-			break;
-		case SDL_EVENT_TEXT_INPUT:
-			break;
-		case SDL_EVENT_KEYMAP_CHANGED:
-			break;
-		case SDL_EVENT_KEYBOARD_ADDED:
-			break;
-		case SDL_EVENT_KEYBOARD_REMOVED:
-			break;
-		case SDL_EVENT_TEXT_EDITING_CANDIDATES:
-			break;
-		case SDL_EVENT_MOUSE_MOTION:
-			break;
-		case SDL_EVENT_MOUSE_BUTTON_DOWN:
-			break;
-		case SDL_EVENT_MOUSE_BUTTON_UP:
-			break;
-		case SDL_EVENT_MOUSE_WHEEL:
-			break;
-		case SDL_EVENT_MOUSE_ADDED:
-			break;
-		case SDL_EVENT_MOUSE_REMOVED:
-			break;
-		case SDL_EVENT_JOYSTICK_AXIS_MOTION:
-			break;
-		case SDL_EVENT_JOYSTICK_BALL_MOTION:
-			break;
-		case SDL_EVENT_JOYSTICK_HAT_MOTION:
-			break;
-		case SDL_EVENT_JOYSTICK_BUTTON_DOWN:
-			break;
-		case SDL_EVENT_JOYSTICK_BUTTON_UP:
-			break;
-		case SDL_EVENT_JOYSTICK_ADDED:
-			break;
-		case SDL_EVENT_JOYSTICK_REMOVED:
-			break;
-		case SDL_EVENT_JOYSTICK_BATTERY_UPDATED:
-			break;
-		case SDL_EVENT_JOYSTICK_UPDATE_COMPLETE:
-			break;
-		case SDL_EVENT_GAMEPAD_AXIS_MOTION:
-			break;
-		case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
-			break;
-		case SDL_EVENT_GAMEPAD_BUTTON_UP:
-			break;
 		case SDL_EVENT_GAMEPAD_ADDED:
-			break;
 		case SDL_EVENT_GAMEPAD_REMOVED:
+			HandleGamepadDeviceEvent(ActiveEvent);
 			break;
-		case SDL_EVENT_GAMEPAD_REMAPPED:
-			break;
-		case SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN:
-			break;
-		case SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION:
-			break;
-		case SDL_EVENT_GAMEPAD_TOUCHPAD_UP:
-			break;
-		case SDL_EVENT_GAMEPAD_SENSOR_UPDATE:
-			break;
-		case SDL_EVENT_GAMEPAD_UPDATE_COMPLETE:
-			break;
-		case SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED:
-			break;
-		case SDL_EVENT_FINGER_DOWN:
-			break;
-		case SDL_EVENT_FINGER_UP:
-			break;
-		case SDL_EVENT_FINGER_MOTION:
-			break;
-		case SDL_EVENT_FINGER_CANCELED:
-			break;
-		case SDL_EVENT_CLIPBOARD_UPDATE:
-			break;
-		case SDL_EVENT_DROP_FILE:
-			break;
-		case SDL_EVENT_DROP_TEXT:
-			break;
-		case SDL_EVENT_DROP_BEGIN:
-			break;
-		case SDL_EVENT_DROP_COMPLETE:
-			break;
-		case SDL_EVENT_DROP_POSITION:
-			break;
-		case SDL_EVENT_AUDIO_DEVICE_ADDED:
-			break;
-		case SDL_EVENT_AUDIO_DEVICE_REMOVED:
-			break;
-		case SDL_EVENT_AUDIO_DEVICE_FORMAT_CHANGED:
-			break;
-		case SDL_EVENT_PEN_PROXIMITY_IN:
-			break;
-		case SDL_EVENT_PEN_PROXIMITY_OUT:
-			break;
-		case SDL_EVENT_PEN_DOWN:
-			break;
-		case SDL_EVENT_PEN_UP:
-			break;
-		case SDL_EVENT_PEN_BUTTON_DOWN:
-			break;
-		case SDL_EVENT_PEN_BUTTON_UP:
-			break;
-		case SDL_EVENT_PEN_MOTION:
-			break;
-		case SDL_EVENT_PEN_AXIS:
-			break;
-		case SDL_EVENT_CAMERA_DEVICE_ADDED:
-			break;
-		case SDL_EVENT_CAMERA_DEVICE_REMOVED:
-			break;
-		case SDL_EVENT_CAMERA_DEVICE_APPROVED:
-			break;
-		case SDL_EVENT_CAMERA_DEVICE_DENIED:
-			break;
-		case SDL_EVENT_RENDER_TARGETS_RESET:
-			break;
-		case SDL_EVENT_RENDER_DEVICE_RESET:
+		case SDL_EVENT_WINDOW_FOCUS_LOST:
+			SubmitFocusLost(ActiveEvent.common.timestamp);
 			break;
-		case SDL_EVENT_RENDER_DEVICE_LOST:
+		default:
 			break;
-		case SDL_EVENT_POLL_SENTINEL:
+		}
+
+		if (IsInputEvent(ActiveEvent.type) == false)
+		{
+			DispatchSystemEvent(ActiveEvent);
+			continue;
+		}
+
+		m_inputState.HandleEvent(ActiveEvent);
+
+		FInputEvent InputEvent;
+		if (FInputEventBuffer::TranslateEvent(ActiveEvent, InputEvent))
+		{
+			SubmitEvent(InputEvent);
+		}
+	}
+}
+
+void InputManager::PollMainThreadEvents()
+{
+	TakeEvents(MAIN_THREAD_EVENTS, m_mainEventBatch);
+	for (const SDL_Event& Event : m_mainEventBatch)
+	{
+		if (Event.type == SDL_EVENT_GAMEPAD_ADDED || Event.type == SDL_EVENT_GAMEPAD_REMOVED)
+		{
+			HandleGamepadDeviceEvent(Event);
+		}
+
+		DispatchSystemEvent(Event);
+	}
+}
+
+void InputManager::AddProcessor(InputProcessor* Processor)
+{
+	if (Processor != nullptr && std::find(m_processors.begin(), m_processors.end(), Processor) == m_processors.end())
+	{
+		m_processors.push_back(Processor);
+	}
+}
+
+void InputManager::RemoveProcessor(InputProcessor* Processor)
+{
+	std::erase(m_processors, Processor);
+}
+
+bool InputManager::StartInputThread(const Uint32 PollRateHz)
+{
+	if (IsInputThreadRunning())
+	{
+		return true;
+	}
+
+	if (PollRateHz == 0)
+	{
+		SL_LOG_FUNC(LogInputManager, Error, "PollRateHz must be greater than zero.");
+		return false;
+	}
+
+	m_threadState = m_inputState;
+	m_stopInputThread = false;
+	m_inputThread = std::thread(&InputManager::InputThreadMain, this, SDL_NS_PER_SECOND / PollRateHz);
+	return true;
+}
+
+void InputManager::StopInputThread()
+{
+	if (IsInputThreadRunning() == false)
+	{
+		return;
+	}
+
+	m_stopInputThread = true;
+	m_inputThread.join();
+
+	// Events the thread took off the queue in its last pass are only in its last snapshot.
+	ConsumeInputSnapshot();
+}
+
+void InputManager::HandleGamepadDeviceEvent(const SDL_Event& Event)
+{
+	if (Event.type == SDL_EVENT_GAMEPAD_ADDED)
+	{
+		if (SDL_Gamepad* Gamepad = SDL_OpenGamepad(Event.gdevice.which))
+		{
+			m_gamepads.push_back(Gamepad);
+		}
+	}
+	else if (Event.type == SDL_EVENT_GAMEPAD_REMOVED)
+	{
+		if (SDL_Gamepad* Gamepad = SDL_GetGamepadFromID(Event.gdevice.which))
+		{
+			std::erase(m_gamepads, Gamepad);
+			SDL_CloseGamepad(Gamepad);
+		}
+	}
+}
+
+void InputManager::InputThreadMain(const Uint64 PollIntervalNS)
+{
+	while (m_stopInputThread == false)
+	{
+		const Uint64 PollStartNS = SDL_GetTicksNS();
+
+		// Reads gamepads now rather than waiting for the main thread to pump.
+		SDL_UpdateGamepads();
+
+		TakeEvents(INPUT_THREAD_EVENTS, m_threadEventBatch);
+		for (const SDL_Event& Event : m_threadEventBatch)
+		{
+			if (Event.type == SDL_EVENT_QUIT)
+			{
+				m_quitRequested = true;
+			}
+			else if (Event.type == SDL_EVENT_WINDOW_FOCUS_LOST)
+			{
+				++m_threadFocusLostCount;
+			}
+
+			m_threadState.HandleEvent(Event);
+
+			FInputEvent InputEvent;
+			if (FInputEventBuffer::TranslateEvent(Event, InputEvent))
+			{
+				m_threadEvents.Push(InputEvent);
+			}
+		}
+
+		// Deltas and edges are rebuilt from the events on the game thread, only held state is handed over.
+		m_threadState.BeginFrame();
+
+		FInputSnapshot& Snapshot = m_inputSnapshots.GetWriteBuffer();
+		Snapshot.State = m_threadState;
+		for (Uint64 Sequence = m_threadEvents.GetFirstSequence(); Sequence < m_threadEvents.GetEndSequence(); ++Sequence)
+		{
+			Snapshot.Events[Sequence & (FInputSnapshot::EVENT_CAPACITY - 1)] = m_threadEvents.At(Sequence);
+		}
+		Snapshot.EventEndSequence = m_threadEvents.GetEndSequence();
+		Snapshot.FocusLostCount = m_threadFocusLostCount;
+		m_inputSnapshots.Publish();
+
+		const Uint64 ElapsedNS = SDL_GetTicksNS() - PollStartNS;
+		if (ElapsedNS < PollIntervalNS)
+		{
+			SDL_DelayPrecise(PollIntervalNS - ElapsedNS);
+		}
+	}
+}
+
+void InputManager::ConsumeInputSnapshot()
+{
+	if (m_inputSnapshots.Acquire() == false)
+	{
+		return;
+	}
+
+	const FInputSnapshot& Snapshot = m_inputSnapshots.GetReadBuffer();
+	if (Snapshot.FocusLostCount != m_appliedFocusLostCount)
+	{
+		m_appliedFocusLostCount = Snapshot.FocusLostCount;
+		m_inputState.Reset();
+		SubmitFocusLost(SDL_GetTicksNS());
+	}
+
+	// Each snapshot repeats the most recent events, so only apply the ones not seen yet.
+	const Uint64 OldestHeldSequence = Snapshot.EventEndSequence > FInputSnapshot::EVENT_CAPACITY ? Snapshot.EventEndSequence - FInputSnapshot::EVENT_CAPACITY : 0;
+	if (m_appliedEventSequence < OldestHeldSequence)
+	{
+		SL_LOG_FUNC(LogInputManager, Warning, FString(static_cast<int>(OldestHeldSequence - m_appliedEventSequence)) + " input events were dropped.");
+		m_appliedEventSequence = OldestHeldSequence;
+	}
+
+	for (; m_appliedEventSequence < Snapshot.EventEndSequence; ++m_appliedEventSequence)
+	{
+		const FInputEvent& InputEvent = Snapshot.Events[m_appliedEventSequence & (FInputSnapshot::EVENT_CAPACITY - 1)];
+		m_inputState.ApplyInputEvent(InputEvent);
+		SubmitEvent(InputEvent);
+	}
+
+	m_inputState.SyncHeldState(Snapshot.State);
+}
+
+bool InputManager::StartRecording(const FString& FilePath)
+{
+	if (IsReplaying())
+	{
+		SL_LOG_FUNC(LogInputManager, Warning, "Cannot record input while replaying.");
+		return false;
+	}
+
+	return m_inputRecorder.Start(FilePath, m_inputState.GetMousePosition());
+}
+
+void InputManager::StopRecording()
+{
+	m_inputRecorder.Stop();
+}
+
+bool InputManager::StartReplay(const FString& FilePath, const EInputReplayMode Mode)
+{
+	StopRecording();
+	StopInputThread();
+
+	if (m_inputReplay.Load(FilePath) == false)
+	{
+		return false;
+	}
+
+	// Start from the recorded state, not whatever is held right now.
+	m_inputState.Reset();
+	m_inputState.SetMousePosition(m_inputReplay.GetStartMousePosition());
+	for (InputProcessor* Processor : m_processors)
+	{
+		Processor->HandleFocusLost();
+	}
+
+	m_replayMode = Mode;
+	m_replayStartNS = SDL_GetTicksNS();
+	SL_LOG_FUNC(LogInputManager, Display, "Replaying input from \"" + FilePath + "\".");
+	return true;
+}
+
+void InputManager::StopReplay()
+{
+	m_inputReplay.Stop();
+}
+
+void InputManager::ReplayFrame(bool& IsRunning, float& DeltaTime)
+{
+	// Keep the window responsive and closable, but leave every input to the recording.
+	SDL_Event ActiveEvent;
+	while (SDL_PollEvent(&ActiveEvent))
+	{
+		if (ActiveEvent.type == SDL_EVENT_QUIT)
+		{
+			IsRunning = false;
+			SL_LOG_FUNC(LogInputManager, Debug, "SDL_EVENT_QUIT received. Shutting down engine.");
+		}
+		else if (ActiveEvent.type == SDL_EVENT_GAMEPAD_ADDED || ActiveEvent.type == SDL_EVENT_GAMEPAD_REMOVED)
+		{
+			HandleGamepadDeviceEvent(ActiveEvent);
+		}
+
+		if (IsInputEvent(ActiveEvent.type) == false)
+		{
+			DispatchSystemEvent(ActiveEvent);
+		}
+	}
+
+	const bool bReadFrame = m_inputReplay.ReadFrame(DeltaTime, [this](const FInputEvent* InputEvent)
+	{
+		if (InputEvent == nullptr)
+		{
+			m_inputState.Reset();
+			SubmitFocusLost(SDL_GetTicksNS());
+			return;
+		}
+
+		m_inputState.ApplyInputEvent(*InputEvent);
+		SubmitEvent(*InputEvent);
+	});
+
+	if (bReadFrame)
+	{
+		return;
+	}
+
+	// The frame that found the end of the log did no work, so it is not counted.
+	const Uint64 FrameCount = m_inputReplay.GetFramesRead();
+	const double ElapsedMS = static_cast<double>(SDL_GetTicksNS() - m_replayStartNS) / SDL_NS_PER_MS;
+	const double AverageMS = FrameCount > 0 ? ElapsedMS / static_cast<double>(FrameCount) : 0.0;
+	SL_LOG_FUNC(LogInputManager, Display, "Replay finished: " + FString(static_cast<int>(FrameCount)) + " frames in " + FString(static_cast<float>(ElapsedMS)) + " ms, " + FString(static_cast<float>(AverageMS)) + " ms per frame.");
+
+	if (m_replayMode == EInputReplayMode::Benchmark)
+	{
+		IsRunning = false;
+	}
+
+	m_inputReplay.Stop();
+	m_inputState.Reset();
+	DeltaTime = 0.f;
+}
+
+void InputManager::SubmitEvent(const FInputEvent& InputEvent)
+{
+	m_inputRecorder.RecordEvent(InputEvent);
+	m_eventBuffer.Push(InputEvent);
+	DispatchEvent(InputEvent);
+}
+
+void InputManager::SubmitFocusLost(const Uint64 TimestampNS)
+{
+	m_inputRecorder.RecordFocusLost(TimestampNS);
+	for (InputProcessor* Processor : m_processors)
+	{
+		Processor->HandleFocusLost();
+	}
+}
+
+void InputManager::DispatchEvent(const FInputEvent& InputEvent) const
+{
+	for (InputProcessor* Processor : m_processors)
+	{
+		switch (InputEvent.Type)
+		{
+		case EInputEventType::Pressed:
+			Processor->HandleKeyDown(InputEvent.Key);
+			break;
+		case EInputEventType::Released:
+			Processor->HandleKeyUp(InputEvent.Key);
+			break;
+		case EInputEventType::Axis:
+			if (InputEvent.Key.Type == EInputKeyType::MouseAxis2D)
+			{
+				Processor->HandleAxis(EInputKeys::MouseX, InputEvent.Value.x);
+				Processor->HandleAxis(EInputKeys::MouseY, InputEvent.Value.y);
+				Processor->HandleMouseMove(m_inputState.GetMousePosition(), InputEvent.Value);
+			}
+			else
+			{
+				Processor->HandleAxis(InputEvent.Key, InputEvent.Value.x);
+			}
+			break;
+		case EInputEventType::Wheel:
+			Processor->HandleMouseWheel(InputEvent.Value);
 			break;
 		default:
 			break;
 		}
 	}
 }
+
+void InputManager::DispatchSystemEvent(const SDL_Event& Event) const
+{
+	for (InputProcessor* Processor : m_processors)
+	{
+		Processor->HandleSystemEvent(Event);
+	}
+}
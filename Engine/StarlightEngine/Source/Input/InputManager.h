@@ -3,10 +3,46 @@
 #pragma once
 
 // Libraries
+#include <atomic>
+#include <thread>
+#include <vector>
 #include <SDL3/SDL.h>
 
+// Starlight Engine
+#include "InputEventBuffer.h"
+#include "InputRecording.h"
+#include "InputState.h"
+#include "Framework/RingBuffer.h"
+#include "Framework/TripleBuffer.h"
+
 // Forward Declarations
 class Engine;
+class InputProcessor;
+
+// What the input thread hands over to the game thread.
+struct FInputSnapshot
+{
+	static constexpr Uint32 EVENT_CAPACITY = 256;
+
+	// Held buttons, positions and axes. Edges and deltas are rebuilt on the game thread from Events.
+	FInputState State;
+
+	// The most recent events, stored at Sequence & (EVENT_CAPACITY - 1).
+	FInputEvent Events[EVENT_CAPACITY];
+	Uint64 EventEndSequence = 0;
+
+	// Counts every time the window lost focus.
+	Uint32 FocusLostCount = 0;
+};
+
+enum class EInputReplayMode : Uint8
+{
+	// Plays back at the normal frame rate, then hands control back to live input.
+	Realtime,
+
+	// Plays back without frame pacing, logs the frame times and quits once the recording ends.
+	Benchmark,
+};
 
 class InputManager
 {
@@ -18,12 +54,120 @@ class InputManager
 	bool Initialize();
 	void Shutdown();
 
-	void ProcessEvents(bool& IsRunning);
+	// DeltaTime is recorded while recording, and replaced by the recorded one while replaying.
+	void ProcessEvents(bool& IsRunning, float& DeltaTime);
+
+public:
+	// Input as of the last ProcessEvents. Queries are O(1) and can be polled freely.
+	const FInputState& GetState() const { return m_inputState; }
+
+	bool IsKeyDown(const FInputKey& InputKey) const { return m_inputState.IsDown(InputKey); }
+	bool WasKeyPressed(const FInputKey& InputKey) const { return m_inputState.WasPressed(InputKey); }
+	bool WasKeyReleased(const FInputKey& InputKey) const { return m_inputState.WasReleased(InputKey); }
+	float GetAxisValue(const FInputKey& InputKey) const { return m_inputState.GetAxisValue(InputKey); }
+	FVector2 GetAxis2DValue(const FInputKey& InputKey) const { return m_inputState.GetAxis2DValue(InputKey); }
+
+	// Timestamped input events of the last few frames, see FInputEventBuffer.
+	const FInputEventBuffer& GetEventBuffer() const { return m_eventBuffer; }
+
+	// Processors are not owned and must be removed before they are destroyed.
+	void AddProcessor(InputProcessor* Processor);
+	void RemoveProcessor(InputProcessor* Processor);
+
+	/**
+	 * @brief Moves the draining and translation of input events onto a dedicated thread that runs at PollRateHz.
+	 * The thread only takes keyboard, mouse, gamepad, focus lost and quit events off the queue. Everything else, gamepads
+	 * being connected included, is still handled by ProcessEvents on the main thread, which picks up the input through a
+	 * lock-free triple buffer.
+	 *
+	 * Only gamepads gain latency from this: they are polled on the thread itself. SDL only allows the main thread to pump
+	 * OS events, so keyboard and mouse events still reach the queue once per ProcessEvents, as without the thread.
+	 */
+	bool StartInputThread(Uint32 PollRateHz = 1000);
+	void StopInputThread();
+	bool IsInputThreadRunning() const { return m_inputThread.joinable(); }
+
+	/**
+	 * @brief Records every translated input event, and each frame's delta time, to a binary log at FilePath.
+	 * Replaying the log with the same content reproduces the session frame for frame.
+	 */
+	bool StartRecording(const FString& FilePath);
+	void StopRecording();
+	bool IsRecording() const { return m_inputRecorder.IsRecording(); }
+
+	// Feeds a recorded log in place of live input. Live input is ignored apart from quitting.
+	bool StartReplay(const FString& FilePath, EInputReplayMode Mode = EInputReplayMode::Realtime);
+	void StopReplay();
+	bool IsReplaying() const { return m_inputReplay.IsReplaying(); }
+
+	// Whether the main loop should skip frame pacing.
+	bool IsUnthrottled() const { return IsReplaying() && m_replayMode == EInputReplayMode::Benchmark; }
+
+private:
+	// Opens and closes gamepads as they are connected. Main thread only.
+	void HandleGamepadDeviceEvent(const SDL_Event& Event);
+
+	void InputThreadMain(Uint64 PollIntervalNS);
+
+	// Drains SDL's queue on the calling thread.
+	void PollEvents(bool& IsRunning);
+
+	// Drains the events the input thread leaves on the queue.
+	void PollMainThreadEvents();
+
+	// Applies the newest snapshot published by the input thread.
+	void ConsumeInputSnapshot();
+
+	// Applies the next recorded frame.
+	void ReplayFrame(bool& IsRunning, float& DeltaTime);
+
+	// Records, buffers and dispatches an event that was already folded into the state.
+	void SubmitEvent(const FInputEvent& InputEvent);
+	void SubmitFocusLost(Uint64 TimestampNS);
+
+	// Forwards an input event to the registered processors.
+	void DispatchEvent(const FInputEvent& InputEvent) const;
+
+	// Forwards an event that is not input to the registered processors.
+	void DispatchSystemEvent(const SDL_Event& Event) const;
+
+	FInputState m_inputState;
+	FInputEventBuffer m_eventBuffer;
+
+	// Gamepads must be opened to receive their events.
+	std::vector<SDL_Gamepad*> m_gamepads;
+
+	std::vector<InputProcessor*> m_processors;
+
+	// =============================================
+	// INPUT THREAD
+	// =============================================
+
+	std::thread m_inputThread;
+	std::atomic<bool> m_stopInputThread = false;
+	std::atomic<bool> m_quitRequested = false;
+
+	// Events taken off the queue in one go, put back in the order they happened. One for each thread.
+	std::vector<SDL_Event> m_threadEventBatch;
+	std::vector<SDL_Event> m_mainEventBatch;
+
+	TTripleBuffer<FInputSnapshot> m_inputSnapshots;
+
+	// Owned by the input thread while it runs. Kept across restarts so event sequences keep counting up.
+	FInputState m_threadState;
+	TRingBuffer<FInputEvent, FInputSnapshot::EVENT_CAPACITY> m_threadEvents;
+	Uint32 m_threadFocusLostCount = 0;
+
+	// How far the game thread has applied the snapshots.
+	Uint64 m_appliedEventSequence = 0;
+	Uint32 m_appliedFocusLostCount = 0;
 
-	// TODO: Add methods for querying key states, mouse position, etc.
-	// e.g., bool IsKeyPressed(SDL_Scancode key);
-	// e.g., int GetMouseX(), GetMouseY();
+	// =============================================
+	// RECORD & REPLAY
+	// =============================================
 
-	// No specific members needed for basic event polling, but could store
-	// key states, mouse states, etc., for more complex input handling.
+	FInputRecorder m_inputRecorder;
+	FInputReplay m_inputReplay;
+	EInputReplayMode m_replayMode = EInputReplayMode::Realtime;
+	Uint64 m_replayStartNS = 0;
 };
@@ -1 +1,14 @@
-#include "InputProcessor.h"
\ No newline at end of file
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "InputProcessor.h"
+
+InputProcessor::InputProcessor()
+{
+	//
+}
+
+InputProcessor::~InputProcessor()
+{
+	//
+}
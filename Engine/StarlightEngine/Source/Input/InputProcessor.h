@@ -3,15 +3,38 @@
 #pragma once
 
 // Starlight Engine
-#include "CoreMinimal.h"
 #include "InputKeys.h"
+#include "Math/Vector2.h"
 
+// Forward Declarations
+union SDL_Event;
+
+// Receives input events from the InputManager, once registered with InputManager::AddProcessor.
 class InputProcessor
 {
 public:
 	InputProcessor();
-	~InputProcessor();
+	virtual ~InputProcessor();
+
+	// Called before the events of a new frame are dispatched.
+	virtual void HandleFrameStart() {}
 
+	// Key repeats are not reported.
 	virtual void HandleKeyDown(const FInputKey& InputKey) {}
 	virtual void HandleKeyUp(const FInputKey& InputKey) {}
+
+	// Gamepad axes report their new normalised value. Mouse axes report the movement of this event in pixels.
+	virtual void HandleAxis(const FInputKey& InputKey, float Value) {}
+
+	// The mouse moved by Delta to Position, in window pixels. Reported alongside the MouseX and MouseY axes.
+	virtual void HandleMouseMove(const FVector2& Position, const FVector2& Delta) {}
+
+	// Positive Y scrolls away from the user.
+	virtual void HandleMouseWheel(const FVector2& Delta) {}
+
+	// The window lost focus, so anything held will not report being released.
+	virtual void HandleFocusLost() {}
+
+	// Any event that is not input, e.g. window, render, drop and user events, as SDL reported it. Always on the main thread.
+	virtual void HandleSystemEvent(const SDL_Event& Event) {}
 };
@@ -0,0 +1,195 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "InputRecording.h"
+
+// Libraries
+#include <SDL3/SDL_endian.h>
+#include <SDL3/SDL_timer.h>
+
+// Starlight Engine
+#include "Debug/Logging.h"
+
+// Recordings store events in native layout, which is only portable between little-endian targets.
+static_assert(SDL_BYTEORDER == SDL_LIL_ENDIAN, "Input recordings assume a little-endian platform");
+static_assert(sizeof(FInputRecordingEvent) == 24, "FInputRecordingEvent must stay tightly packed");
+
+namespace
+{
+// Written out once this much is buffered, so a long session only ever holds a little in memory.
+constexpr size_t FLUSH_THRESHOLD = 64 * 1024;
+
+template <typename T>
+void AppendBytes(std::vector<Uint8>& Bytes, const T* Data, const size_t Count)
+{
+	const Uint8* First = reinterpret_cast<const Uint8*>(Data);
+	Bytes.insert(Bytes.end(), First, First + sizeof(T) * Count);
+}
+}
+
+// =============================================
+// RECORDER
+// =============================================
+
+FInputRecorder::~FInputRecorder()
+{
+	Stop();
+}
+
+bool FInputRecorder::Start(const FString& InFilePath, const FVector2& MousePosition)
+{
+	Stop();
+
+	File = SDL_IOFromFile(InFilePath, "wb");
+	if (File == nullptr)
+	{
+		SL_LOG_FUNC(LogInputManager, Error, "Could not open \"" + InFilePath + "\" for writing! SDL_Error: " + SDL_GetErrorFString());
+		return false;
+	}
+
+	FilePath = InFilePath;
+	StartNS = SDL_GetTicksNS();
+
+	FInputRecordingHeader Header;
+	Header.Magic = MAGIC;
+	Header.Version = VERSION;
+	Header.EventSize = sizeof(FInputRecordingEvent);
+	Header.MousePosition = MousePosition;
+	AppendBytes(PendingBytes, &Header, 1);
+	return true;
+}
+
+void FInputRecorder::Stop()
+{
+	if (File == nullptr)
+	{
+		return;
+	}
+
+	bool bSuccess = Flush();
+	bSuccess &= SDL_CloseIO(File);
+	File = nullptr;
+
+	if (bSuccess == false)
+	{
+		SL_LOG_FUNC(LogInputManager, Error, "Failed writing \"" + FilePath + "\"! SDL_Error: " + SDL_GetErrorFString());
+	}
+
+	FrameEvents.clear();
+	PendingBytes.clear();
+}
+
+void FInputRecorder::RecordEvent(const FInputEvent& InputEvent)
+{
+	if (IsRecording())
+	{
+		FrameEvents.push_back(PackEvent(InputEvent, SDL_max(InputEvent.TimestampNS, StartNS) - StartNS));
+	}
+}
+
+void FInputRecorder::RecordFocusLost(const Uint64 TimestampNS)
+{
+	if (IsRecording())
+	{
+		FInputRecordingEvent RecordedEvent = {};
+		RecordedEvent.TimeNS = SDL_max(TimestampNS, StartNS) - StartNS;
+		RecordedEvent.EventType = FOCUS_LOST_EVENT;
+		FrameEvents.push_back(RecordedEvent);
+	}
+}
+
+void FInputRecorder::EndFrame(const float DeltaTime)
+{
+	if (IsRecording() == false)
+	{
+		return;
+	}
+
+	const FInputRecordingFrame Frame = {DeltaTime, static_cast<Uint32>(FrameEvents.size())};
+	AppendBytes(PendingBytes, &Frame, 1);
+	AppendBytes(PendingBytes, FrameEvents.data(), FrameEvents.size());
+	FrameEvents.clear();
+
+	if (PendingBytes.size() >= FLUSH_THRESHOLD && Flush() == false)
+	{
+		SL_LOG_FUNC(LogInputManager, Error, "Failed writing \"" + FilePath + "\"! Recording stopped. SDL_Error: " + SDL_GetErrorFString());
+		SDL_CloseIO(File);
+		File = nullptr;
+		PendingBytes.clear();
+	}
+}
+
+FInputRecordingEvent FInputRecorder::PackEvent(const FInputEvent& InputEvent, const Uint64 TimeNS)
+{
+	FInputRecordingEvent RecordedEvent = {};
+	RecordedEvent.TimeNS = TimeNS;
+	RecordedEvent.Value[0] = InputEvent.Value.x;
+	RecordedEvent.Value[1] = InputEvent.Value.y;
+	RecordedEvent.KeyId = InputEvent.Key.Id;
+	RecordedEvent.EventType = static_cast<Uint8>(InputEvent.Type);
+	return RecordedEvent;
+}
+
+bool FInputRecorder::Flush()
+{
+	const bool bSuccess = SDL_WriteIO(File, PendingBytes.data(), PendingBytes.size()) == PendingBytes.size();
+	PendingBytes.clear();
+	return bSuccess;
+}
+
+// =============================================
+// REPLAY
+// =============================================
+
+bool FInputReplay::Load(const FString& FilePath)
+{
+	Stop();
+
+	size_t DataSize = 0;
+	void* FileData = SDL_LoadFile(FilePath, &DataSize);
+	if (FileData == nullptr)
+	{
+		SL_LOG_FUNC(LogInputManager, Error, "Could not read \"" + FilePath + "\"! SDL_Error: " + SDL_GetErrorFString());
+		return false;
+	}
+
+	FInputRecordingHeader Header = {};
+	if (DataSize >= sizeof(Header))
+	{
+		SDL_memcpy(&Header, FileData, sizeof(Header));
+	}
+
+	if (Header.Magic != FInputRecorder::MAGIC || Header.Version != FInputRecorder::VERSION || Header.EventSize != sizeof(FInputRecordingEvent))
+	{
+		SL_LOG_FUNC(LogInputManager, Error, "\"" + FilePath + "\" is not a supported input recording.");
+		SDL_free(FileData);
+		return false;
+	}
+
+	const Uint8* Bytes = static_cast<const Uint8*>(FileData);
+	Data.assign(Bytes, Bytes + DataSize);
+	SDL_free(FileData);
+
+	ReadOffset = sizeof(Header);
+	StartMousePosition = Header.MousePosition;
+	BaseNS = SDL_GetTicksNS();
+	FramesRead = 0;
+	return true;
+}
+
+void FInputReplay::Stop()
+{
+	Data.clear();
+	Data.shrink_to_fit();
+	ReadOffset = 0;
+}
+
+FInputEvent FInputReplay::UnpackEvent(const FInputRecordingEvent& RecordedEvent, const Uint64 BaseNS)
+{
+	FInputEvent InputEvent;
+	InputEvent.TimestampNS = BaseNS + RecordedEvent.TimeNS;
+	InputEvent.Key = FInputKey::FromId(RecordedEvent.KeyId);
+	InputEvent.Value = FVector2(RecordedEvent.Value[0], RecordedEvent.Value[1]);
+	InputEvent.Type = static_cast<EInputEventType>(RecordedEvent.EventType);
+	return InputEvent;
+}
@@ -0,0 +1,166 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <vector>
+#include <SDL3/SDL_iostream.h>
+
+// Starlight Engine
+#include "InputEventBuffer.h"
+#include "Framework/String.h"
+#include "Math/Vector2.h"
+
+// Fixed header at the start of every input recording.
+struct FInputRecordingHeader
+{
+	Uint32 Magic;
+	Uint16 Version;
+	Uint16 EventSize;
+
+	// Where the mouse was when recording started, since only its movement is recorded.
+	FVector2 MousePosition;
+};
+
+// Start of each recorded frame, followed by EventCount events.
+struct FInputRecordingFrame
+{
+	// The frame's delta time, fed back to the engine on replay so the simulation steps identically.
+	float DeltaTime;
+	Uint32 EventCount;
+};
+
+// One event as stored in the file.
+struct FInputRecordingEvent
+{
+	// Since recording started.
+	Uint64 TimeNS;
+
+	float Value[2];
+
+	// FInputKey::Id.
+	Uint32 KeyId;
+
+	// An EInputEventType, or FOCUS_LOST_EVENT.
+	Uint8 EventType;
+	Uint8 Padding[3];
+};
+
+/**
+ * @brief Writes the translated input events of each frame, with their timing, to a binary log.
+ * Events are buffered in memory and written out in large blocks, so recording costs next to nothing per event.
+ */
+class FInputRecorder
+{
+public:
+	// 'SLIR' as read from a little-endian file.
+	static constexpr Uint32 MAGIC = 0x52494C53;
+	static constexpr Uint16 VERSION = 2;
+
+	// Recorded in place of an event when the window lost focus.
+	static constexpr Uint8 FOCUS_LOST_EVENT = 0xFF;
+
+	~FInputRecorder();
+
+	/// @returns whether the file could be opened.
+	bool Start(const FString& FilePath, const FVector2& MousePosition);
+
+	// Writes out everything recorded so far and closes the file.
+	void Stop();
+
+	bool IsRecording() const { return File != nullptr; }
+
+	void RecordEvent(const FInputEvent& InputEvent);
+	void RecordFocusLost(Uint64 TimestampNS);
+
+	// Closes the current frame. Call once per frame after its events were recorded.
+	void EndFrame(float DeltaTime);
+
+private:
+	static FInputRecordingEvent PackEvent(const FInputEvent& InputEvent, Uint64 TimeNS);
+
+	bool Flush();
+
+	SDL_IOStream* File = nullptr;
+	FString FilePath;
+	Uint64 StartNS = 0;
+
+	std::vector<FInputRecordingEvent> FrameEvents;
+	std::vector<Uint8> PendingBytes;
+};
+
+/**
+ * @brief Plays back a log written by FInputRecorder, one recorded frame per call.
+ * The whole log is loaded up front so replay never touches the disk.
+ */
+class FInputReplay
+{
+public:
+	/// @returns whether FilePath holds a valid recording.
+	bool Load(const FString& FilePath);
+	void Stop();
+
+	bool IsReplaying() const { return Data.empty() == false; }
+
+	const FVector2& GetStartMousePosition() const { return StartMousePosition; }
+
+	/**
+	 * @brief Reads the next recorded frame, calling Visitor(const FInputEvent*) for each of its events in order.
+	 * Event timestamps are shifted so the recording starts when Load was called. A null event marks where the window
+	 * lost focus.
+	 * @returns false once every frame has been read, or if the rest of the log is corrupt.
+	 */
+	template <typename TVisitor>
+	bool ReadFrame(float& OutDeltaTime, TVisitor&& Visitor);
+
+	Uint64 GetFramesRead() const { return FramesRead; }
+
+private:
+	static FInputEvent UnpackEvent(const FInputRecordingEvent& RecordedEvent, Uint64 BaseNS);
+
+	std::vector<Uint8> Data;
+	size_t ReadOffset = 0;
+
+	FVector2 StartMousePosition;
+	Uint64 BaseNS = 0;
+	Uint64 FramesRead = 0;
+};
+
+template <typename TVisitor>
+bool FInputReplay::ReadFrame(float& OutDeltaTime, TVisitor&& Visitor)
+{
+	FInputRecordingFrame Frame;
+	if (Data.size() - ReadOffset < sizeof(Frame))
+	{
+		return false;
+	}
+
+	SDL_memcpy(&Frame, Data.data() + ReadOffset, sizeof(Frame));
+	if (Frame.EventCount > (Data.size() - ReadOffset - sizeof(Frame)) / sizeof(FInputRecordingEvent))
+	{
+		return false;
+	}
+
+	ReadOffset += sizeof(Frame);
+	OutDeltaTime = Frame.DeltaTime;
+	++FramesRead;
+
+	for (Uint32 Index = 0; Index < Frame.EventCount; ++Index)
+	{
+		FInputRecordingEvent RecordedEvent;
+		SDL_memcpy(&RecordedEvent, Data.data() + ReadOffset, sizeof(RecordedEvent));
+		ReadOffset += sizeof(RecordedEvent);
+
+		if (RecordedEvent.EventType == FInputRecorder::FOCUS_LOST_EVENT)
+		{
+			Visitor(static_cast<const FInputEvent*>(nullptr));
+		}
+		else
+		{
+			const FInputEvent InputEvent = UnpackEvent(RecordedEvent, BaseNS);
+			Visitor(&InputEvent);
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,205 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "InputState.h"
+
+// Starlight Engine
+#include "InputEventBuffer.h"
+
+float FInputState::NormaliseGamepadAxis(const Sint16 Value)
+{
+	return SMath::Clamp(static_cast<float>(Value) / static_cast<float>(SDL_JOYSTICK_AXIS_MAX), -1.f, 1.f);
+}
+
+void FInputState::BeginFrame()
+{
+	Buttons.ClearEdges();
+
+	MouseDelta = FVector2(0.f);
+	MouseWheelDelta = FVector2(0.f);
+}
+
+void FInputState::HandleEvent(const SDL_Event& Event)
+{
+	switch (Event.type)
+	{
+	case SDL_EVENT_KEY_DOWN:
+	case SDL_EVENT_KEY_UP:
+		{
+			if (Event.key.scancode < SDL_SCANCODE_COUNT)
+			{
+				ScancodesDown.set(Event.key.scancode, Event.key.down);
+			}
+
+			const Uint16 KeyIndex = FInputKey::GetKeyboardIndex(Event.key.key);
+			if (KeyIndex != FInputKey::INVALID_INDEX)
+			{
+				Buttons.SetDown(KeyIndex, Event.key.down);
+			}
+			break;
+		}
+
+	case SDL_EVENT_MOUSE_MOTION:
+		MousePosition = FVector2(Event.motion.x, Event.motion.y);
+		MouseDelta += FVector2(Event.motion.xrel, Event.motion.yrel);
+		break;
+
+	case SDL_EVENT_MOUSE_BUTTON_DOWN:
+	case SDL_EVENT_MOUSE_BUTTON_UP:
+		MousePosition = FVector2(Event.button.x, Event.button.y);
+		if (Event.button.button < FInputKey::MOUSE_BUTTON_COUNT)
+		{
+			Buttons.SetDown(FInputKey::MOUSE_BUTTON_INDEX + Event.button.button, Event.button.down);
+		}
+		break;
+
+	case SDL_EVENT_MOUSE_WHEEL:
+		{
+			const float Direction = Event.wheel.direction == SDL_MOUSEWHEEL_FLIPPED ? -1.f : 1.f;
+			MouseWheelDelta += FVector2(Event.wheel.x, Event.wheel.y) * Direction;
+			break;
+		}
+
+	case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+	case SDL_EVENT_GAMEPAD_BUTTON_UP:
+		if (Event.gbutton.button < FInputKey::GAMEPAD_BUTTON_COUNT)
+		{
+			Buttons.SetDown(FInputKey::GAMEPAD_BUTTON_INDEX + Event.gbutton.button, Event.gbutton.down);
+		}
+		break;
+
+	case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+		if (Event.gaxis.axis < FInputKey::GAMEPAD_AXIS_COUNT)
+		{
+			GamepadAxes[Event.gaxis.axis] = NormaliseGamepadAxis(Event.gaxis.value);
+		}
+		break;
+
+	case SDL_EVENT_WINDOW_FOCUS_LOST:
+		Reset();
+		break;
+
+	default:
+		break;
+	}
+}
+
+void FInputState::ApplyInputEvent(const FInputEvent& InputEvent)
+{
+	const FInputKey& Key = InputEvent.Key;
+	switch (InputEvent.Type)
+	{
+	case EInputEventType::Pressed:
+	case EInputEventType::Released:
+		if (Key.Index < FInputKey::BUTTON_INDEX_COUNT)
+		{
+			Buttons.SetDown(Key.Index, InputEvent.Type == EInputEventType::Pressed);
+		}
+		break;
+
+	case EInputEventType::Axis:
+		if (Key.Type == EInputKeyType::MouseAxis2D)
+		{
+			MousePosition += InputEvent.Value;
+			MouseDelta += InputEvent.Value;
+		}
+		else if (Key.Index >= FInputKey::GAMEPAD_AXIS_INDEX && Key.Index < FInputKey::INDEX_COUNT)
+		{
+			GamepadAxes[Key.Index - FInputKey::GAMEPAD_AXIS_INDEX] = InputEvent.Value.x;
+		}
+		break;
+
+	case EInputEventType::Wheel:
+		MouseWheelDelta += InputEvent.Value;
+		break;
+	}
+}
+
+void FInputState::SyncHeldState(const FInputState& Source)
+{
+	Buttons.Down = Source.Buttons.Down;
+	ScancodesDown = Source.ScancodesDown;
+	MousePosition = Source.MousePosition;
+
+	for (Uint32 Axis = 0; Axis < FInputKey::GAMEPAD_AXIS_COUNT; ++Axis)
+	{
+		GamepadAxes[Axis] = Source.GamepadAxes[Axis];
+	}
+}
+
+void FInputState::Reset()
+{
+	// Report everything that was held as released, so nothing stays stuck down.
+	Buttons.Released |= Buttons.Down;
+	Buttons.Down.reset();
+
+	ScancodesDown.reset();
+	for (float& Axis : GamepadAxes)
+	{
+		Axis = 0.f;
+	}
+}
+
+template <typename TSelector>
+bool FInputState::TestButton(const FInputKey& InputKey, TSelector&& Selector) const
+{
+	return InputKey.Index < FInputKey::BUTTON_INDEX_COUNT && Selector(Buttons).test(InputKey.Index);
+}
+
+bool FInputState::IsDown(const FInputKey& InputKey) const
+{
+	return TestButton(InputKey, [](const auto& Bits) -> const auto& { return Bits.Down; });
+}
+
+bool FInputState::WasPressed(const FInputKey& InputKey) const
+{
+	return TestButton(InputKey, [](const auto& Bits) -> const auto& { return Bits.Pressed; });
+}
+
+bool FInputState::WasReleased(const FInputKey& InputKey) const
+{
+	return TestButton(InputKey, [](const auto& Bits) -> const auto& { return Bits.Released; });
+}
+
+float FInputState::GetAxisValue(const FInputKey& InputKey) const
+{
+	const Uint32 Index = InputKey.Index;
+	if (Index < FInputKey::BUTTON_INDEX_COUNT)
+	{
+		return Buttons.Down.test(Index) ? 1.f : 0.f;
+	}
+
+	if (Index < FInputKey::GAMEPAD_AXIS_INDEX)
+	{
+		return Index == FInputKey::MOUSE_AXIS_INDEX ? MouseDelta.x : MouseDelta.y;
+	}
+
+	if (Index < FInputKey::INDEX_COUNT)
+	{
+		return GamepadAxes[Index - FInputKey::GAMEPAD_AXIS_INDEX];
+	}
+
+	// 2D axes have no index of their own and report their horizontal half.
+	const bool bAxis2D = InputKey.Type == EInputKeyType::MouseAxis2D || InputKey.Type == EInputKeyType::GamepadJoystickAxis2D;
+	return bAxis2D ? GetAxis2DValue(InputKey).x : 0.f;
+}
+
+FVector2 FInputState::GetAxis2DValue(const FInputKey& InputKey) const
+{
+	switch (InputKey.Type)
+	{
+	case EInputKeyType::MouseAxis2D:
+		return MouseDelta;
+
+	case EInputKeyType::GamepadJoystickAxis2D:
+		{
+			const FInputGamepadAxisPair& Pair = InputKey.GamepadAxisPair;
+			const float X = static_cast<Uint32>(Pair.Horizontal) < FInputKey::GAMEPAD_AXIS_COUNT ? GamepadAxes[Pair.Horizontal] : 0.f;
+			const float Y = static_cast<Uint32>(Pair.Vertical) < FInputKey::GAMEPAD_AXIS_COUNT ? GamepadAxes[Pair.Vertical] : 0.f;
+			return FVector2(X, Y);
+		}
+
+	default:
+		return FVector2(GetAxisValue(InputKey), 0.f);
+	}
+}
@@ -0,0 +1,128 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <bitset>
+
+// SDL
+#include <SDL3/SDL_events.h>
+
+// Starlight Engine
+#include "InputKeys.h"
+#include "Math/Vector2.h"
+
+// Forward Declarations
+struct FInputEvent;
+
+/**
+ * @brief Snapshot of every button and axis for the current frame.
+ * Events are folded into bitsets as they arrive, indexed by FInputKey::Index, so any query is a single bit or array
+ * lookup.
+ * Pressed and released edges are kept for one frame, and a press and release within the same frame reports both.
+ * Gamepads are not told apart: every pad's buttons and axes share one set of bits and values, and the latest event from
+ * any pad wins. With several pads connected, a release on one clears a button another is still holding.
+ */
+class FInputState
+{
+public:
+	// Maps a raw SDL gamepad axis value to [-1, 1] for sticks, [0, 1] for triggers.
+	static float NormaliseGamepadAxis(Sint16 Value);
+
+	// Clears the one-frame edges and deltas. Call before feeding the frame's events.
+	void BeginFrame();
+
+	// Folds an event into the state. Events that are not input are ignored.
+	void HandleEvent(const SDL_Event& Event);
+
+	// Folds an already translated event into the state. Used when events were translated on another thread.
+	void ApplyInputEvent(const FInputEvent& InputEvent);
+
+	// Copies held buttons, positions and axes from Source, leaving this frame's edges and deltas alone.
+	// Corrects anything missed if events were dropped on the way.
+	void SyncHeldState(const FInputState& Source);
+
+	// Releases everything, e.g. when the window loses focus and release events would be missed.
+	void Reset();
+
+	// Used when the mouse position is not known from events, e.g. at the start of a replay.
+	void SetMousePosition(const FVector2& Position) { MousePosition = Position; }
+
+	// =============================================
+	// QUERIES
+	// =============================================
+
+	// Whether the button is currently down.
+	bool IsDown(const FInputKey& InputKey) const;
+
+	// Whether the button went down this frame.
+	bool WasPressed(const FInputKey& InputKey) const;
+
+	// Whether the button went up this frame.
+	bool WasReleased(const FInputKey& InputKey) const;
+
+	/**
+	 * @brief Value of a 1D axis, or 0/1 for buttons.
+	 * Mouse axes return the movement accumulated this frame in pixels. Gamepad sticks range from -1 to 1 and
+	 * triggers from 0 to 1.
+	 */
+	float GetAxisValue(const FInputKey& InputKey) const;
+
+	// Value of a 2D axis, see GetAxisValue. 1D keys fill X only.
+	FVector2 GetAxis2DValue(const FInputKey& InputKey) const;
+
+	// Physical key state, independent of keyboard layout. False for scancodes outside SDL's range.
+	bool IsScancodeDown(const SDL_Scancode Scancode) const
+	{
+		return Scancode >= 0 && Scancode < SDL_SCANCODE_COUNT && ScancodesDown[Scancode];
+	}
+
+	const FVector2& GetMousePosition() const { return MousePosition; }
+	const FVector2& GetMouseDelta() const { return MouseDelta; }
+
+	// Wheel movement accumulated this frame.
+	const FVector2& GetMouseWheelDelta() const { return MouseWheelDelta; }
+
+private:
+	template <size_t Count>
+	struct FButtonBits
+	{
+		std::bitset<Count> Down;
+		std::bitset<Count> Pressed;
+		std::bitset<Count> Released;
+
+		void SetDown(const size_t Index, const bool bDown)
+		{
+			if (Down.test(Index) == bDown)
+			{
+				// Key repeat, or a release for a press we never saw.
+				return;
+			}
+
+			Down.set(Index, bDown);
+			(bDown ? Pressed : Released).set(Index);
+		}
+
+		void ClearEdges()
+		{
+			Pressed.reset();
+			Released.reset();
+		}
+	};
+
+	// Tests InputKey's bit in Selector(Bits) for whichever device it belongs to. False for axes and unknown keys.
+	template <typename TSelector>
+	bool TestButton(const FInputKey& InputKey, TSelector&& Selector) const;
+
+	// Keyboard keys, mouse buttons and the buttons of every connected gamepad merged, by FInputKey::Index.
+	FButtonBits<FInputKey::BUTTON_INDEX_COUNT> Buttons;
+
+	std::bitset<SDL_SCANCODE_COUNT> ScancodesDown;
+
+	FVector2 MousePosition;
+	FVector2 MouseDelta;
+	FVector2 MouseWheelDelta;
+
+	// Normalised, latest value reported by any gamepad.
+	float GamepadAxes[FInputKey::GAMEPAD_AXIS_COUNT] = {};
+};
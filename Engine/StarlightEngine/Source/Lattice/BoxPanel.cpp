@@ -0,0 +1,64 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "BoxPanel.h"
+
+// Starlight Engine
+#include "DrawList.h"
+
+SL_IMPLEMENT_CLASS(SBoxPanel, SL_PROPERTY(SBoxPanel, Padding), SL_PROPERTY(SBoxPanel, BackgroundColor))
+
+SBoxPanel::SBoxPanel(SWeakObjectPtr InOuter, const FString& InName)
+	: SPanelWidget(InOuter, InName)
+{
+	//
+}
+
+void SBoxPanel::SetPadding(const FVector2& InPadding)
+{
+	if (Padding != InPadding)
+	{
+		Padding = InPadding;
+		InvalidateLayout();
+	}
+}
+
+void SBoxPanel::SetBackgroundColor(const FRenderColor& InBackgroundColor)
+{
+	if (BackgroundColor != InBackgroundColor)
+	{
+		BackgroundColor = InBackgroundColor;
+		InvalidatePaint();
+	}
+}
+
+FVector2 SBoxPanel::MeasureContent(const FVector2& AvailableSize)
+{
+	const FVector2 ContentSize(SMath::Max(0.f, AvailableSize.x - Padding.x * 2.f), SMath::Max(0.f, AvailableSize.y - Padding.y * 2.f));
+
+	FVector2 RequiredSize(0.f);
+	for (const TObjectPtr<SWidget>& Child : Children)
+	{
+		const FVector2 ChildRequiredSize = Child->GetTransform().GetRequiredParentSize(Child->Measure(ContentSize));
+		RequiredSize = FVector2(SMath::Max(RequiredSize.x, ChildRequiredSize.x), SMath::Max(RequiredSize.y, ChildRequiredSize.y));
+	}
+
+	return RequiredSize + Padding * 2.f;
+}
+
+void SBoxPanel::ArrangeContent()
+{
+	const FBox2D& Rect = GetArrangedRect();
+	const FBox2D ContentRect(Rect.Min + Padding, FVector2(SMath::Max(Rect.Min.x + Padding.x, Rect.Max.x - Padding.x), SMath::Max(Rect.Min.y + Padding.y, Rect.Max.y - Padding.y)));
+
+	for (const TObjectPtr<SWidget>& Child : Children)
+	{
+		Child->Arrange(Child->GetTransform().Resolve(ContentRect, Child->GetDesiredSize()));
+	}
+}
+
+void SBoxPanel::OnPaint(FLatticeDrawList& DrawList)
+{
+	DrawList.AddRect(GetArrangedRect(), BackgroundColor);
+	Super::OnPaint(DrawList);
+}
@@ -0,0 +1,36 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Starlight Engine
+#include "PanelWidget.h"
+#include "Framework/Color.h"
+
+// Places each child by the anchors of its SWidgetTransform, inside the panel's rect less Padding.
+// Optionally fills its rect with a background color behind the children.
+class SBoxPanel : public SPanelWidget
+{
+	SL_DECLARE_CLASS(SBoxPanel, SPanelWidget)
+
+public:
+	SBoxPanel(SWeakObjectPtr InOuter, const FString& InName = "");
+
+	const FVector2& GetPadding() const { return Padding; }
+
+	// Space kept free on each side, left/right and top/bottom.
+	void SetPadding(const FVector2& InPadding);
+
+	const FRenderColor& GetBackgroundColor() const { return BackgroundColor; }
+	void SetBackgroundColor(const FRenderColor& InBackgroundColor);
+
+protected:
+	FVector2 MeasureContent(const FVector2& AvailableSize) override;
+	void ArrangeContent() override;
+	void OnPaint(FLatticeDrawList& DrawList) override;
+
+private:
+	FVector2 Padding;
+
+	// Transparent by default, which draws nothing.
+	FRenderColor BackgroundColor = FRenderColor(0.f, 0.f);
+};
@@ -0,0 +1,112 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "DrawList.h"
+
+void FLatticeDrawList::Clear()
+{
+	Vertices.clear();
+	Indices.clear();
+	Commands.clear();
+	ClipStack.clear();
+}
+
+void FLatticeDrawList::PushClipRect(const FBox2D& Rect)
+{
+	FBox2D ClipRect = Rect;
+	if (ClipStack.empty() == false)
+	{
+		const FBox2D& Current = ClipStack.back();
+		ClipRect.Min = FVector2(SMath::Max(Rect.Min.x, Current.Min.x), SMath::Max(Rect.Min.y, Current.Min.y));
+		ClipRect.Max = FVector2(SMath::Max(ClipRect.Min.x, SMath::Min(Rect.Max.x, Current.Max.x)), SMath::Max(ClipRect.Min.y, SMath::Min(Rect.Max.y, Current.Max.y)));
+	}
+
+	ClipStack.push_back(ClipRect);
+}
+
+void FLatticeDrawList::PopClipRect()
+{
+	if (ClipStack.empty() == false)
+	{
+		ClipStack.pop_back();
+	}
+}
+
+void FLatticeDrawList::AddRect(const FBox2D& Rect, const FRenderColor& Color)
+{
+	AddQuad(Rect, nullptr, FVector2(0.f), FVector2(0.f), Color);
+}
+
+void FLatticeDrawList::AddTexturedRect(const FBox2D& Rect, SDL_Texture* Texture, const FVector2& UVMin, const FVector2& UVMax, const FRenderColor& Tint)
+{
+	AddQuad(Rect, Texture, UVMin, UVMax, Tint);
+}
+
+void FLatticeDrawList::AddTriangles(SDL_Texture* Texture, const SDL_Vertex* InVertices, const int VertexCount, const int* InIndices, const int IndexCount)
+{
+	if (VertexCount <= 0 || IndexCount <= 0)
+	{
+		return;
+	}
+
+	FLatticeDrawCommand& Command = GetCommandFor(Texture);
+	const int FirstVertex = static_cast<int>(Vertices.size());
+	Vertices.insert(Vertices.end(), InVertices, InVertices + VertexCount);
+	for (int Index = 0; Index < IndexCount; ++Index)
+	{
+		Indices.push_back(FirstVertex + InIndices[Index]);
+	}
+	Command.IndexCount += static_cast<Uint32>(IndexCount);
+}
+
+FLatticeDrawCommand& FLatticeDrawList::GetCommandFor(SDL_Texture* Texture)
+{
+	FLatticeDrawCommand NewCommand;
+	NewCommand.Texture = Texture;
+	NewCommand.IndexOffset = static_cast<Uint32>(Indices.size());
+	if (ClipStack.empty() == false)
+	{
+		// SDL clips in whole pixels. Round outwards so nothing inside the rect is lost.
+		const FBox2D& ClipBox = ClipStack.back();
+		const int MinX = static_cast<int>(SDL_floorf(ClipBox.Min.x));
+		const int MinY = static_cast<int>(SDL_floorf(ClipBox.Min.y));
+		NewCommand.ClipRect = {MinX, MinY, static_cast<int>(SDL_ceilf(ClipBox.Max.x)) - MinX, static_cast<int>(SDL_ceilf(ClipBox.Max.y)) - MinY};
+		NewCommand.bClipped = true;
+	}
+
+	if (Commands.empty() == false && Commands.back().HasSameState(NewCommand))
+	{
+		return Commands.back();
+	}
+
+	return Commands.emplace_back(NewCommand);
+}
+
+bool FLatticeDrawList::IsClippedAway(const FBox2D& Rect) const
+{
+	return ClipStack.empty() == false && ClipStack.back().Intersects(Rect) == false;
+}
+
+void FLatticeDrawList::AddQuad(const FBox2D& Rect, SDL_Texture* Texture, const FVector2& UVMin, const FVector2& UVMax, const FRenderColor& Color)
+{
+	if (Color.A <= 0.f || IsClippedAway(Rect))
+	{
+		return;
+	}
+
+	FLatticeDrawCommand& Command = GetCommandFor(Texture);
+
+	const SDL_FColor VertexColor = {Color.R, Color.G, Color.B, Color.A};
+	const int FirstVertex = static_cast<int>(Vertices.size());
+	Vertices.push_back({{Rect.Min.x, Rect.Min.y}, VertexColor, {UVMin.x, UVMin.y}});
+	Vertices.push_back({{Rect.Max.x, Rect.Min.y}, VertexColor, {UVMax.x, UVMin.y}});
+	Vertices.push_back({{Rect.Max.x, Rect.Max.y}, VertexColor, {UVMax.x, UVMax.y}});
+	Vertices.push_back({{Rect.Min.x, Rect.Max.y}, VertexColor, {UVMin.x, UVMax.y}});
+
+	const int QuadIndices[] = {0, 1, 2, 0, 2, 3};
+	for (const int QuadIndex : QuadIndices)
+	{
+		Indices.push_back(FirstVertex + QuadIndex);
+	}
+	Command.IndexCount += 6;
+}
@@ -0,0 +1,84 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <vector>
+
+// SDL
+#include <SDL3/SDL_render.h>
+
+// Starlight Engine
+#include "Framework/Color.h"
+#include "Math/Box2D.h"
+
+// A run of indices drawn with one texture and clip rect, i.e. one SDL_RenderGeometry call.
+struct FLatticeDrawCommand
+{
+	SDL_Texture* Texture = nullptr;
+
+	// Only used when bClipped is set.
+	SDL_Rect ClipRect = {0, 0, 0, 0};
+	bool bClipped = false;
+
+	Uint32 IndexOffset = 0;
+	Uint32 IndexCount = 0;
+
+	bool HasSameState(const FLatticeDrawCommand& Other) const
+	{
+		return Texture == Other.Texture && bClipped == Other.bClipped && (bClipped == false || SDL_RectsEqual(&ClipRect, &Other.ClipRect));
+	}
+};
+
+/**
+ * @brief Geometry for the whole UI, in the style of an ImGui draw list.
+ * Widgets append triangles into shared vertex and index buffers. A new command is only started when the texture or clip
+ * rect changes, so a UI made of thousands of rects is submitted in a handful of draw calls. The list is kept between
+ * frames and only rebuilt when the UI changes.
+ */
+class FLatticeDrawList
+{
+public:
+	void Clear();
+
+	bool IsEmpty() const { return Indices.empty(); }
+
+	// =============================================
+	// CLIPPING
+	// =============================================
+
+	// Clips everything drawn until the matching PopClipRect, to Rect intersected with the current clip rect.
+	void PushClipRect(const FBox2D& Rect);
+	void PopClipRect();
+
+	// =============================================
+	// PRIMITIVES
+	// =============================================
+
+	void AddRect(const FBox2D& Rect, const FRenderColor& Color);
+
+	// UVs are in [0, 1] across the texture.
+	void AddTexturedRect(const FBox2D& Rect, SDL_Texture* Texture, const FVector2& UVMin = FVector2(0.f), const FVector2& UVMax = FVector2(1.f), const FRenderColor& Tint = FRenderColor());
+
+	// Appends raw triangles. Indices are relative to the first of the given vertices.
+	void AddTriangles(SDL_Texture* Texture, const SDL_Vertex* InVertices, int VertexCount, const int* InIndices, int IndexCount);
+
+	const std::vector<SDL_Vertex>& GetVertices() const { return Vertices; }
+	const std::vector<int>& GetIndices() const { return Indices; }
+	const std::vector<FLatticeDrawCommand>& GetCommands() const { return Commands; }
+
+private:
+	// Returns the command to append to, starting a new one if the texture or clip rect differ from the last one.
+	FLatticeDrawCommand& GetCommandFor(SDL_Texture* Texture);
+
+	// Whether Rect is entirely outside the current clip rect.
+	bool IsClippedAway(const FBox2D& Rect) const;
+
+	void AddQuad(const FBox2D& Rect, SDL_Texture* Texture, const FVector2& UVMin, const FVector2& UVMax, const FRenderColor& Color);
+
+	std::vector<SDL_Vertex> Vertices;
+	std::vector<int> Indices;
+	std::vector<FLatticeDrawCommand> Commands;
+
+	std::vector<FBox2D> ClipStack;
+};
@@ -0,0 +1,98 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "HitTestGrid.h"
+
+void FLatticeHitTestGrid::Rebuild(SWidget& Root)
+{
+	Clear();
+
+	Bounds = Root.GetArrangedRect();
+	Root.AddToHitTestGrid(*this, Bounds);
+
+	const FVector2 Size = Bounds.GetSize();
+	ColumnCount = SDL_max(1, static_cast<Sint32>(SDL_ceilf(Size.x / CELL_SIZE)));
+	RowCount = SDL_max(1, static_cast<Sint32>(SDL_ceilf(Size.y / CELL_SIZE)));
+
+	// Counting sort into cells: count each cell's entries, turn the counts into offsets, then fill.
+	CellStarts.assign(static_cast<size_t>(ColumnCount * RowCount) + 1, 0);
+	for (const FEntry& Entry : Entries)
+	{
+		for (Sint32 Row = ToRow(Entry.Rect.Min.y); Row <= ToRow(Entry.Rect.Max.y); ++Row)
+		{
+			for (Sint32 Column = ToColumn(Entry.Rect.Min.x); Column <= ToColumn(Entry.Rect.Max.x); ++Column)
+			{
+				++CellStarts[Row * ColumnCount + Column + 1];
+			}
+		}
+	}
+
+	for (size_t Cell = 1; Cell < CellStarts.size(); ++Cell)
+	{
+		CellStarts[Cell] += CellStarts[Cell - 1];
+	}
+
+	CellEntries.resize(CellStarts.back());
+	std::vector<Uint32> CellCursors(CellStarts.begin(), CellStarts.end() - 1);
+	for (Uint32 EntryIndex = 0; EntryIndex < Entries.size(); ++EntryIndex)
+	{
+		const FBox2D& Rect = Entries[EntryIndex].Rect;
+		for (Sint32 Row = ToRow(Rect.Min.y); Row <= ToRow(Rect.Max.y); ++Row)
+		{
+			for (Sint32 Column = ToColumn(Rect.Min.x); Column <= ToColumn(Rect.Max.x); ++Column)
+			{
+				CellEntries[CellCursors[Row * ColumnCount + Column]++] = EntryIndex;
+			}
+		}
+	}
+}
+
+void FLatticeHitTestGrid::Clear()
+{
+	Bounds = FBox2D();
+	ColumnCount = 0;
+	RowCount = 0;
+	Entries.clear();
+	CellStarts.clear();
+	CellEntries.clear();
+}
+
+void FLatticeHitTestGrid::AddWidget(const TObjectPtr<SWidget>& Widget, const FBox2D& Rect)
+{
+	Entries.push_back({Widget, Rect});
+}
+
+TObjectPtr<SWidget> FLatticeHitTestGrid::FindWidgetAt(const FVector2& Position) const
+{
+	if (CellStarts.empty() || Bounds.Contains(Position) == false)
+	{
+		return nullptr;
+	}
+
+	const Sint32 Cell = ToRow(Position.y) * ColumnCount + ToColumn(Position.x);
+
+	// Topmost first.
+	for (Uint32 Slot = CellStarts[Cell + 1]; Slot > CellStarts[Cell]; --Slot)
+	{
+		const FEntry& Entry = Entries[CellEntries[Slot - 1]];
+		if (Entry.Rect.Contains(Position))
+		{
+			if (TObjectPtr<SWidget> Widget = Entry.Widget.lock())
+			{
+				return Widget;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+Sint32 FLatticeHitTestGrid::ToColumn(const float X) const
+{
+	return SDL_clamp(static_cast<Sint32>((X - Bounds.Min.x) / CELL_SIZE), 0, ColumnCount - 1);
+}
+
+Sint32 FLatticeHitTestGrid::ToRow(const float Y) const
+{
+	return SDL_clamp(static_cast<Sint32>((Y - Bounds.Min.y) / CELL_SIZE), 0, RowCount - 1);
+}
@@ -0,0 +1,55 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <vector>
+
+// Starlight Engine
+#include "Widget.h"
+
+/**
+ * @brief Screen-space grid of the hit-testable widgets in a tree, for finding the widget under the pointer.
+ * Built from the arranged layout and only rebuilt when the layout changes. A query looks at the one cell under the
+ * point instead of walking the widget tree, so pointer moves cost the same however large the UI is.
+ */
+class FLatticeHitTestGrid
+{
+public:
+	static constexpr float CELL_SIZE = 64.f;
+
+	// Refills the grid from Root's tree, covering Root's arranged rect.
+	void Rebuild(SWidget& Root);
+
+	void Clear();
+
+	// Called by SWidget::AddToHitTestGrid while rebuilding. Widgets added later are on top of earlier ones.
+	void AddWidget(const TObjectPtr<SWidget>& Widget, const FBox2D& Rect);
+
+	// The topmost widget under Position, or null.
+	TObjectPtr<SWidget> FindWidgetAt(const FVector2& Position) const;
+
+	Uint32 GetWidgetCount() const { return static_cast<Uint32>(Entries.size()); }
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<SWidget> Widget;
+		FBox2D Rect;
+	};
+
+	Sint32 ToColumn(float X) const;
+	Sint32 ToRow(float Y) const;
+
+	FBox2D Bounds;
+	Sint32 ColumnCount = 0;
+	Sint32 RowCount = 0;
+
+	// In paint order, bottom to top.
+	std::vector<FEntry> Entries;
+
+	// Entry indices of every cell, row by row, ascending within a cell. Cell N's are CellEntries[CellStarts[N]] up to
+	// CellEntries[CellStarts[N + 1]].
+	std::vector<Uint32> CellStarts;
+	std::vector<Uint32> CellEntries;
+};
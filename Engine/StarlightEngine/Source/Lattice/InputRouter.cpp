@@ -0,0 +1,137 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "InputRouter.h"
+
+void FLatticeInputRouter::SetRootWidget(const TObjectPtr<SWidget>& InRootWidget)
+{
+	HandleFocusLost();
+	RootWidget = InRootWidget;
+	bHitTestGridDirty = true;
+}
+
+TObjectPtr<SWidget> FLatticeInputRouter::FindWidgetAt(const FVector2& Position)
+{
+	if (bHitTestGridDirty)
+	{
+		if (const TObjectPtr<SWidget> Root = RootWidget.lock())
+		{
+			HitTestGrid.Rebuild(*Root);
+		}
+		else
+		{
+			HitTestGrid.Clear();
+		}
+
+		bHitTestGridDirty = false;
+	}
+
+	return HitTestGrid.FindWidgetAt(Position);
+}
+
+void FLatticeInputRouter::HandleKeyDown(const FInputKey& InputKey)
+{
+	if (InputKey.Type != EInputKeyType::MouseButton)
+	{
+		return;
+	}
+
+	FPointerEvent Event;
+	Event.Type = EPointerEventType::ButtonDown;
+	Event.Position = PointerPosition;
+	Event.Button = InputKey;
+
+	const TObjectPtr<SWidget> Target = FindWidgetAt(PointerPosition);
+	const TObjectPtr<SWidget> Handler = Target ? Target->RoutePointerEvent(Event) : nullptr;
+	bLastEventHandled = Handler != nullptr;
+
+	// Whoever handles the first press keeps the pointer until that button is released.
+	if (Handler && CapturedWidget.expired())
+	{
+		CapturedWidget = Handler;
+		CaptureButton = InputKey;
+	}
+}
+
+void FLatticeInputRouter::HandleKeyUp(const FInputKey& InputKey)
+{
+	if (InputKey.Type != EInputKeyType::MouseButton)
+	{
+		return;
+	}
+
+	FPointerEvent Event;
+	Event.Type = EPointerEventType::ButtonUp;
+	Event.Position = PointerPosition;
+	Event.Button = InputKey;
+	bLastEventHandled = RouteEvent(Event);
+
+	if (InputKey == CaptureButton)
+	{
+		CapturedWidget.reset();
+	}
+}
+
+void FLatticeInputRouter::HandleMouseMove(const FVector2& Position, const FVector2& Delta)
+{
+	PointerPosition = Position;
+	SetHoveredWidget(FindWidgetAt(Position));
+
+	FPointerEvent Event;
+	Event.Type = EPointerEventType::Move;
+	Event.Position = Position;
+	Event.Delta = Delta;
+	bLastEventHandled = RouteEvent(Event);
+}
+
+void FLatticeInputRouter::HandleMouseWheel(const FVector2& Delta)
+{
+	FPointerEvent Event;
+	Event.Type = EPointerEventType::Wheel;
+	Event.Position = PointerPosition;
+	Event.Delta = Delta;
+	bLastEventHandled = RouteEvent(Event);
+}
+
+void FLatticeInputRouter::HandleFocusLost()
+{
+	CapturedWidget.reset();
+	SetHoveredWidget(nullptr);
+	bLastEventHandled = false;
+}
+
+bool FLatticeInputRouter::RouteEvent(const FPointerEvent& Event)
+{
+	TObjectPtr<SWidget> Target = CapturedWidget.lock();
+	if (Target == nullptr)
+	{
+		Target = Event.Type == EPointerEventType::Move ? HoveredWidget.lock() : FindWidgetAt(Event.Position);
+	}
+
+	return Target && Target->RoutePointerEvent(Event) != nullptr;
+}
+
+void FLatticeInputRouter::SetHoveredWidget(const TObjectPtr<SWidget>& Widget)
+{
+	const TObjectPtr<SWidget> PreviousWidget = HoveredWidget.lock();
+	if (PreviousWidget == Widget)
+	{
+		return;
+	}
+
+	HoveredWidget = Widget;
+
+	FPointerEvent Event;
+	Event.Position = PointerPosition;
+	if (PreviousWidget)
+	{
+		Event.Type = EPointerEventType::Leave;
+		PreviousWidget->OnPointerEvent(Event);
+	}
+
+	if (Widget)
+	{
+		Event.Type = EPointerEventType::Enter;
+		Widget->OnPointerEvent(Event);
+	}
+}
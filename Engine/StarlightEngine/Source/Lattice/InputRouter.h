@@ -0,0 +1,53 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Starlight Engine
+#include "HitTestGrid.h"
+#include "Input/InputProcessor.h"
+
+/**
+ * @brief Turns mouse input into pointer events for a Lattice widget tree.
+ * Each event goes to the topmost widget under the pointer, found through an FLatticeHitTestGrid, and bubbles up its
+ * parents until one handles it. A widget that handles a button press captures the pointer, receiving the moves and the
+ * matching release even once the pointer has left it.
+ */
+class FLatticeInputRouter : public InputProcessor
+{
+public:
+	void SetRootWidget(const TObjectPtr<SWidget>& InRootWidget);
+
+	// Call whenever the root's layout changed, see SWidget::UpdateLayout. The grid is rebuilt on the next event.
+	void InvalidateHitTestGrid() { bHitTestGridDirty = true; }
+
+	// The topmost hit-testable widget under Position, or null.
+	TObjectPtr<SWidget> FindWidgetAt(const FVector2& Position);
+
+	TObjectPtr<SWidget> GetHoveredWidget() const { return HoveredWidget.lock(); }
+
+	// Whether the last pointer event was handled by the UI, and so should be ignored by the game.
+	bool WasLastEventHandled() const { return bLastEventHandled; }
+
+	void HandleKeyDown(const FInputKey& InputKey) override;
+	void HandleKeyUp(const FInputKey& InputKey) override;
+	void HandleMouseMove(const FVector2& Position, const FVector2& Delta) override;
+	void HandleMouseWheel(const FVector2& Delta) override;
+	void HandleFocusLost() override;
+
+private:
+	// Sends Event to the captured widget if there is one, otherwise to the widget under the pointer.
+	bool RouteEvent(const FPointerEvent& Event);
+
+	void SetHoveredWidget(const TObjectPtr<SWidget>& Widget);
+
+	TWeakObjectPtr<SWidget> RootWidget;
+	TWeakObjectPtr<SWidget> HoveredWidget;
+	TWeakObjectPtr<SWidget> CapturedWidget;
+	FInputKey CaptureButton;
+
+	FLatticeHitTestGrid HitTestGrid;
+	bool bHitTestGridDirty = true;
+
+	FVector2 PointerPosition;
+	bool bLastEventHandled = false;
+};
@@ -0,0 +1,81 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "PanelWidget.h"
+
+// Starlight Engine
+#include "DrawList.h"
+#include "HitTestGrid.h"
+
+SL_IMPLEMENT_CLASS(SPanelWidget, SL_PROPERTY(SPanelWidget, bClipChildren))
+
+SPanelWidget::SPanelWidget(SWeakObjectPtr InOuter, const FString& InName)
+	: SWidget(InOuter, InName)
+{
+	//
+}
+
+void SPanelWidget::AddChild(const TObjectPtr<SWidget>& Child)
+{
+	if (Child == nullptr || std::find(Children.begin(), Children.end(), Child) != Children.end())
+	{
+		return;
+	}
+
+	Children.push_back(Child);
+	Child->SetParentWidget(std::static_pointer_cast<SWidget>(shared_from_this()));
+}
+
+bool SPanelWidget::RemoveChild(const TObjectPtr<SWidget>& Child)
+{
+	const auto Found = std::find(Children.begin(), Children.end(), Child);
+	if (Found == Children.end())
+	{
+		return false;
+	}
+
+	Children.erase(Found);
+	Child->SetParentWidget(TWeakObjectPtr<SWidget>());
+	InvalidateLayout();
+	return true;
+}
+
+void SPanelWidget::SetClipChildren(const bool bInClipChildren)
+{
+	if (bClipChildren != bInClipChildren)
+	{
+		bClipChildren = bInClipChildren;
+
+		// Clipping also applies to hit-testing, whose grid is only rebuilt when the layout changes.
+		InvalidateLayout();
+	}
+}
+
+void SPanelWidget::AddToHitTestGrid(FLatticeHitTestGrid& Grid, const FBox2D& ClipRect)
+{
+	Super::AddToHitTestGrid(Grid, ClipRect);
+
+	const FBox2D ChildClipRect = bClipChildren ? ClipRect.Intersection(GetArrangedRect()) : ClipRect;
+	for (const TObjectPtr<SWidget>& Child : Children)
+	{
+		Child->AddToHitTestGrid(Grid, ChildClipRect);
+	}
+}
+
+void SPanelWidget::OnPaint(FLatticeDrawList& DrawList)
+{
+	if (bClipChildren)
+	{
+		DrawList.PushClipRect(GetArrangedRect());
+	}
+
+	for (const TObjectPtr<SWidget>& Child : Children)
+	{
+		Child->Paint(DrawList);
+	}
+
+	if (bClipChildren)
+	{
+		DrawList.PopClipRect();
+	}
+}
@@ -0,0 +1,40 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Libraries
+#include <vector>
+
+// Starlight Engine
+#include "Widget.h"
+
+// A widget that lays out child widgets. Children are kept alive by the panel.
+class SPanelWidget : public SWidget
+{
+	SL_DECLARE_CLASS(SPanelWidget, SWidget)
+
+public:
+	SPanelWidget(SWeakObjectPtr InOuter, const FString& InName = "");
+
+	void AddChild(const TObjectPtr<SWidget>& Child);
+
+	/// @returns whether Child was a child of this panel.
+	bool RemoveChild(const TObjectPtr<SWidget>& Child);
+
+	const std::vector<TObjectPtr<SWidget>>& GetChildren() const { return Children; }
+
+	bool GetClipChildren() const { return bClipChildren; }
+
+	// Whether children are clipped to the panel's rect, e.g. for scrolling lists.
+	void SetClipChildren(bool bInClipChildren);
+
+	void AddToHitTestGrid(FLatticeHitTestGrid& Grid, const FBox2D& ClipRect) override;
+
+protected:
+	void OnPaint(FLatticeDrawList& DrawList) override;
+
+	std::vector<TObjectPtr<SWidget>> Children;
+
+private:
+	bool bClipChildren = false;
+};
@@ -0,0 +1,84 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "StackPanel.h"
+
+SL_IMPLEMENT_CLASS(SStackPanel, SL_PROPERTY(SStackPanel, Spacing))
+
+SStackPanel::SStackPanel(SWeakObjectPtr InOuter, const FString& InName)
+	: SPanelWidget(InOuter, InName)
+{
+	//
+}
+
+void SStackPanel::SetOrientation(const EStackOrientation InOrientation)
+{
+	if (Orientation != InOrientation)
+	{
+		Orientation = InOrientation;
+		InvalidateLayout();
+	}
+}
+
+void SStackPanel::SetSpacing(const float InSpacing)
+{
+	if (Spacing != InSpacing)
+	{
+		Spacing = InSpacing;
+		InvalidateLayout();
+	}
+}
+
+FVector2 SStackPanel::MeasureContent(const FVector2& AvailableSize)
+{
+	const bool bVertical = Orientation == EStackOrientation::Vertical;
+
+	// Children get the full cross size, and unlimited room along the stack.
+	constexpr float UNBOUNDED_SIZE = 1e30f;
+	const FVector2 ChildAvailableSize = bVertical ? FVector2(AvailableSize.x, UNBOUNDED_SIZE) : FVector2(UNBOUNDED_SIZE, AvailableSize.y);
+
+	float Length = 0.f;
+	float CrossSize = 0.f;
+	for (const TObjectPtr<SWidget>& Child : Children)
+	{
+		const FVector2 ChildSize = Child->Measure(ChildAvailableSize);
+		Length += GetChildLength(*Child);
+		CrossSize = SMath::Max(CrossSize, bVertical ? ChildSize.x : ChildSize.y);
+	}
+
+	if (Children.empty() == false)
+	{
+		Length += Spacing * static_cast<float>(Children.size() - 1);
+	}
+
+	return bVertical ? FVector2(CrossSize, Length) : FVector2(Length, CrossSize);
+}
+
+void SStackPanel::ArrangeContent()
+{
+	const FBox2D& Rect = GetArrangedRect();
+	const bool bVertical = Orientation == EStackOrientation::Vertical;
+
+	float Cursor = bVertical ? Rect.Min.y : Rect.Min.x;
+	for (const TObjectPtr<SWidget>& Child : Children)
+	{
+		const float Length = GetChildLength(*Child);
+		if (bVertical)
+		{
+			Child->Arrange(FBox2D(FVector2(Rect.Min.x, Cursor), FVector2(Rect.Max.x, Cursor + Length)));
+		}
+		else
+		{
+			Child->Arrange(FBox2D(FVector2(Cursor, Rect.Min.y), FVector2(Cursor + Length, Rect.Max.y)));
+		}
+
+		Cursor += Length + Spacing;
+	}
+}
+
+float SStackPanel::GetChildLength(const SWidget& Child) const
+{
+	const bool bVertical = Orientation == EStackOrientation::Vertical;
+	const float FixedLength = bVertical ? Child.GetTransform().Size.y : Child.GetTransform().Size.x;
+	return FixedLength > 0.f ? FixedLength : bVertical ? Child.GetDesiredSize().y : Child.GetDesiredSize().x;
+}
@@ -0,0 +1,43 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Starlight Engine
+#include "PanelWidget.h"
+
+enum class EStackOrientation : Uint8
+{
+	Horizontal,
+	Vertical,
+};
+
+/**
+ * @brief Lines children up one after another at their desired size, stretched across the panel.
+ * Each child's SWidgetTransform.Size overrides its desired size along the stacking axis.
+ */
+class SStackPanel : public SPanelWidget
+{
+	SL_DECLARE_CLASS(SStackPanel, SPanelWidget)
+
+public:
+	SStackPanel(SWeakObjectPtr InOuter, const FString& InName = "");
+
+	EStackOrientation GetOrientation() const { return Orientation; }
+	void SetOrientation(EStackOrientation InOrientation);
+
+	float GetSpacing() const { return Spacing; }
+
+	// Gap between neighbouring children.
+	void SetSpacing(float InSpacing);
+
+protected:
+	FVector2 MeasureContent(const FVector2& AvailableSize) override;
+	void ArrangeContent() override;
+
+private:
+	// A child's extent along the stacking axis.
+	float GetChildLength(const SWidget& Child) const;
+
+	EStackOrientation Orientation = EStackOrientation::Vertical;
+	float Spacing = 0.f;
+};
@@ -0,0 +1,56 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "TextBlock.h"
+
+// Starlight Engine
+#include "DrawList.h"
+#include "Engine/Renderer/Font.h"
+
+SL_IMPLEMENT_CLASS(STextBlock, SL_PROPERTY(STextBlock, Text), SL_PROPERTY(STextBlock, Color))
+
+STextBlock::STextBlock(SWeakObjectPtr InOuter, const FString& InName)
+	: SWidget(InOuter, InName)
+{
+	//
+}
+
+void STextBlock::SetText(const FString& InText)
+{
+	if (Text != InText)
+	{
+		Text = InText;
+		InvalidateLayout();
+	}
+}
+
+void STextBlock::SetFont(const TSharedPtr<FFont>& InFont)
+{
+	if (Font != InFont)
+	{
+		Font = InFont;
+		InvalidateLayout();
+	}
+}
+
+void STextBlock::SetColor(const FRenderColor& InColor)
+{
+	if (Color != InColor)
+	{
+		Color = InColor;
+		InvalidatePaint();
+	}
+}
+
+FVector2 STextBlock::MeasureContent(const FVector2& AvailableSize)
+{
+	return Font ? Font->MeasureText(Text) : FVector2(0.f);
+}
+
+void STextBlock::OnPaint(FLatticeDrawList& DrawList)
+{
+	if (Font)
+	{
+		Font->DrawText(DrawList, Text, GetArrangedRect().Min, Color);
+	}
+}
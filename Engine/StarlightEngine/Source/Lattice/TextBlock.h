@@ -0,0 +1,38 @@
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+#pragma once
+
+// Starlight Engine
+#include "Widget.h"
+#include "Pointers.h"
+#include "Framework/Color.h"
+
+// Forward Declarations
+class FFont;
+
+// A label drawn with an FFont. Its desired size is the size of its text.
+class STextBlock : public SWidget
+{
+	SL_DECLARE_CLASS(STextBlock, SWidget)
+
+public:
+	STextBlock(SWeakObjectPtr InOuter, const FString& InName = "");
+
+	const FString& GetText() const { return Text; }
+	void SetText(const FString& InText);
+
+	const TSharedPtr<FFont>& GetFont() const { return Font; }
+	void SetFont(const TSharedPtr<FFont>& InFont);
+
+	const FRenderColor& GetColor() const { return Color; }
+	void SetColor(const FRenderColor& InColor);
+
+protected:
+	FVector2 MeasureContent(const FVector2& AvailableSize) override;
+	void OnPaint(FLatticeDrawList& DrawList) override;
+
+private:
+	FString Text;
+	TSharedPtr<FFont> Font;
+	FRenderColor Color;
+};
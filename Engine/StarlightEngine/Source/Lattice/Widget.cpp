@@ -4,4 +4,158 @@
 #include "Widget.h"
 
 // Starlight Engine
+#include "DrawList.h"
+#include "HitTestGrid.h"
 #include "Object/UserController.h"
+
+SL_IMPLEMENT_CLASS(SWidget, SL_PROPERTY(SWidget, OwningUserController), SL_PROPERTY(SWidget, ParentWidget), SL_PROPERTY(SWidget, bHitTestVisible))
+
+SWidget::SWidget(SWeakObjectPtr InOuter, const FString& InName)
+	: SObject(InOuter, InName)
+{
+	//
+}
+
+void SWidget::SetTransform(const SWidgetTransform& InTransform)
+{
+	if (Transform != InTransform)
+	{
+		Transform = InTransform;
+		InvalidateLayout();
+	}
+}
+
+bool SWidget::UpdateLayout(const FVector2& ViewportSize)
+{
+	const FBox2D ViewportRect(FVector2(0.f), ViewportSize);
+
+	// Any change below marks the whole path up to here dirty, so checking the root is enough.
+	const bool bChanged = bLayoutDirty || bArrangeDirty || ArrangedRect.Min != ViewportRect.Min || ArrangedRect.Max != ViewportRect.Max;
+
+	Measure(ViewportSize);
+	Arrange(ViewportRect);
+	return bChanged;
+}
+
+FVector2 SWidget::Measure(const FVector2& AvailableSize)
+{
+	if (bLayoutDirty || MeasuredAvailableSize != AvailableSize)
+	{
+		DesiredSize = MeasureContent(AvailableSize);
+		MeasuredAvailableSize = AvailableSize;
+		bLayoutDirty = false;
+		bArrangeDirty = true;
+	}
+
+	return DesiredSize;
+}
+
+void SWidget::Arrange(const FBox2D& Rect)
+{
+	if (bLayoutDirty)
+	{
+		// Arranged without being measured first, e.g. by a container that sizes children itself.
+		Measure(Rect.GetSize());
+	}
+
+	if (bArrangeDirty == false && Rect.Min == ArrangedRect.Min && Rect.Max == ArrangedRect.Max)
+	{
+		return;
+	}
+
+	ArrangedRect = Rect;
+	bArrangeDirty = false;
+	ArrangeContent();
+	InvalidatePaint();
+}
+
+void SWidget::InvalidateLayout()
+{
+	SWidget* Widget = this;
+	while (Widget != nullptr && Widget->bLayoutDirty == false)
+	{
+		Widget->bLayoutDirty = true;
+		Widget->bArrangeDirty = true;
+
+		const TObjectPtr<SWidget> Parent = Widget->ParentWidget.lock();
+		Widget = Parent.get();
+	}
+
+	InvalidatePaint();
+}
+
+bool SWidget::UpdateDrawList(FLatticeDrawList& DrawList)
+{
+	if (bPaintDirty == false)
+	{
+		return false;
+	}
+
+	DrawList.Clear();
+	Paint(DrawList);
+	return true;
+}
+
+void SWidget::Paint(FLatticeDrawList& DrawList)
+{
+	bPaintDirty = false;
+	OnPaint(DrawList);
+}
+
+void SWidget::InvalidatePaint()
+{
+	SWidget* Widget = this;
+	while (Widget != nullptr && Widget->bPaintDirty == false)
+	{
+		Widget->bPaintDirty = true;
+
+		const TObjectPtr<SWidget> Parent = Widget->ParentWidget.lock();
+		Widget = Parent.get();
+	}
+}
+
+void SWidget::SetParentWidget(TWeakObjectPtr<SWidget> InParentWidget)
+{
+	ParentWidget = InParentWidget;
+
+	// A new widget starts dirty, which would stop its own invalidation before it reached the parent.
+	if (const TObjectPtr<SWidget> Parent = ParentWidget.lock())
+	{
+		Parent->InvalidateLayout();
+	}
+	InvalidateLayout();
+}
+
+TObjectPtr<SWidget> SWidget::RoutePointerEvent(const FPointerEvent& Event)
+{
+	TObjectPtr<SWidget> Widget = std::static_pointer_cast<SWidget>(shared_from_this());
+	while (Widget && Widget->OnPointerEvent(Event) == false)
+	{
+		Widget = Widget->ParentWidget.lock();
+	}
+
+	return Widget;
+}
+
+void SWidget::SetHitTestVisible(const bool bInHitTestVisible)
+{
+	if (bHitTestVisible != bInHitTestVisible)
+	{
+		bHitTestVisible = bInHitTestVisible;
+
+		// The hit-test grid is only rebuilt when the layout changes.
+		InvalidateLayout();
+	}
+}
+
+void SWidget::AddToHitTestGrid(FLatticeHitTestGrid& Grid, const FBox2D& ClipRect)
+{
+	if (bHitTestVisible)
+	{
+		const FBox2D VisibleRect = ArrangedRect.Intersection(ClipRect);
+		if (VisibleRect.IsValid())
+		{
+			Grid.AddWidget(std::static_pointer_cast<SWidget>(shared_from_this()), VisibleRect);
+		}
+	}
+}
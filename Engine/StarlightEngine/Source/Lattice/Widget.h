@@ -3,21 +3,149 @@
 #pragma once
 
 // Starlight Engine
+#include "WidgetTransform.h"
+#include "Input/InputKeys.h"
 #include "Object/Object.h"
 
 // Forward Declarations
+class FLatticeDrawList;
+class FLatticeHitTestGrid;
 class SUserController;
 
+enum class EPointerEventType : Uint8
+{
+	Move,
+	ButtonDown,
+	ButtonUp,
+	Wheel,
+
+	// The pointer moved onto or off the topmost widget under it. Only sent to that widget, never bubbled.
+	Enter,
+	Leave,
+};
+
+struct FPointerEvent
+{
+	EPointerEventType Type = EPointerEventType::Move;
+
+	// In viewport pixels.
+	FVector2 Position;
+
+	// Movement for Move, scroll amount for Wheel.
+	FVector2 Delta;
+
+	// The mouse button, for ButtonDown and ButtonUp.
+	FInputKey Button;
+};
+
+/**
+ * @brief Base of every Lattice widget.
+ * Layout is retained: Measure and Arrange cache their results and only recompute widgets on a dirty path. Changing
+ * anything that affects layout calls InvalidateLayout, which flags the widget and its ancestors up to the first one
+ * already flagged. A UI that does not change therefore costs one flag check per frame in UpdateLayout.
+ */
 class SWidget : public SObject
 {
+	SL_DECLARE_CLASS(SWidget, SObject)
+
+	friend class SPanelWidget;
+	friend class FLatticeInputRouter;
+
 public:
+	SWidget(SWeakObjectPtr InOuter, const FString& InName = "");
+
 	TWeakObjectPtr<SUserController> GetOwningUserController() { return OwningUserController; }
+	TWeakObjectPtr<SWidget> GetParentWidget() const { return ParentWidget; }
+
+	// =============================================
+	// LAYOUT
+	// =============================================
+
+	const SWidgetTransform& GetTransform() const { return Transform; }
+	void SetTransform(const SWidgetTransform& InTransform);
+
+	// Lays out this widget as the root of a tree filling a viewport. Does nothing if nothing changed since last time.
+	/// @returns whether anything was laid out again.
+	bool UpdateLayout(const FVector2& ViewportSize);
+
+	// Computes the size this widget wants when given at most AvailableSize. Cached until invalidated.
+	FVector2 Measure(const FVector2& AvailableSize);
+
+	// Places this widget at Rect, in viewport pixels. Skips the whole subtree if it is clean and Rect did not change.
+	void Arrange(const FBox2D& Rect);
+
+	const FVector2& GetDesiredSize() const { return DesiredSize; }
+	const FBox2D& GetArrangedRect() const { return ArrangedRect; }
+
+	bool NeedsLayout() const { return bLayoutDirty; }
+
+	// Flags this widget and its ancestors for layout. Call whenever something changes this widget's size or contents.
+	void InvalidateLayout();
+
+	// =============================================
+	// PAINTING
+	// =============================================
+
+	// Rebuilds DrawList from this widget's tree, only if something in it was repainted since the last call.
+	/// @returns whether DrawList was rebuilt.
+	bool UpdateDrawList(FLatticeDrawList& DrawList);
+
+	// Appends this widget, and its children, to DrawList.
+	void Paint(FLatticeDrawList& DrawList);
+
+	bool NeedsPaint() const { return bPaintDirty; }
+
+	// Flags this widget and its ancestors for repaint. Call when its appearance changes but its layout does not.
+	void InvalidatePaint();
+
+	// =============================================
+	// INPUT
+	// =============================================
+
+	/**
+	 * @brief Offers Event to this widget, then to each ancestor in turn until one handles it.
+	 * @returns the widget that handled it, or null.
+	 */
+	TObjectPtr<SWidget> RoutePointerEvent(const FPointerEvent& Event);
+
+	bool IsHitTestVisible() const { return bHitTestVisible; }
+
+	// Whether pointer events can land on this widget. Its children are hit-tested either way.
+	void SetHitTestVisible(bool bInHitTestVisible);
+
+	// Adds this widget, clipped to ClipRect, to Grid. Containers add their children after themselves.
+	virtual void AddToHitTestGrid(FLatticeHitTestGrid& Grid, const FBox2D& ClipRect);
 
 protected:
 	// Only to be called by widgets that add the child.
 	void SetParentWidget(TWeakObjectPtr<SWidget> InParentWidget);
 
+	// Override to size the widget's contents. Containers measure their children here.
+	virtual FVector2 MeasureContent(const FVector2& AvailableSize) { return FVector2(0.f); }
+
+	// Override to place children inside the widget's new ArrangedRect.
+	virtual void ArrangeContent() {}
+
+	// Override to draw the widget at its ArrangedRect. Containers paint their children here.
+	virtual void OnPaint(FLatticeDrawList& DrawList) {}
+
+	/// @returns true to mark the event handled and stop it bubbling any further.
+	virtual bool OnPointerEvent(const FPointerEvent& Event) { return false; }
+
 private:
 	TWeakObjectPtr<SUserController> OwningUserController = TWeakObjectPtr<SUserController>();
 	TWeakObjectPtr<SWidget> ParentWidget = TWeakObjectPtr<SWidget>();
+
+	SWidgetTransform Transform;
+
+	// Layout cache.
+	FVector2 MeasuredAvailableSize = FVector2(-1.f);
+	FVector2 DesiredSize;
+	FBox2D ArrangedRect;
+	bool bLayoutDirty = true;
+	bool bArrangeDirty = true;
+
+	bool bPaintDirty = true;
+
+	bool bHitTestVisible = true;
 };
@@ -1 +1,70 @@
-#include "WidgetTransform.h"
\ No newline at end of file
+// Copyright © 2025 Bman, Inc. All rights reserved.
+
+// Header
+#include "WidgetTransform.h"
+
+namespace
+{
+struct FAxisTransform
+{
+	float AnchorMin;
+	float AnchorMax;
+	float OffsetMin;
+	float OffsetMax;
+	float Size;
+	float Pivot;
+};
+
+void ResolveAxis(const FAxisTransform& Axis, const float ParentMin, const float ParentSize, const float DesiredSize, float& OutMin, float& OutMax)
+{
+	const float AnchorStart = ParentMin + ParentSize * Axis.AnchorMin;
+	if (Axis.AnchorMin == Axis.AnchorMax)
+	{
+		const float Size = Axis.Size > 0.f ? Axis.Size : DesiredSize;
+		OutMin = AnchorStart + Axis.OffsetMin - Size * Axis.Pivot;
+		OutMax = OutMin + Size;
+		return;
+	}
+
+	OutMin = AnchorStart + Axis.OffsetMin;
+	OutMax = SMath::Max(OutMin, ParentMin + ParentSize * Axis.AnchorMax - Axis.OffsetMax);
+}
+
+float GetRequiredParentAxisSize(const FAxisTransform& Axis, const float DesiredSize)
+{
+	if (Axis.AnchorMin != Axis.AnchorMax)
+	{
+		return SMath::Max(0.f, (DesiredSize + Axis.OffsetMin + Axis.OffsetMax) / (Axis.AnchorMax - Axis.AnchorMin));
+	}
+
+	// Both edges of the widget must land inside the parent.
+	const float Size = Axis.Size > 0.f ? Axis.Size : DesiredSize;
+	float Required = 0.f;
+	if (Axis.AnchorMin < 1.f)
+	{
+		Required = SMath::Max(Required, (Axis.OffsetMin + Size * (1.f - Axis.Pivot)) / (1.f - Axis.AnchorMin));
+	}
+	if (Axis.AnchorMin > 0.f)
+	{
+		Required = SMath::Max(Required, (Size * Axis.Pivot - Axis.OffsetMin) / Axis.AnchorMin);
+	}
+
+	return Required;
+}
+}
+
+FBox2D SWidgetTransform::Resolve(const FBox2D& ParentRect, const FVector2& DesiredSize) const
+{
+	const FVector2 ParentSize = ParentRect.GetSize();
+	FBox2D Rect;
+	ResolveAxis({AnchorMin.x, AnchorMax.x, OffsetMin.x, OffsetMax.x, Size.x, Pivot.x}, ParentRect.Min.x, ParentSize.x, DesiredSize.x, Rect.Min.x, Rect.Max.x);
+	ResolveAxis({AnchorMin.y, AnchorMax.y, OffsetMin.y, OffsetMax.y, Size.y, Pivot.y}, ParentRect.Min.y, ParentSize.y, DesiredSize.y, Rect.Min.y, Rect.Max.y);
+	return Rect;
+}
+
+FVector2 SWidgetTransform::GetRequiredParentSize(const FVector2& DesiredSize) const
+{
+	return FVector2(
+		GetRequiredParentAxisSize({AnchorMin.x, AnchorMax.x, OffsetMin.x, OffsetMax.x, Size.x, Pivot.x}, DesiredSize.x),
+		GetRequiredParentAxisSize({AnchorMin.y, AnchorMax.y, OffsetMin.y, OffsetMax.y, Size.y, Pivot.y}, DesiredSize.y));
+}
@@ -3,8 +3,40 @@
 #pragma once
 
 // Starlight Engine
-#include "Math/Math.h"
+#include "Math/Box2D.h"
 
+/**
+ * @brief Where a widget sits inside an anchoring parent (see SBoxPanel).
+ * Anchors are fractions of the parent's rect. Where AnchorMin equals AnchorMax on an axis, the widget is pinned to that
+ * point: OffsetMin moves its pivot away from the anchor and Size sets its size (0 uses its desired size). Where they
+ * differ, the widget stretches between the two anchors, inset by OffsetMin and OffsetMax.
+ */
 struct SWidgetTransform
 {
+	FVector2 AnchorMin = FVector2(0.f);
+	FVector2 AnchorMax = FVector2(0.f);
+
+	FVector2 OffsetMin = FVector2(0.f);
+	FVector2 OffsetMax = FVector2(0.f);
+
+	FVector2 Size = FVector2(0.f);
+
+	// The point of the widget placed on the anchor, as a fraction of its size.
+	FVector2 Pivot = FVector2(0.f);
+
+	// Places a widget with DesiredSize inside ParentRect.
+	FBox2D Resolve(const FBox2D& ParentRect, const FVector2& DesiredSize) const;
+
+	// The parent size needed to fit a widget with DesiredSize, for measuring anchoring parents.
+	FVector2 GetRequiredParentSize(const FVector2& DesiredSize) const;
+
+	bool operator==(const SWidgetTransform& Other) const
+	{
+		return AnchorMin == Other.AnchorMin && AnchorMax == Other.AnchorMax && OffsetMin == Other.OffsetMin && OffsetMax == Other.OffsetMax && Size == Other.Size && Pivot == Other.Pivot;
+	}
+
+	bool operator!=(const SWidgetTransform& Other) const
+	{
+		return !(*this == Other);
+	}
 };
@@ -6,12 +6,28 @@
 
 // Starlight Engine
 #include "Debug/Logging.h"
+#include "Math/FastMath.h"
 
 // Headers
 #include "Engine/Engine.h"
 
 int main(int argc, char* argv[])
 {
+	// "-CheckMath" measures the fast math functions against their documented bounds and exits without starting the
+	// engine. Unlike a normal run, it exits with EXIT_FAILURE when a check fails, so scripts can gate on it.
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		if (SDL_strcasecmp(argv[Index], "-CheckMath") == 0)
+		{
+			if (SMath::Fast::CheckAccuracy() == false)
+			{
+				SL_LOG_FUNC(LogMain, Error, "Fast math accuracy check failed, see the errors above.");
+				return EXIT_FAILURE;
+			}
+			return EXIT_SUCCESS;
+		}
+	}
+
 	// Initialize SDL
 	SDL_InitFlags SdlFlags = SDL_INIT_VIDEO;
 	SdlFlags |= SDL_INIT_AUDIO;
@@ -31,6 +47,37 @@ int main(int argc, char* argv[])
 		return 0;
 	}
 
+	// Input record / replay, e.g. "-ReplayInput Session.slinput -Benchmark" for repeatable performance runs.
+	{
+		const char* RecordInputPath = nullptr;
+		const char* ReplayInputPath = nullptr;
+		bool bBenchmark = false;
+		for (int Index = 1; Index < argc; ++Index)
+		{
+			if (SDL_strcasecmp(argv[Index], "-RecordInput") == 0 && Index + 1 < argc)
+			{
+				RecordInputPath = argv[++Index];
+			}
+			else if (SDL_strcasecmp(argv[Index], "-ReplayInput") == 0 && Index + 1 < argc)
+			{
+				ReplayInputPath = argv[++Index];
+			}
+			else if (SDL_strcasecmp(argv[Index], "-Benchmark") == 0)
+			{
+				bBenchmark = true;
+			}
+		}
+
+		if (ReplayInputPath != nullptr)
+		{
+			MainEngine->m_inputManager.StartReplay(ReplayInputPath, bBenchmark ? EInputReplayMode::Benchmark : EInputReplayMode::Realtime);
+		}
+		else if (RecordInputPath != nullptr)
+		{
+			MainEngine->m_inputManager.StartRecording(RecordInputPath);
+		}
+	}
+
 	// Main game loop
 	Uint64 LastTick = SDL_GetPerformanceCounter();
 	bool IsRunning = true;
@@ -54,7 +101,7 @@ int main(int argc, char* argv[])
 		constexpr int FRAME_DELAY_MS = 1000 / MAX_FPS;
 		Uint64 FrameEndTime = SDL_GetTicks();
 		Uint64 FrameDuration = FrameEndTime - FrameStartTime;
-		if (FrameDuration < FRAME_DELAY_MS)
+		if (FrameDuration < FRAME_DELAY_MS && MainEngine->m_inputManager.IsUnthrottled() == false)
 		{
 			SDL_Delay(static_cast<Uint32>(FRAME_DELAY_MS - FrameDuration));
 		}